@@ -0,0 +1,69 @@
+"""Micro-benchmark: CameraCombiner vs VectorisedCameraCombiner across camera counts.
+
+Each camera sees every robot of both teams with small noise, the real ball, and a
+number of spurious ball detections scattered over the field.
+
+Usage:
+    python -m benchmarks.bench_camera_combiner [--repeats N] [--false-balls K]
+"""
+
+import argparse
+import math
+import random
+import timeit
+from typing import List
+
+from utama_core.config.physical_constants import MAX_ROBOTS
+from utama_core.data_processing.refiners.position import (
+    CameraCombiner,
+    VectorisedCameraCombiner,
+    VisionBounds,
+)
+from utama_core.entities.data.raw_vision import RawBallData, RawRobotData, RawVisionData
+
+BOUNDS = VisionBounds(x_min=-5.5, x_max=5.5, y_min=-4.0, y_max=4.0)
+CAMERA_COUNTS = (1, 2, 4, 6, 8)
+
+
+def make_frames(n_cameras: int, n_false_balls: int, rng: random.Random) -> List[RawVisionData]:
+    robots = [(rng.uniform(-4.5, 4.5), rng.uniform(-3, 3), rng.uniform(-math.pi, math.pi)) for _ in range(MAX_ROBOTS)]
+    ball = (rng.uniform(-4.5, 4.5), rng.uniform(-3, 3))
+
+    def noisy_robots():
+        return [
+            RawRobotData(i, x + rng.gauss(0, 0.005), y + rng.gauss(0, 0.005), th, rng.uniform(0.5, 1))
+            for i, (x, y, th) in enumerate(robots)
+        ]
+
+    frames = []
+    for cam in range(n_cameras):
+        balls = [RawBallData(ball[0] + rng.gauss(0, 0.005), ball[1] + rng.gauss(0, 0.005), 0, 0.9)]
+        balls += [
+            RawBallData(rng.uniform(-5, 5), rng.uniform(-3.5, 3.5), 0, rng.uniform(0, 0.3))
+            for _ in range(n_false_balls)
+        ]
+        frames.append(RawVisionData(cam / 1000, noisy_robots(), noisy_robots(), balls, cam))
+    return frames
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--repeats", type=int, default=2000, help="combine_cameras calls per measurement")
+    parser.add_argument("--false-balls", type=int, default=5, help="spurious ball detections per camera")
+    args = parser.parse_args()
+
+    rng = random.Random(0)
+    combiners = {"CameraCombiner": CameraCombiner(), "VectorisedCameraCombiner": VectorisedCameraCombiner()}
+
+    print(f"{'cameras':>8} " + " ".join(f"{name + ' (us)':>28}" for name in combiners) + f" {'speedup':>8}")
+    for n_cameras in CAMERA_COUNTS:
+        frames = make_frames(n_cameras, args.false_balls, rng)
+        times = []
+        for combiner in combiners.values():
+            best = min(timeit.repeat(lambda: combiner.combine_cameras(frames, BOUNDS), number=args.repeats, repeat=3))
+            times.append(best / args.repeats * 1e6)
+        print(f"{n_cameras:>8} " + " ".join(f"{t:>28.1f}" for t in times) + f" {times[0] / times[1]:>7.2f}x")
+
+
+if __name__ == "__main__":
+    main()
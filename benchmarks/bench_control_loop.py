@@ -0,0 +1,479 @@
+"""Benchmark suite and regression gate for the per-tick control-loop hot path.
+
+A recorded dataset is replayed tick by tick through each stage StrategyRunner runs every tick:
+
+- ``refiners/chained`` and ``refiners/in_place``: PositionRefiner, VelocityRefiner and RobotInfoRefiner with
+  the GameFrame rebuilt by each refiner, and written into a FrameWorkspace (``refine_in_place=True``);
+- ``proximity``: a fresh ProximityLookup per frame and the queries the skills typically make;
+- ``motion/<scheme>``: ``calculate`` of every control scheme, each friendly robot chasing the ball;
+- ``strategy/<name>``: ``AbstractStrategy.step`` of the example strategies (PID motion, commands discarded).
+
+Datasets are ``clean`` or ``noisy`` (the refiner test recordings: six yellow robots, mirrored here as the blue
+team, with a synthetic ball) or the path of a replay written by ReplayWriter.
+
+Every tick is timed with ``perf_counter_ns`` and, in a second pass under tracemalloc, its peak of newly
+allocated memory is recorded. Reported per component: median and p99 ns per tick and mean allocated bytes per
+tick. ``--update-baseline`` stores the results, ``--check`` compares against them and exits non-zero when a
+component got slower or allocates more than the tolerance allows. Timings are only comparable on the machine
+the baseline was recorded on, so no baseline is committed and CI does not run the check: it is a manual gate.
+Record a baseline on your machine before a change (``pixi run bench --update-baseline``), then run
+``pixi run bench-check`` after it. Without a baseline for the dataset ``--check`` exits with status 2.
+
+Usage:
+    python -m benchmarks.bench_control_loop [--dataset clean|noisy|PATH] [--ticks N] [--only SUBSTR]
+                                            [--check | --update-baseline] [--baseline PATH]
+"""
+
+import argparse
+import csv
+import json
+import math
+import statistics
+import sys
+import time
+import tracemalloc
+from itertools import groupby
+from pathlib import Path
+from typing import Callable, Dict, List, Optional
+
+from utama_core.config.enums import Mode
+from utama_core.config.field_params import STANDARD_FIELD_DIMS
+from utama_core.data_processing.refiners import (
+    FrameWorkspace,
+    PositionRefiner,
+    RobotInfoRefiner,
+    VelocityRefiner,
+)
+from utama_core.entities.data.command import RobotCommand, RobotResponse
+from utama_core.entities.data.object import ObjectKey, ObjectType, TeamType
+from utama_core.entities.data.raw_vision import RawBallData, RawRobotData, RawVisionData
+from utama_core.entities.data.vector import Vector2D, Vector3D
+from utama_core.entities.game import (
+    Ball,
+    Field,
+    Game,
+    GameFrame,
+    GameHistory,
+    ProximityLookup,
+    Robot,
+)
+from utama_core.motion_planning.src.common.control_schemes import (
+    CONTROL_SCHEME_MAP,
+    get_control_scheme,
+)
+from utama_core.team_controller.src.controllers.common.robot_controller_abstract import (
+    AbstractRobotController,
+)
+
+REPO_ROOT = Path(__file__).resolve().parents[1]
+DATASETS = {
+    "clean": REPO_ROOT / "utama_core" / "tests" / "refiners" / "datasets" / "clean.csv",
+    "noisy": REPO_ROOT / "utama_core" / "tests" / "refiners" / "datasets" / "noisy.csv",
+}
+DEFAULT_BASELINE = Path(__file__).resolve().parent / "baselines" / "control_loop.json"
+HISTORY_LENGTH = 120
+
+# (ns, bytes) per tick below which a relative regression is treated as noise
+MIN_NS = 2_000
+MIN_BYTES = 256
+
+Tick = Callable[[int], None]
+
+
+class Dataset:
+    """Raw vision per tick plus the frames the chained refiners make of it, shared by every component."""
+
+    def __init__(self, name: str, vision: List[RawVisionData], my_team_is_yellow: bool, my_team_is_right: bool):
+        self.name = name
+        self.vision = vision
+        self.my_team_is_yellow = my_team_is_yellow
+        self.my_team_is_right = my_team_is_right
+        self.initial_frame = _frame_from_vision(vision[0], my_team_is_yellow, my_team_is_right)
+        self.frames = _refine_all(self)
+
+    def __len__(self) -> int:
+        return len(self.vision)
+
+    @property
+    def friendly_ids(self) -> List[int]:
+        return sorted(self.initial_frame.friendly_robots)
+
+
+class NullRobotController(AbstractRobotController):
+    """Keeps the last tick's commands instead of sending them anywhere."""
+
+    def __init__(self, is_team_yellow: bool, n_friendly: int):
+        super().__init__(is_team_yellow, n_friendly)
+        self.commands: Dict[int, RobotCommand] = {}
+
+    def add_robot_commands(self, robot_commands, robot_id=None) -> None:
+        super().add_robot_commands(robot_commands, robot_id)
+
+    def _add_robot_command(self, command: RobotCommand, robot_id: int) -> None:
+        self.commands[robot_id] = command
+
+    def send_robot_commands(self) -> None:
+        self.commands.clear()
+
+    def get_robots_responses(self) -> Optional[List[RobotResponse]]:
+        return None
+
+
+### Datasets ###
+
+
+def _synthetic_ball(ts: float, t0: float) -> RawBallData:
+    t = ts - t0
+    return RawBallData(3.0 * math.sin(0.4 * t), 2.0 * math.sin(0.7 * t), 0.0, 0.9)
+
+
+def load_csv(name: str, path: Path) -> Dataset:
+    """One RawVisionData per timestamp; the blue team mirrors the yellow team through the centre spot."""
+    with open(path, newline="") as f:
+        rows = list(csv.DictReader(f))
+    t0 = float(rows[0]["ts"])
+    vision = []
+    for ts, group in groupby(rows, key=lambda row: float(row["ts"])):
+        yellow, blue = [], []
+        for row in group:
+            x, y, orientation = float(row["x"]), float(row["y"]), float(row["orientation"])
+            yellow.append(RawRobotData(int(row["id"]), x, y, orientation, 1.0))
+            blue.append(RawRobotData(int(row["id"]), -x, -y, math.remainder(orientation + math.pi, math.tau), 1.0))
+        vision.append(RawVisionData(ts, yellow, blue, [_synthetic_ball(ts, t0)], 0))
+    return Dataset(name, vision, my_team_is_yellow=True, my_team_is_right=True)
+
+
+def load_replay(path: Path) -> Dataset:
+    """Turns the recorded (already refined) frames back into single-camera raw vision."""
+    from utama_core.replay.replay_player import open_replay
+
+    metadata, frames = open_replay(path)
+    vision = []
+    for frame in frames:
+        friendly = [RawRobotData(r.id, r.p.x, r.p.y, r.orientation, 1.0) for r in frame.friendly_robots.values()]
+        enemy = [RawRobotData(r.id, r.p.x, r.p.y, r.orientation, 1.0) for r in frame.enemy_robots.values()]
+        yellow, blue = (friendly, enemy) if frame.my_team_is_yellow else (enemy, friendly)
+        balls = [RawBallData(frame.ball.p.x, frame.ball.p.y, frame.ball.p.z, 1.0)] if frame.ball else []
+        vision.append(RawVisionData(frame.ts, yellow, blue, balls, 0))
+    if not vision:
+        raise ValueError(f"Replay {path} has no frames.")
+    return Dataset(path.stem, vision, metadata.my_team_is_yellow, frames[0].my_team_is_right)
+
+
+def load_dataset(name: str) -> Dataset:
+    if name in DATASETS:
+        return load_csv(name, DATASETS[name])
+    return load_replay(Path(name))
+
+
+def _frame_from_vision(vision: RawVisionData, my_team_is_yellow: bool, my_team_is_right: bool) -> GameFrame:
+    zv, zv3 = Vector2D(0, 0), Vector3D(0, 0, 0)
+
+    def robots(raw: List[RawRobotData], is_friendly: bool) -> Dict[int, Robot]:
+        return {r.id: Robot(r.id, is_friendly, False, Vector2D(r.x, r.y), zv, zv, r.orientation) for r in raw}
+
+    yellow, blue = robots(vision.yellow_robots, my_team_is_yellow), robots(vision.blue_robots, not my_team_is_yellow)
+    ball = Ball(Vector3D(vision.balls[0].x, vision.balls[0].y, 0.0), zv3, zv3) if vision.balls else None
+    return GameFrame(
+        ts=vision.ts,
+        my_team_is_yellow=my_team_is_yellow,
+        my_team_is_right=my_team_is_right,
+        friendly_robots=yellow if my_team_is_yellow else blue,
+        enemy_robots=blue if my_team_is_yellow else yellow,
+        ball=ball,
+    )
+
+
+def _responses(dataset: Dataset, tick: int) -> List[RobotResponse]:
+    """A robot response every few ticks, as the real robots send them."""
+    ids = dataset.friendly_ids
+    if tick % 3 or not ids:
+        return []
+    return [RobotResponse(ids[tick % len(ids)], tick % 2 == 0)]
+
+
+def _refine_all(dataset: Dataset) -> List[GameFrame]:
+    position = PositionRefiner(STANDARD_FIELD_DIMS)
+    position.start_filtering()
+    velocity, robot_info, history = VelocityRefiner(), RobotInfoRefiner(), GameHistory(HISTORY_LENGTH)
+    frame = dataset.initial_frame
+    frames = []
+    for tick, vision in enumerate(dataset.vision):
+        frame = position.refine(frame, [vision])
+        frame = velocity.refine(history, frame)
+        frame = robot_info.refine(frame, _responses(dataset, tick))
+        history.add_game_frame(frame)
+        frames.append(frame)
+    return frames
+
+
+### Components ###
+
+
+def _field(dataset: Dataset) -> Field:
+    return Field(dataset.my_team_is_right, STANDARD_FIELD_DIMS, STANDARD_FIELD_DIMS.full_field_bounds)
+
+
+def _game(dataset: Dataset) -> Game:
+    return Game(GameHistory(HISTORY_LENGTH), dataset.initial_frame, field=_field(dataset))
+
+
+def refiners_chained(dataset: Dataset) -> Tick:
+    position = PositionRefiner(STANDARD_FIELD_DIMS)
+    position.start_filtering()
+    velocity, robot_info, history = VelocityRefiner(), RobotInfoRefiner(), GameHistory(HISTORY_LENGTH)
+    state = {"frame": dataset.initial_frame}
+
+    def tick(i: int):
+        frame = position.refine(state["frame"], [dataset.vision[i]])
+        frame = velocity.refine(history, frame)
+        frame = robot_info.refine(frame, _responses(dataset, i))
+        history.add_game_frame(frame)
+        state["frame"] = frame
+
+    return tick
+
+
+def refiners_in_place(dataset: Dataset) -> Tick:
+    position = PositionRefiner(STANDARD_FIELD_DIMS)
+    position.start_filtering()
+    velocity, robot_info, history = VelocityRefiner(), RobotInfoRefiner(), GameHistory(HISTORY_LENGTH)
+    workspace = FrameWorkspace(dataset.initial_frame)
+
+    def tick(i: int):
+        position.refine_into(workspace, [dataset.vision[i]])
+        velocity.refine_into(history, workspace)
+        robot_info.refine_into(workspace, _responses(dataset, i))
+        history.add_game_frame(workspace.snapshot())
+
+    return tick
+
+
+def proximity(dataset: Dataset) -> Tick:
+    def tick(i: int):
+        frame = dataset.frames[i]
+        lookup = ProximityLookup(frame.friendly_robots, frame.enemy_robots, frame.ball)
+        lookup.closest_to_ball(TeamType.FRIENDLY)
+        lookup.closest_to_ball(TeamType.ENEMY)
+        for robot_id in frame.friendly_robots:
+            lookup.k_nearest_to_robot(ObjectKey(TeamType.FRIENDLY, ObjectType.ROBOT, robot_id), 3, TeamType.ENEMY)
+        if frame.ball:
+            lookup.within_radius_of_point(frame.ball.p, 1.0)
+
+    return tick
+
+
+def motion(scheme: str) -> Callable[[Dataset], Tick]:
+    def build(dataset: Dataset) -> Tick:
+        controller = get_control_scheme(scheme)(Mode.GRSIM)
+        game = _game(dataset)
+
+        def tick(i: int):
+            frame = dataset.frames[i]
+            game.add_game_frame(frame)
+            target = frame.ball.p.to_2d() if frame.ball else Vector2D(0, 0)
+            for robot_id in frame.friendly_robots:
+                controller.calculate(game, robot_id, target, 0.0)
+
+        return tick
+
+    return build
+
+
+def _example_strategies(dataset: Dataset) -> Dict[str, Callable]:
+    from utama_core.strategy.examples import (
+        DefenceStrategy,
+        GoToBallExampleStrategy,
+        PointCycleStrategy,
+        RobotPlacementStrategy,
+        StartupStrategy,
+        TwoRobotPlacementStrategy,
+    )
+
+    ids = dataset.friendly_ids
+    return {
+        "StartupStrategy": StartupStrategy,
+        "DefenceStrategy": DefenceStrategy,
+        "GoToBallExampleStrategy": lambda: GoToBallExampleStrategy(ids[0]),
+        "RobotPlacementStrategy": lambda: RobotPlacementStrategy(ids[0]),
+        "TwoRobotPlacementStrategy": lambda: TwoRobotPlacementStrategy(ids[0], ids[-1]),
+        "PointCycleStrategy": lambda: PointCycleStrategy(
+            len(ids), STANDARD_FIELD_DIMS.full_field_bounds, endpoint_tolerance=0.1, seed=0
+        ),
+    }
+
+
+def strategy(name: str) -> Callable[[Dataset], Tick]:
+    def build(dataset: Dataset) -> Tick:
+        strat = _example_strategies(dataset)[name]()
+        strat.setup_strategy_blackboard(is_opp_strat=False)
+        strat.load_robot_controller(NullRobotController(dataset.my_team_is_yellow, len(dataset.friendly_ids)))
+        strat.load_motion_controller(get_control_scheme("pid")(Mode.GRSIM))
+        game = _game(dataset)
+        strat.load_game(game)
+        strat.setup_behaviour_tree(is_opp_strat=False)
+
+        def tick(i: int):
+            game.add_game_frame(dataset.frames[i])
+            strat.step()
+
+        return tick
+
+    return build
+
+
+STRATEGY_NAMES = (
+    "StartupStrategy",
+    "DefenceStrategy",
+    "GoToBallExampleStrategy",
+    "RobotPlacementStrategy",
+    "TwoRobotPlacementStrategy",
+    "PointCycleStrategy",
+)
+COMPONENTS: Dict[str, Callable[[Dataset], Tick]] = {
+    "refiners/chained": refiners_chained,
+    "refiners/in_place": refiners_in_place,
+    "proximity": proximity,
+    **{f"motion/{scheme}": motion(scheme) for scheme in CONTROL_SCHEME_MAP},
+    **{f"strategy/{name}": strategy(name) for name in STRATEGY_NAMES},
+}
+
+
+### Measurement ###
+
+
+def time_ticks(tick: Tick, ticks: range) -> List[int]:
+    durations = []
+    clock = time.perf_counter_ns
+    for i in ticks:
+        start = clock()
+        tick(i)
+        durations.append(clock() - start)
+    return durations
+
+
+def allocated_bytes(tick: Tick, ticks: range) -> float:
+    """Mean per-tick peak of memory allocated on top of what was live when the tick started."""
+    total = 0
+    tracemalloc.start()
+    try:
+        for i in ticks:
+            tracemalloc.reset_peak()
+            before = tracemalloc.get_traced_memory()[0]
+            tick(i)
+            total += tracemalloc.get_traced_memory()[1] - before
+    finally:
+        tracemalloc.stop()
+    return total / max(len(ticks), 1)
+
+
+def measure(build: Callable[[Dataset], Tick], dataset: Dataset, ticks: int, warmup: int) -> Dict[str, float]:
+    """Times ``ticks`` ticks after ``warmup`` ticks, then replays the same ticks from scratch for allocations."""
+    n = min(warmup + ticks, len(dataset))
+    warmup = min(warmup, n - 1)
+    measured = range(warmup, n)
+
+    tick = build(dataset)
+    for i in range(warmup):
+        tick(i)
+    durations = sorted(time_ticks(tick, measured))
+
+    tick = build(dataset)
+    for i in range(warmup):
+        tick(i)
+    alloc = allocated_bytes(tick, measured)
+
+    return {
+        "ns_per_tick": statistics.median(durations),
+        "p99_ns_per_tick": durations[min(len(durations) - 1, int(len(durations) * 0.99))],
+        "alloc_bytes_per_tick": alloc,
+    }
+
+
+### Baselines ###
+
+
+def check(
+    results: Dict[str, Dict[str, float]],
+    baseline: Dict[str, Dict[str, float]],
+    time_tolerance: float,
+    alloc_tolerance: float,
+) -> List[str]:
+    """Regressions of ``results`` against ``baseline``; components missing from either side are skipped."""
+    failures = []
+    for name, result in results.items():
+        base = baseline.get(name)
+        if base is None:
+            continue
+        ns, base_ns = result["ns_per_tick"], base["ns_per_tick"]
+        if ns > base_ns * (1 + time_tolerance) and ns - base_ns > MIN_NS:
+            failures.append(f"{name}: {ns / 1e3:.1f} us/tick vs baseline {base_ns / 1e3:.1f} us/tick")
+        alloc, base_alloc = result["alloc_bytes_per_tick"], base["alloc_bytes_per_tick"]
+        if alloc > base_alloc * (1 + alloc_tolerance) and alloc - base_alloc > MIN_BYTES:
+            failures.append(f"{name}: {alloc:.0f} B/tick allocated vs baseline {base_alloc:.0f} B/tick")
+    return failures
+
+
+def read_baseline(path: Path, dataset: str) -> Optional[Dict[str, Dict[str, float]]]:
+    if not path.exists():
+        return None
+    with open(path) as f:
+        return json.load(f).get(dataset)
+
+
+def write_baseline(path: Path, dataset: str, results: Dict[str, Dict[str, float]]):
+    data = json.loads(path.read_text()) if path.exists() else {}
+    data[dataset] = results
+    path.parent.mkdir(parents=True, exist_ok=True)
+    path.write_text(json.dumps(data, indent=2, sort_keys=True) + "\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--dataset", default="noisy", help="'clean', 'noisy' or the path of a replay file")
+    parser.add_argument("--ticks", type=int, default=600, help="measured ticks per component")
+    parser.add_argument("--warmup", type=int, default=60, help="ticks run before measuring")
+    parser.add_argument("--only", default="", help="only run components whose name contains this")
+    parser.add_argument("--baseline", type=Path, default=DEFAULT_BASELINE, help="baseline JSON file")
+    parser.add_argument("--time-tolerance", type=float, default=0.25, help="allowed relative slowdown")
+    parser.add_argument("--alloc-tolerance", type=float, default=0.10, help="allowed relative allocation growth")
+    mode = parser.add_mutually_exclusive_group()
+    mode.add_argument("--check", action="store_true", help="fail on regressions against the baseline")
+    mode.add_argument("--update-baseline", action="store_true", help="store these results as the baseline")
+    args = parser.parse_args()
+
+    dataset = load_dataset(args.dataset)
+    baseline = read_baseline(args.baseline, dataset.name) or {}
+    if args.check and not baseline:
+        print(f"No baseline for dataset {dataset.name!r} in {args.baseline}; record one with --update-baseline.")
+        sys.exit(2)
+
+    results: Dict[str, Dict[str, float]] = {}
+    print(f"dataset {dataset.name}: {len(dataset)} ticks")
+    print(f"{'component':<36} {'us/tick':>10} {'p99 us':>10} {'B/tick':>10} {'vs base':>8}")
+    for name, build in COMPONENTS.items():
+        if args.only not in name:
+            continue
+        result = measure(build, dataset, args.ticks, args.warmup)
+        results[name] = result
+        base = baseline.get(name)
+        ratio = f"{result['ns_per_tick'] / base['ns_per_tick']:>7.2f}x" if base else f"{'-':>8}"
+        print(
+            f"{name:<36} {result['ns_per_tick'] / 1e3:>10.1f} {result['p99_ns_per_tick'] / 1e3:>10.1f}"
+            f" {result['alloc_bytes_per_tick']:>10.0f} {ratio}"
+        )
+
+    if args.update_baseline:
+        write_baseline(args.baseline, dataset.name, results)
+        print(f"Baseline for {dataset.name!r} written to {args.baseline}")
+    elif args.check:
+        failures = check(results, baseline, args.time_tolerance, args.alloc_tolerance)
+        for failure in failures:
+            print(f"REGRESSION {failure}")
+        if failures:
+            sys.exit(1)
+        print("No regressions.")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,153 @@
+"""Micro-benchmark: per-call cost of the 2D geometry primitives before and after geometry_kernels.
+
+"numpy" is the previous implementation on 2-element arrays (kept here as reference), "kernel" is the current
+public function in math_utils / planning.geometry, which converts to floats and calls the compiled (or, without
+numba, pure-Python) kernel. The batched rows time one call over many inputs against a Python loop of scalar calls.
+
+Usage:
+    python -m benchmarks.bench_geometry_kernels [--repeats N] [--batch K]
+"""
+
+import argparse
+import timeit
+
+import numpy as np
+
+from utama_core.global_utils import geometry_kernels, math_utils
+from utama_core.motion_planning.src.planning import geometry
+
+EPS = 1e-9
+
+
+def numpy_point_segment_distance(point, start, end):
+    segment = end - start
+    denom = np.dot(segment, segment)
+    if denom < EPS:
+        diff = point - start
+        return np.sqrt(np.dot(diff, diff))
+    t = np.clip(np.dot(point - start, segment) / denom, 0.0, 1.0)
+    diff = point - (start + float(t) * segment)
+    return np.sqrt(np.dot(diff, diff))
+
+
+def _orientation(a, b, c):
+    return float((b[0] - a[0]) * (c[1] - a[1]) - (b[1] - a[1]) * (c[0] - a[0]))
+
+
+def _on_segment(a, b, c):
+    return (
+        min(a[0], c[0]) - EPS <= b[0] <= max(a[0], c[0]) + EPS
+        and min(a[1], c[1]) - EPS <= b[1] <= max(a[1], c[1]) + EPS
+    )
+
+
+def numpy_segments_intersect(p1, q1, p2, q2):
+    o1, o2 = _orientation(p1, q1, p2), _orientation(p1, q1, q2)
+    o3, o4 = _orientation(p2, q2, p1), _orientation(p2, q2, q1)
+    if (o1 > 0 and o2 < 0 or o1 < 0 and o2 > 0) and (o3 > 0 and o4 < 0 or o3 < 0 and o4 > 0):
+        return True
+    return (
+        (abs(o1) <= EPS and _on_segment(p1, p2, q1))
+        or (abs(o2) <= EPS and _on_segment(p1, q2, q1))
+        or (abs(o3) <= EPS and _on_segment(p2, p1, q2))
+        or (abs(o4) <= EPS and _on_segment(p2, q1, q2))
+    )
+
+
+def numpy_segment_to_segment_distance(a1, a2, b1, b2):
+    if numpy_segments_intersect(a1, a2, b1, b2):
+        return 0.0
+    return min(
+        numpy_point_segment_distance(a1, b1, b2),
+        numpy_point_segment_distance(a2, b1, b2),
+        numpy_point_segment_distance(b1, a1, a2),
+        numpy_point_segment_distance(b2, a1, a2),
+    )
+
+
+def numpy_rect_distance_to_segment(rect, start, end):
+    if rect.contains_array(start) or rect.contains_array(end):
+        return 0.0
+    corners = list(rect.corners())
+    distances = [rect.distance_to_boundary_array(start), rect.distance_to_boundary_array(end)]
+    for i in range(4):
+        distances.append(numpy_segment_to_segment_distance(start, end, corners[i], corners[(i + 1) % 4]))
+    return min(distances)
+
+
+def per_call_us(func, repeats):
+    return min(timeit.repeat(func, number=repeats, repeat=3)) / repeats * 1e6
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--repeats", type=int, default=20000, help="calls per scalar measurement")
+    parser.add_argument("--batch", type=int, default=64, help="inputs per batched call")
+    args = parser.parse_args()
+
+    rng = np.random.default_rng(0)
+    p, a, b, c, d = rng.uniform(-3, 3, size=(5, 2))
+    rect = geometry.AxisAlignedRectangle(-0.5, 0.5, -0.2, 0.3)
+
+    # Warm up the JIT so compilation is not timed.
+    math_utils.distance_point_to_segment(p, a, b)
+    geometry.segment_to_segment_distance(a, b, c, d)
+    rect.distance_to_segment(a, b)
+
+    cases = [
+        (
+            "point_segment_distance",
+            lambda: numpy_point_segment_distance(p, a, b),
+            lambda: geometry.point_segment_distance(p, a, b),
+        ),
+        (
+            "segments_intersect",
+            lambda: numpy_segments_intersect(a, b, c, d),
+            lambda: geometry.segments_intersect(a, b, c, d),
+        ),
+        (
+            "segment_to_segment_distance",
+            lambda: numpy_segment_to_segment_distance(a, b, c, d),
+            lambda: geometry.segment_to_segment_distance(a, b, c, d),
+        ),
+        (
+            "rect.distance_to_segment",
+            lambda: numpy_rect_distance_to_segment(rect, a, b),
+            lambda: rect.distance_to_segment(a, b),
+        ),
+    ]
+
+    print(f"numba available: {geometry_kernels.HAVE_NUMBA}")
+    print(f"{'primitive':>30} {'numpy (us)':>12} {'kernel (us)':>12} {'speedup':>8}")
+    for name, before, after in cases:
+        t_before, t_after = per_call_us(before, args.repeats), per_call_us(after, args.repeats)
+        print(f"{name:>30} {t_before:>12.2f} {t_after:>12.2f} {t_before / t_after:>7.1f}x")
+
+    points = rng.uniform(-3, 3, size=(args.batch, 2))
+    starts, ends = rng.uniform(-3, 3, size=(2, args.batch, 2))
+    rects = np.array([[-0.5, 0.5, -0.2, 0.3], [1.0, 1.5, 1.0, 2.0], [-2.0, -1.0, 0.5, 1.5]])
+    rect_objs = [geometry.AxisAlignedRectangle(*r) for r in rects]
+    geometry_kernels.points_to_segment_distance(points, a, b)
+    geometry_kernels.rects_to_segments_distance(rects, starts, ends)
+
+    repeats = max(1, args.repeats // args.batch)
+    batched = [
+        (
+            f"points_to_segment x{args.batch}",
+            lambda: [geometry.point_segment_distance(q, a, b) for q in points],
+            lambda: geometry_kernels.points_to_segment_distance(points, a, b),
+        ),
+        (
+            f"rects_to_segments {args.batch}x{len(rects)}",
+            lambda: [[r.distance_to_segment(s, e) for r in rect_objs] for s, e in zip(starts, ends)],
+            lambda: geometry_kernels.rects_to_segments_distance(rects, starts, ends),
+        ),
+    ]
+    print(f"\n{'batched':>30} {'loop (us)':>12} {'batched (us)':>12} {'speedup':>8}")
+    for name, loop, vectorised in batched:
+        t_loop, t_batched = per_call_us(loop, repeats), per_call_us(vectorised, repeats)
+        print(f"{name:>30} {t_loop:>12.2f} {t_batched:>12.2f} {t_loop / t_batched:>7.1f}x")
+
+
+if __name__ == "__main__":
+    main()
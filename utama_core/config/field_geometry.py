@@ -0,0 +1,196 @@
+"""Precomputed field geometry shared by skills and referee rules.
+
+A FieldGeometry is built once per set of field measurements (see ``field_geometry``) and holds:
+
+- the field, goal and defense areas as axis-aligned rectangles ``(min_x, max_x, min_y, max_y)`` and corner polygons,
+  so membership tests are plain comparisons against stored bounds;
+- a signed-distance grid (negative inside) to the field boundary.
+
+The grid is built on the first query that reads it (or by ``precompute``), so code that only tests membership
+never pays for it. Grid queries interpolate bilinearly and are exact wherever the underlying distance is linear
+across a cell (everywhere except within one cell of a corner). Points off the grid fall back to the analytic function
+the grid is built from. Every query accepts either scalars or (n, 2) point arrays.
+"""
+
+import math
+from functools import cached_property, lru_cache
+from typing import Tuple
+
+import numpy as np
+
+Rect = Tuple[float, float, float, float]
+
+DEFAULT_RESOLUTION = 0.05  # metres per grid cell
+GRID_MARGIN = 0.5  # metres of grid beyond the field lines on every side
+
+
+def rect_signed_distance(x, y, rect: Rect):
+    """Signed distance from (x, y) to the boundary of ``rect``: negative inside, positive outside."""
+    min_x, max_x, min_y, max_y = rect
+    cx, cy = (min_x + max_x) / 2, (min_y + max_y) / 2
+    dx = np.abs(np.asarray(x, dtype=float) - cx) - (max_x - min_x) / 2
+    dy = np.abs(np.asarray(y, dtype=float) - cy) - (max_y - min_y) / 2
+    outside = np.hypot(np.maximum(dx, 0.0), np.maximum(dy, 0.0))
+    inside = np.minimum(np.maximum(dx, dy), 0.0)
+    return outside + inside
+
+
+def _in_rect(x, y, rect: Rect):
+    min_x, max_x, min_y, max_y = rect
+    return (min_x <= x) & (x <= max_x) & (min_y <= y) & (y <= max_y)
+
+
+def _split(points_or_x, y):
+    if y is None:
+        points = np.asarray(points_or_x, dtype=float).reshape(-1, 2)
+        return points[:, 0], points[:, 1]
+    return points_or_x, y
+
+
+class FieldGeometry:
+    """Field shapes and lookup tables for one set of field measurements.
+
+    Build through ``field_geometry`` (or ``Field.geometry`` / ``RefereeGeometry.lookup``) so every consumer of the
+    same field shares one instance. Membership queries compare against the stored rectangles and match the
+    inclusive boundaries of RefereeGeometry; the boundary distance query reads a grid that is built on first use.
+    """
+
+    def __init__(
+        self,
+        half_length: float,
+        half_width: float,
+        half_goal_width: float,
+        half_defense_depth: float,
+        half_defense_width: float,
+        goal_depth: float,
+        resolution: float = DEFAULT_RESOLUTION,
+    ):
+        self.half_length = half_length
+        self.half_width = half_width
+        self.half_goal_width = half_goal_width
+        self.goal_depth = goal_depth
+        self.resolution = resolution
+
+        L, W, G = half_length, half_width, half_goal_width
+        defense_depth, DW = 2 * half_defense_depth, half_defense_width
+        self.field_rect: Rect = (-L, L, -W, W)
+        self.left_defense_rect: Rect = (-L, -L + defense_depth, -DW, DW)
+        self.right_defense_rect: Rect = (L - defense_depth, L, -DW, DW)
+        self.left_goal_rect: Rect = (-L - goal_depth, -L, -G, G)
+        self.right_goal_rect: Rect = (L, L + goal_depth, -G, G)
+        # Membership zones for the rules: like RefereeGeometry, a robot behind its goal line counts as inside.
+        self.left_defense_zone: Rect = (-math.inf, -L + defense_depth, -DW, DW)
+        self.right_defense_zone: Rect = (L - defense_depth, math.inf, -DW, DW)
+
+        self.field_polygon = self._polygon(self.field_rect)
+        self.left_defense_polygon = self._polygon(self.left_defense_rect)
+        self.right_defense_polygon = self._polygon(self.right_defense_rect)
+
+        self.xs = np.arange(-L - GRID_MARGIN, L + GRID_MARGIN + resolution / 2, resolution)
+        self.ys = np.arange(-W - GRID_MARGIN, W + GRID_MARGIN + resolution / 2, resolution)
+
+    @staticmethod
+    def _polygon(rect: Rect) -> np.ndarray:
+        min_x, max_x, min_y, max_y = rect
+        return np.array([(max_x, max_y), (min_x, max_y), (min_x, min_y), (max_x, min_y)])
+
+    # ------------------------------------------------------------------
+    # Membership
+    # ------------------------------------------------------------------
+
+    def defense_rect(self, right: bool) -> Rect:
+        return self.right_defense_rect if right else self.left_defense_rect
+
+    def defense_zone(self, right: bool) -> Rect:
+        return self.right_defense_zone if right else self.left_defense_zone
+
+    def goal_x(self, right: bool) -> float:
+        return self.half_length if right else -self.half_length
+
+    def in_field(self, x, y=None):
+        """True inside the playing field, boundary included."""
+        return _in_rect(*_split(x, y), self.field_rect)
+
+    def in_defense_area(self, x, y=None, *, right: bool):
+        """True inside the right (or left) defense area or behind it, boundary included."""
+        return _in_rect(*_split(x, y), self.defense_zone(right))
+
+    def in_goal(self, x, y=None, *, right: bool):
+        """True once past the goal line between the posts, as RefereeGeometry.is_in_*_goal."""
+        x, y = _split(x, y)
+        if right:
+            return (x > self.half_length) & (np.abs(y) < self.half_goal_width)
+        return (x < -self.half_length) & (np.abs(y) < self.half_goal_width)
+
+    def count_in_defense_area(self, points, *, right: bool) -> int:
+        """Number of (n, 2) points inside the right (or left) defense area."""
+        return int(np.count_nonzero(self.in_defense_area(points, right=right)))
+
+    # ------------------------------------------------------------------
+    # Lookup grid
+    # ------------------------------------------------------------------
+
+    @cached_property
+    def boundary_distance_grid(self) -> np.ndarray:
+        return rect_signed_distance(*np.meshgrid(self.xs, self.ys), self.field_rect)  # (ny, nx)
+
+    def precompute(self) -> None:
+        """Build the boundary distance grid now instead of on the first query that needs it."""
+        self.boundary_distance_grid
+
+    def _interpolate(self, grid: np.ndarray, x, y):
+        """Bilinear lookup; NaN for points outside the grid."""
+        x = np.asarray(x, dtype=float)
+        y = np.asarray(y, dtype=float)
+        fx = (x - self.xs[0]) / self.resolution
+        fy = (y - self.ys[0]) / self.resolution
+        on_grid = (fx >= 0) & (fx <= len(self.xs) - 1) & (fy >= 0) & (fy <= len(self.ys) - 1)
+        ix = np.clip(np.floor(np.where(on_grid, fx, 0.0)).astype(int), 0, len(self.xs) - 2)
+        iy = np.clip(np.floor(np.where(on_grid, fy, 0.0)).astype(int), 0, len(self.ys) - 2)
+        tx, ty = np.where(on_grid, fx - ix, 0.0), np.where(on_grid, fy - iy, 0.0)
+        value = (
+            grid[iy, ix] * (1 - tx) * (1 - ty)
+            + grid[iy, ix + 1] * tx * (1 - ty)
+            + grid[iy + 1, ix] * (1 - tx) * ty
+            + grid[iy + 1, ix + 1] * tx * ty
+        )
+        return np.where(on_grid, value, np.nan)
+
+    def _lookup(self, grid: np.ndarray, exact, x, y):
+        value = self._interpolate(grid, x, y)
+        off_grid = np.isnan(value)
+        if np.any(off_grid):
+            value = np.where(off_grid, exact(x, y), value)
+        return value if value.ndim else float(value)
+
+    def distance_to_boundary(self, x, y=None):
+        """Signed distance to the field lines: negative inside the field, positive outside."""
+        x, y = _split(x, y)
+        return self._lookup(self.boundary_distance_grid, lambda x, y: rect_signed_distance(x, y, self.field_rect), x, y)
+
+    # ------------------------------------------------------------------
+    # Placement
+    # ------------------------------------------------------------------
+
+    def nearest_infield_point(self, x: float, y: float, offset: float) -> Tuple[float, float]:
+        """Clamp (x, y) into the field; a coordinate that was outside is placed ``offset`` inside that line."""
+        L, W = self.half_length, self.half_width
+        px = math.copysign(L - offset, x) if abs(x) > L else x
+        py = math.copysign(W - offset, y) if abs(y) > W else y
+        return (px, py)
+
+
+@lru_cache(maxsize=8)
+def field_geometry(
+    half_length: float,
+    half_width: float,
+    half_goal_width: float,
+    half_defense_depth: float,
+    half_defense_width: float,
+    goal_depth: float,
+    resolution: float = DEFAULT_RESOLUTION,
+) -> FieldGeometry:
+    """Shared FieldGeometry for these measurements, built on the first call only."""
+    return FieldGeometry(
+        half_length, half_width, half_goal_width, half_defense_depth, half_defense_width, goal_depth, resolution
+    )
@@ -1,3 +1,6 @@
 ROBOT_RADIUS = 0.09
+ROBOT_HEIGHT = 0.15  # SSL maximum; balls above this fly over robots
 MAX_ROBOTS = 6
 BALL_RADIUS = 0.0215
+ROBOT_ID_SLOTS = 16  # SSL-Vision pattern ids are 0-15; used to size id-indexed arrays
+GRAVITY = 9.81  # m/s^2
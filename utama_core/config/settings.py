@@ -47,3 +47,14 @@ BALL_MERGE_THRESHOLD = 0.05  # CameraCombiner: distance threshold to merge balls
 VISION_BOUNDS_BUFFER = 1.0  # CameraCombiner: buffer around field bounds to include in vision (m)
 
 OFF_PITCH_OFFSET = VISION_BOUNDS_BUFFER * 5  # distance outside field bounds to consider as off-pitch (m)
+
+### Ball prediction ###
+BALL_ROLLING_DECELERATION = 0.4  # rolling friction of the ball on the carpet (m/s^2)
+BALL_CHIP_RESTITUTION = 0.5  # fraction of vertical speed a chipped ball keeps at each bounce
+BALL_CHIP_BOUNCE_XY_DAMPING = 0.75  # fraction of horizontal speed a chipped ball keeps at each bounce
+BALL_MIN_BOUNCE_SPEED = 0.3  # vertical speed below which a bounce ends the flight (m/s)
+BALL_AIRBORNE_HEIGHT = 0.05  # ball height above which it is treated as in flight (m)
+BALL_STATIONARY_SPEED = 0.05  # fitted ground speeds below this count as a ball at rest (m/s)
+BALL_FIT_POINTS = 6  # ball positions (current included) the velocity is fitted over
+BALL_PREDICTION_HORIZON = 4.0  # seconds of trajectory sampled each tick
+BALL_PREDICTION_DT = TIMESTEP  # trajectory sample spacing (s)
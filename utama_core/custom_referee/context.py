@@ -0,0 +1,141 @@
+"""RefereeContext: per-tick view of a GameFrame shared by the rules and the state machine."""
+
+from __future__ import annotations
+
+from enum import Enum, auto
+from functools import cached_property
+from typing import Dict, NamedTuple, Optional, Tuple
+
+import numpy as np
+
+from utama_core.custom_referee.geometry import RefereeGeometry
+from utama_core.entities.game.game_frame import GameFrame
+from utama_core.entities.referee.referee_command import RefereeCommand
+
+
+class BallZone(Enum):
+    """Where the ball is, as far as the rules are concerned."""
+
+    NONE = auto()  # no ball in the frame
+    IN_FIELD = auto()
+    LEFT_GOAL = auto()
+    RIGHT_GOAL = auto()
+    OUT = auto()  # outside the field and not in a goal
+
+
+class DefenseOccupancy(NamedTuple):
+    """Robot counts in each defense area, by colour."""
+
+    yellow_defenders: int  # yellow robots in the yellow defense area
+    blue_attackers: int  # blue robots in the yellow defense area
+    blue_defenders: int
+    yellow_attackers: int
+
+
+def _positions(robots) -> np.ndarray:
+    return np.array([(r.p.x, r.p.y) for r in robots.values()], dtype=float).reshape(-1, 2)
+
+
+class RefereeContext:
+    """Everything the referee derives from one GameFrame, computed at most once per tick.
+
+    CustomReferee builds one context per ``step`` and hands it to every rule and to the state machine, so
+    ball-zone classification, defense-area membership and robot-to-ball distances are each evaluated once,
+    over (n, 2) position arrays, however many rules read them. Each quantity is computed on first access.
+
+    Teams are addressed from the frame's perspective (``friendly=True/False``); ``yellow_is_friendly`` maps
+    colours onto that.
+    """
+
+    def __init__(
+        self,
+        game_frame: GameFrame,
+        geometry: Optional[RefereeGeometry],
+        command: RefereeCommand,
+    ) -> None:
+        self.frame = game_frame
+        self.geometry = geometry
+        self.command = command
+        self.yellow_is_friendly = game_frame.my_team_is_yellow
+        # True when yellow defends the right goal.
+        self.yellow_is_right = game_frame.my_team_is_right == game_frame.my_team_is_yellow
+        ball = game_frame.ball
+        self.ball_xy: Optional[Tuple[float, float]] = (ball.p.x, ball.p.y) if ball is not None else None
+        self._ball_distances: Dict[bool, np.ndarray] = {}
+
+    # ------------------------------------------------------------------
+    # Positions
+    # ------------------------------------------------------------------
+
+    @cached_property
+    def friendly_xy(self) -> np.ndarray:
+        return _positions(self.frame.friendly_robots)
+
+    @cached_property
+    def enemy_xy(self) -> np.ndarray:
+        return _positions(self.frame.enemy_robots)
+
+    def team_xy(self, friendly: bool) -> np.ndarray:
+        return self.friendly_xy if friendly else self.enemy_xy
+
+    # ------------------------------------------------------------------
+    # Ball
+    # ------------------------------------------------------------------
+
+    @cached_property
+    def ball_zone(self) -> BallZone:
+        if self.ball_xy is None:
+            return BallZone.NONE
+        bx, by = self.ball_xy
+        if self.geometry.is_in_field(bx, by):
+            return BallZone.IN_FIELD
+        if self.geometry.is_in_left_goal(bx, by):
+            return BallZone.LEFT_GOAL
+        if self.geometry.is_in_right_goal(bx, by):
+            return BallZone.RIGHT_GOAL
+        return BallZone.OUT
+
+    def ball_distances(self, friendly: bool) -> np.ndarray:
+        """Distance of each robot of the team to the ball, in frame dict order; empty without a ball."""
+        distances = self._ball_distances.get(friendly)
+        if distances is None:
+            xy = self.team_xy(friendly)
+            if self.ball_xy is None:
+                distances = np.empty(0)
+            else:
+                distances = np.hypot(xy[:, 0] - self.ball_xy[0], xy[:, 1] - self.ball_xy[1])
+            self._ball_distances[friendly] = distances
+        return distances
+
+    def closest_to_ball(self, friendly: Optional[bool] = None) -> float:
+        """Distance of the team's (or, with ``friendly=None``, any) robot closest to the ball; inf if none."""
+        teams = (True, False) if friendly is None else (friendly,)
+        return min((float(d.min()) for d in map(self.ball_distances, teams) if d.size), default=np.inf)
+
+    @cached_property
+    def closest_robot_to_ball(self) -> Tuple[Optional[bool], float]:
+        """(is_friendly, distance) of the robot closest to the ball; friendly robots win ties."""
+        friendly, enemy = self.closest_to_ball(True), self.closest_to_ball(False)
+        if friendly == enemy == np.inf:
+            return None, np.inf
+        return (True, friendly) if friendly <= enemy else (False, enemy)
+
+    # ------------------------------------------------------------------
+    # Zones
+    # ------------------------------------------------------------------
+
+    @cached_property
+    def defense_occupancy(self) -> DefenseOccupancy:
+        count = self.geometry.lookup.count_in_defense_area
+        yellow_xy, blue_xy = self.team_xy(self.yellow_is_friendly), self.team_xy(not self.yellow_is_friendly)
+        return DefenseOccupancy(
+            yellow_defenders=count(yellow_xy, right=self.yellow_is_right),
+            blue_attackers=count(blue_xy, right=self.yellow_is_right),
+            blue_defenders=count(blue_xy, right=not self.yellow_is_right),
+            yellow_attackers=count(yellow_xy, right=not self.yellow_is_right),
+        )
+
+    def count_within(self, friendly: bool, x: float, y: float, radius: float) -> int:
+        """Robots of the team within ``radius`` (inclusive) of (x, y)."""
+        xy = self.team_xy(friendly)
+        return int(np.count_nonzero(np.hypot(xy[:, 0] - x, xy[:, 1] - y) <= radius))
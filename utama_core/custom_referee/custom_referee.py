@@ -2,9 +2,10 @@
 
 from __future__ import annotations
 
-from typing import List, Optional
+from typing import Dict, Hashable, List, Optional, Tuple
 
 from utama_core.config.field_params import STANDARD_FIELD_DIMS
+from utama_core.custom_referee.context import RefereeContext
 from utama_core.custom_referee.geometry import RefereeGeometry
 from utama_core.custom_referee.profiles.profile_loader import (
     RefereeProfile,
@@ -66,6 +67,14 @@ class CustomReferee:
     is created, pass ``enable_gui=True``::
 
         referee = CustomReferee(profile, enable_gui=True, gui_port=8080)
+
+    The GUI is updated at ``gui_rate_hz`` however often
+    ``step`` is called; ``step`` itself only hands the GUI the new state.
+
+    With ``incremental=True`` a rule is only evaluated again when its ``input_key`` (ball zone, defense-area
+    occupancy, touch evidence, command, ...) differs from the previous evaluation; otherwise its previous result
+    is reused. Results are identical either way, so this suits batch simulations that step the referee every
+    tick of many games.
     """
 
     def __init__(
@@ -75,12 +84,17 @@ class CustomReferee:
         n_robots_blue: int = 3,
         enable_gui: bool = False,
         gui_port: int = 8080,
+        incremental: bool = False,
+        gui_rate_hz: float = 20.0,
     ) -> None:
         self._profile_name = profile.profile_name
         self._geometry: RefereeGeometry = RefereeGeometry.from_field_dims(
             STANDARD_FIELD_DIMS
         )  # this is overrriden by StrategyRunner
         self._rules: List[BaseRule] = _build_active_rules(profile.rules)
+        self._incremental = incremental
+        # rule index -> (input key, result) of the rule's last evaluation, for incremental mode
+        self._last_results: Dict[int, Tuple[Hashable, Optional[RuleViolation]]] = {}
         self._state = GameStateMachine(
             half_duration_seconds=profile.game.half_duration_seconds,
             kickoff_team=profile.game.kickoff_team,
@@ -99,7 +113,9 @@ class CustomReferee:
             # when the GUI is not needed.
             from utama_core.custom_referee.gui import _RefereeGUIServer
 
-            self._gui_server = _RefereeGUIServer(self, profile, gui_port, run_tick_loop=False)
+            self._gui_server = _RefereeGUIServer(
+                self, profile, gui_port, run_tick_loop=False, display_rate_hz=gui_rate_hz
+            )
             self._gui_server.start()
             print(f"Referee GUI  →  http://localhost:{gui_port}")
             print(f"Profile:        {profile.profile_name}")
@@ -112,6 +128,8 @@ class CustomReferee:
         n_robots_blue: int = 3,
         enable_gui: bool = False,
         gui_port: int = 8080,
+        incremental: bool = False,
+        gui_rate_hz: float = 20.0,
     ) -> "CustomReferee":
         """Convenience constructor: load profile by built-in name or file path."""
         profile = load_profile(name)
@@ -121,6 +139,8 @@ class CustomReferee:
             n_robots_blue=n_robots_blue,
             enable_gui=enable_gui,
             gui_port=gui_port,
+            incremental=incremental,
+            gui_rate_hz=gui_rate_hz,
         )
 
     # ------------------------------------------------------------------
@@ -131,27 +151,45 @@ class CustomReferee:
         """Evaluate all rules and advance the state machine by one tick.
 
         First matching rule (in priority order) wins; subsequent rules are
-        not evaluated.
+        not evaluated. The rules and the state machine share one RefereeContext
+        for the frame.
         """
+        context = RefereeContext(game_frame, self._geometry, self._state.command)
         violation: Optional[RuleViolation] = None
-        for rule in self._rules:
-            result = rule.check(game_frame, self._geometry, self._state.command)
+        for index, rule in enumerate(self._rules):
+            result = self._evaluate(index, rule, context)
             if result is not None:
                 violation = result
                 break
 
         previous_command = self._state.command
-        result = self._state.step(current_time, violation, game_frame)
+        result = self._state.step(current_time, violation, game_frame, context)
 
         # Notify rules only when the command actually changed (not when the
         # state machine ignored the violation due to the transition cooldown).
         if self._state.command != previous_command:
             for rule in self._rules:
                 rule.reset()
+            self._last_results.clear()
         if self._gui_server is not None:
             self._gui_server.notify(result, game_frame)
         return result
 
+    def _evaluate(self, index: int, rule: BaseRule, context: RefereeContext) -> Optional[RuleViolation]:
+        if not self._incremental:
+            return rule.evaluate(context)
+        key = rule.input_key(context)
+        if key is not None:
+            last = self._last_results.get(index)
+            if last is not None and last[0] == key:
+                return last[1]
+        result = rule.evaluate(context)
+        if key is None:
+            self._last_results.pop(index, None)
+        else:
+            self._last_results[index] = (key, result)
+        return result
+
     def seed_clock(self, timestamp: float, initial_command: RefereeCommand = RefereeCommand.HALT) -> None:
         """Align all internal state-machine timers to *timestamp* and apply
         *initial_command*.
@@ -182,6 +220,7 @@ class CustomReferee:
         """
         self._geometry = geometry
         self._state._geometry = geometry
+        self._last_results.clear()
 
     @property
     def geometry(self) -> RefereeGeometry:
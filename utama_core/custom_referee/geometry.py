@@ -1,7 +1,9 @@
 """RefereeGeometry: configurable field dimensions for the CustomReferee."""
 
 from dataclasses import dataclass
+from functools import cached_property
 
+from utama_core.config.field_geometry import FieldGeometry, field_geometry
 from utama_core.config.field_params import FieldBounds, FieldDimensions
 
 
@@ -38,6 +40,18 @@ class RefereeGeometry:
             goal_depth=field_dims.goal_depth,
         )
 
+    @cached_property
+    def lookup(self) -> FieldGeometry:
+        """Precomputed rectangles and distance/angle tables for this geometry, built on first use."""
+        return field_geometry(
+            self.half_length,
+            self.half_width,
+            self.half_goal_width,
+            self.half_defense_depth,
+            self.half_defense_width,
+            self.goal_depth,
+        )
+
     # ------------------------------------------------------------------
     # Spatial query helpers
     # ------------------------------------------------------------------
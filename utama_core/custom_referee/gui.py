@@ -10,7 +10,12 @@ Or use the convenience flag on CustomReferee:
     referee = CustomReferee(profile, enable_gui=True, gui_port=8080)
 
 Serves a single-page HTML GUI over a stdlib HTTP server.
-State is pushed via SSE (~30 Hz); commands come back via POST /command.
+State is pushed via SSE at the display rate (default 20 Hz), independent of
+how often ``referee.step()`` runs; commands come back via POST /command.
+``notify`` only stores the latest snapshot, so the control loop never waits on
+serialisation or sockets.  A publisher thread samples that snapshot, quantises
+positions and sends each client only the fields that changed since its last
+message (a full state first, then deltas).
 The active profile's configuration (geometry + rules + game settings) is
 available at GET /config and displayed in a read-only panel on the page.
 
@@ -23,7 +28,7 @@ import json
 import threading
 import time
 from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
-from typing import TYPE_CHECKING, List, Optional
+from typing import TYPE_CHECKING, Dict, Optional
 
 if TYPE_CHECKING:
     from utama_core.custom_referee import CustomReferee
@@ -34,6 +39,11 @@ from utama_core.entities.game.ball import Ball
 from utama_core.entities.game.game_frame import GameFrame
 from utama_core.entities.referee.referee_command import RefereeCommand
 
+DEFAULT_DISPLAY_RATE_HZ = 20.0
+_POSITION_DECIMALS = 2  # positions are sent to the nearest cm
+_ORIENTATION_DECIMALS = 2  # radians
+_TIME_DECIMALS = 1  # seconds
+
 # ---------------------------------------------------------------------------
 # Public API
 # ---------------------------------------------------------------------------
@@ -45,6 +55,7 @@ def attach_gui(
     port: int = 8080,
     *,
     run_tick_loop: bool = False,
+    display_rate_hz: float = DEFAULT_DISPLAY_RATE_HZ,
 ) -> None:
     """Attach the web GUI to an existing CustomReferee instance.
 
@@ -62,8 +73,10 @@ def attach_gui(
                        this when you have *no* external game loop (standalone
                        operator-panel mode).  Leave False when your own loop
                        drives ``referee.step()``.
+        display_rate_hz: How often state is pushed to the browsers, however
+                       often the referee is stepped.  Must be positive.
     """
-    server = _RefereeGUIServer(referee, profile, port, run_tick_loop=run_tick_loop)
+    server = _RefereeGUIServer(referee, profile, port, run_tick_loop=run_tick_loop, display_rate_hz=display_rate_hz)
     server.start()
     print(f"Referee GUI  →  http://localhost:{port}")
     print(f"Profile:        {profile.profile_name}")
@@ -75,7 +88,7 @@ def attach_gui(
 
 
 class _RefereeGUIServer(threading.Thread):
-    """HTTP server + optional tick loop, all in daemon threads."""
+    """HTTP server + state publisher + optional tick loop, all in daemon threads."""
 
     def __init__(
         self,
@@ -84,17 +97,24 @@ class _RefereeGUIServer(threading.Thread):
         port: int,
         *,
         run_tick_loop: bool,
+        display_rate_hz: float = DEFAULT_DISPLAY_RATE_HZ,
     ) -> None:
+        if display_rate_hz <= 0:
+            raise ValueError(f"display_rate_hz must be positive, got {display_rate_hz}")
         super().__init__(daemon=True, name="RefereeGUIServer")
         self._referee = referee
         self._port = port
         self._run_tick_loop = run_tick_loop
+        self._display_period = 1.0 / display_rate_hz
         self._static_config = _build_static_config(profile)
 
         self._lock = threading.Lock()
-        self._ref_data = None
-        self._game_frame = None  # Optional[GameFrame]
-        self._sse_clients: List = []
+        # Latest (RefereeData, Optional[GameFrame]) from notify; replaced as a whole, never mutated.
+        self._latest = None
+        self._published = None  # the snapshot _last_state was built from
+        self._last_state: Optional[dict] = None
+        # wfile -> True until the client has been sent a full state
+        self._sse_clients: Dict = {}
         self._sse_lock = threading.Lock()
 
     # ---- threading.Thread entry point ----
@@ -102,6 +122,7 @@ class _RefereeGUIServer(threading.Thread):
     def run(self) -> None:
         if self._run_tick_loop:
             threading.Thread(target=self._tick_loop, daemon=True, name="RefereeGUITick").start()
+        threading.Thread(target=self._publish_loop, daemon=True, name="RefereeGUIPublish").start()
 
         handler_factory = self._make_handler_class()
         server = ThreadingHTTPServer(("", self._port), handler_factory)
@@ -116,10 +137,7 @@ class _RefereeGUIServer(threading.Thread):
         frame = _make_static_frame()
         while True:
             result = self._referee.step(frame, time.time())
-            with self._lock:
-                self._ref_data = result
-                self._game_frame = frame
-            self._broadcast()
+            self.notify(result, frame)
             time.sleep(1 / 30)
 
     def _build_config_json(self) -> str:
@@ -139,28 +157,60 @@ class _RefereeGUIServer(threading.Thread):
     # ---- called by external loops to push a new state snapshot ----
 
     def notify(self, ref_data, game_frame=None) -> None:
-        """Push a RefereeData snapshot from an external game loop."""
-        with self._lock:
-            self._ref_data = ref_data
-            self._game_frame = game_frame
-        self._broadcast()
-
-    # ---- SSE broadcast ----
+        """Push a RefereeData snapshot from an external game loop.
 
-    def _broadcast(self) -> None:
-        with self._lock:
-            data = self._ref_data
-            frame = self._game_frame
-        if data is None:
-            return
+        Called every tick from ``CustomReferee.step``: it only swaps in the new
+        snapshot; the publisher thread serialises and sends it.
+        """
+        self._latest = (ref_data, game_frame)
 
-        payload = ("data: " + _serialise_state(data, frame) + "\n\n").encode()
-        dead: List = []
+    # ---- SSE publishing ----
 
+    def _publish_loop(self) -> None:
+        next_publish = time.monotonic()
+        while True:
+            next_publish += self._display_period
+            self._publish()
+            delay = next_publish - time.monotonic()
+            if delay > 0:
+                time.sleep(delay)
+            else:
+                next_publish = time.monotonic()  # fell behind: don't try to catch up with a burst
+
+    def _publish(self) -> None:
+        """Send the latest snapshot: the full state to new clients, the changed fields to the others."""
         with self._sse_lock:
-            clients = list(self._sse_clients)
-
-        for wfile in clients:
+            if not self._sse_clients:
+                return
+            latest = self._latest
+            if latest is None:
+                return
+            if latest is not self._published:
+                state = _state_dict(*latest)
+                delta = _state_delta(self._last_state, state)
+                self._last_state = state
+                self._published = latest
+            else:
+                delta = {}
+            clients = list(self._sse_clients.items())
+            for wfile, needs_full in clients:
+                if needs_full:
+                    self._sse_clients[wfile] = False
+            state = self._last_state
+
+        full_payload = delta_payload = None
+        dead = []
+        for wfile, needs_full in clients:
+            if needs_full:
+                if full_payload is None:
+                    full_payload = _sse_message(dict(state, full=True))
+                payload = full_payload
+            elif delta:
+                if delta_payload is None:
+                    delta_payload = _sse_message(delta)
+                payload = delta_payload
+            else:
+                continue
             try:
                 wfile.write(payload)
                 wfile.flush()
@@ -170,8 +220,7 @@ class _RefereeGUIServer(threading.Thread):
         if dead:
             with self._sse_lock:
                 for w in dead:
-                    if w in self._sse_clients:
-                        self._sse_clients.remove(w)
+                    self._sse_clients.pop(w, None)
 
     # ---- handler class factory (captures self) ----
 
@@ -209,7 +258,7 @@ class _RefereeGUIServer(threading.Thread):
                 self.wfile.flush()
 
                 with server_instance._sse_lock:
-                    server_instance._sse_clients.append(self.wfile)
+                    server_instance._sse_clients[self.wfile] = True  # full state on the next publish
 
                 try:
                     while True:
@@ -220,8 +269,7 @@ class _RefereeGUIServer(threading.Thread):
                     pass
                 finally:
                     with server_instance._sse_lock:
-                        if self.wfile in server_instance._sse_clients:
-                            server_instance._sse_clients.remove(self.wfile)
+                        server_instance._sse_clients.pop(self.wfile, None)
 
             def _handle_command(self):
                 length = int(self.headers.get("Content-Length", 0))
@@ -286,11 +334,20 @@ def _make_static_frame() -> GameFrame:
 
 
 def _serialise_robots(game_frame) -> dict:
+    """Robots as compact [id, x, y, orientation] rows, quantised for display."""
     if game_frame is None:
         return {"friendly": [], "enemy": []}
 
     def _robot_list(robots_dict):
-        return [{"id": r.id, "x": r.p.x, "y": r.p.y, "orientation": r.orientation} for r in robots_dict.values()]
+        return [
+            [
+                r.id,
+                round(r.p.x, _POSITION_DECIMALS),
+                round(r.p.y, _POSITION_DECIMALS),
+                round(r.orientation, _ORIENTATION_DECIMALS),
+            ]
+            for r in robots_dict.values()
+        ]
 
     return {
         "friendly": _robot_list(game_frame.friendly_robots),
@@ -301,34 +358,44 @@ def _serialise_robots(game_frame) -> dict:
 def _serialise_ball(game_frame):
     if game_frame is None or game_frame.ball is None:
         return None
-    return {"x": game_frame.ball.p.x, "y": game_frame.ball.p.y}
+    return [round(game_frame.ball.p.x, _POSITION_DECIMALS), round(game_frame.ball.p.y, _POSITION_DECIMALS)]
 
 
-def _serialise_state(ref_data, game_frame=None) -> str:
+def _state_dict(ref_data, game_frame=None) -> dict:
     designated = None
     if ref_data.designated_position is not None:
         try:
-            designated = list(ref_data.designated_position)
+            x, y = ref_data.designated_position
         except TypeError:
-            designated = [
-                ref_data.designated_position.x,
-                ref_data.designated_position.y,
-            ]
+            x, y = ref_data.designated_position.x, ref_data.designated_position.y
+        designated = [round(x, _POSITION_DECIMALS), round(y, _POSITION_DECIMALS)]
 
-    return json.dumps(
-        {
-            "command": ref_data.referee_command.name,
-            "next_command": (ref_data.next_command.name if ref_data.next_command else None),
-            "stage": ref_data.stage.name,
-            "stage_time_left": ref_data.stage_time_left or 0.0,
-            "yellow_score": ref_data.yellow_team.score,
-            "blue_score": ref_data.blue_team.score,
-            "designated": designated,
-            "status_message": ref_data.status_message,
-            "robots": _serialise_robots(game_frame),
-            "ball": _serialise_ball(game_frame),
-        }
-    )
+    return {
+        "command": ref_data.referee_command.name,
+        "next_command": (ref_data.next_command.name if ref_data.next_command else None),
+        "stage": ref_data.stage.name,
+        "stage_time_left": round(ref_data.stage_time_left or 0.0, _TIME_DECIMALS),
+        "yellow_score": ref_data.yellow_team.score,
+        "blue_score": ref_data.blue_team.score,
+        "designated": designated,
+        "status_message": ref_data.status_message,
+        "robots": _serialise_robots(game_frame),
+        "ball": _serialise_ball(game_frame),
+    }
+
+
+def _state_delta(previous: Optional[dict], state: dict) -> dict:
+    """Top-level fields of ``state`` that differ from ``previous`` (all of them without one)."""
+    if previous is None:
+        return dict(state)
+    return {key: value for key, value in state.items() if previous.get(key, _MISSING) != value}
+
+
+_MISSING = object()
+
+
+def _sse_message(message: dict) -> bytes:
+    return ("data: " + json.dumps(message, separators=(",", ":")) + "\n\n").encode()
 
 
 def _build_static_config(profile: "RefereeProfile") -> dict:
@@ -879,40 +946,40 @@ function drawField(d) {
   if (robots) {
     const r = 5; // robot radius px
     // Enemy (blue)
-    for (const bot of (robots.enemy || [])) {
-      const cx = toX(bot.x), cy = toY(bot.y);
+    for (const [id, x, y, orientation] of (robots.enemy || [])) {
+      const cx = toX(x), cy = toY(y);
       ctx.fillStyle = '#4da6ff';
       ctx.beginPath(); ctx.arc(cx, cy, r, 0, 2*Math.PI); ctx.fill();
       ctx.strokeStyle = '#fff'; ctx.lineWidth = 0.8;
       ctx.beginPath();
       ctx.moveTo(cx, cy);
-      ctx.lineTo(cx + r * Math.cos(bot.orientation), cy - r * Math.sin(bot.orientation));
+      ctx.lineTo(cx + r * Math.cos(orientation), cy - r * Math.sin(orientation));
       ctx.stroke();
       ctx.fillStyle = '#fff';
       ctx.font = '7px monospace';
       ctx.textAlign = 'center';
-      ctx.fillText(bot.id, cx, cy - r - 1);
+      ctx.fillText(id, cx, cy - r - 1);
     }
     // Friendly (yellow)
-    for (const bot of (robots.friendly || [])) {
-      const cx = toX(bot.x), cy = toY(bot.y);
+    for (const [id, x, y, orientation] of (robots.friendly || [])) {
+      const cx = toX(x), cy = toY(y);
       ctx.fillStyle = '#f4c542';
       ctx.beginPath(); ctx.arc(cx, cy, r, 0, 2*Math.PI); ctx.fill();
       ctx.strokeStyle = '#111'; ctx.lineWidth = 0.8;
       ctx.beginPath();
       ctx.moveTo(cx, cy);
-      ctx.lineTo(cx + r * Math.cos(bot.orientation), cy - r * Math.sin(bot.orientation));
+      ctx.lineTo(cx + r * Math.cos(orientation), cy - r * Math.sin(orientation));
       ctx.stroke();
       ctx.fillStyle = '#111';
       ctx.font = '7px monospace';
       ctx.textAlign = 'center';
-      ctx.fillText(bot.id, cx, cy - r - 1);
+      ctx.fillText(id, cx, cy - r - 1);
     }
   }
 
   // Ball
   if (d.ball) {
-    const bx = toX(d.ball.x), by = toY(d.ball.y);
+    const bx = toX(d.ball[0]), by = toY(d.ball[1]);
     const br = Math.max(4, 3);
     ctx.fillStyle = '#e67e22';
     ctx.beginPath(); ctx.arc(bx, by, br, 0, 2*Math.PI); ctx.fill();
@@ -932,8 +999,14 @@ es.onerror = () => {
   document.getElementById('conn-dot').classList.remove('live');
   document.getElementById('conn-label').textContent = 'disconnected — retrying…';
 };
+// The first message on a connection is the full state ("full": true); every
+// later one only carries the fields that changed.
+let _state = {};
 es.onmessage = (ev) => {
-  const d = JSON.parse(ev.data);
+  const msg = JSON.parse(ev.data);
+  if (msg.full) _state = {};
+  Object.assign(_state, msg);
+  const d = _state;
 
   document.getElementById('yellow-score').textContent = d.yellow_score ?? '—';
   document.getElementById('blue-score').textContent   = d.blue_score   ?? '—';
@@ -978,9 +1051,9 @@ es.onmessage = (ev) => {
   if (_prevBS !== null && d.blue_score !== _prevBS) addLog('log-score','Blue '+d.blue_score);
   _prevBS = d.blue_score;
 
-  // Canvas update
+  // Canvas update (unchanged robots/ball also skip the redraw)
   _lastFrame = d;
-  if (_cfg) drawField(d);
+  if (_cfg && (msg.full || 'robots' in msg || 'ball' in msg || 'designated' in msg)) drawField(d);
 };
 
 function send(command) {
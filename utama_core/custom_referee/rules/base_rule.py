@@ -4,8 +4,9 @@ from __future__ import annotations
 
 from abc import ABC, abstractmethod
 from dataclasses import dataclass
-from typing import Optional
+from typing import Hashable, Optional
 
+from utama_core.custom_referee.context import RefereeContext
 from utama_core.custom_referee.geometry import RefereeGeometry
 from utama_core.entities.game.game_frame import GameFrame
 from utama_core.entities.referee.referee_command import RefereeCommand
@@ -25,7 +26,6 @@ class RuleViolation:
 class BaseRule(ABC):
     """Abstract base class for all modular referee rules."""
 
-    @abstractmethod
     def check(
         self,
         game_frame: GameFrame,
@@ -36,8 +36,22 @@ class BaseRule(ABC):
 
         Returns a RuleViolation if one is detected, otherwise None.
         """
+        return self.evaluate(RefereeContext(game_frame, geometry, current_command))
+
+    @abstractmethod
+    def evaluate(self, context: RefereeContext) -> Optional[RuleViolation]:
+        """Same as ``check``, reading the frame through the tick's shared RefereeContext."""
         ...
 
+    def input_key(self, context: RefereeContext) -> Optional[Hashable]:
+        """Summary of everything ``evaluate`` would read this tick, for CustomReferee's incremental mode.
+
+        When the key equals the one of the rule's previous evaluation, the referee reuses that result instead
+        of evaluating again, so equal keys must guarantee an equal result and no change to the rule's state.
+        Return None (the default) whenever the rule has to be evaluated.
+        """
+        return None
+
     def reset(self) -> None:
         """Called when a command transition occurs; reset internal state."""
         pass
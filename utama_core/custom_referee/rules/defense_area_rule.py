@@ -2,11 +2,10 @@
 
 from __future__ import annotations
 
-from typing import Optional
+from typing import Hashable, Optional
 
-from utama_core.custom_referee.geometry import RefereeGeometry
+from utama_core.custom_referee.context import RefereeContext
 from utama_core.custom_referee.rules.base_rule import BaseRule, RuleViolation
-from utama_core.entities.game.game_frame import GameFrame
 from utama_core.entities.referee.referee_command import RefereeCommand
 
 _ACTIVE_PLAY_COMMANDS = {
@@ -15,14 +14,6 @@ _ACTIVE_PLAY_COMMANDS = {
 }
 
 
-def _split_by_color(game_frame: GameFrame):
-    """Return (yellow_robots, blue_robots) as dict_values of Robot."""
-    if game_frame.my_team_is_yellow:
-        return game_frame.friendly_robots.values(), game_frame.enemy_robots.values()
-    else:
-        return game_frame.enemy_robots.values(), game_frame.friendly_robots.values()
-
-
 class DefenseAreaRule(BaseRule):
     """Detects attacker encroachment or too many defenders in either defense area.
 
@@ -35,27 +26,16 @@ class DefenseAreaRule(BaseRule):
         self._max_defenders = max_defenders
         self._attacker_infringement = attacker_infringement
 
-    def check(
-        self,
-        game_frame: GameFrame,
-        geometry: RefereeGeometry,
-        current_command: RefereeCommand,
-    ) -> Optional[RuleViolation]:
-        if current_command not in _ACTIVE_PLAY_COMMANDS:
+    def evaluate(self, context: RefereeContext) -> Optional[RuleViolation]:
+        if context.command not in _ACTIVE_PLAY_COMMANDS:
             return None
 
-        # Derive which side each color defends from the caller's perspective.
-        # yellow_is_right is True when yellow defends the right goal.
-        yellow_is_right = game_frame.my_team_is_right == game_frame.my_team_is_yellow
-
-        in_yellow_defense = geometry.is_in_right_defense_area if yellow_is_right else geometry.is_in_left_defense_area
-        in_blue_defense = geometry.is_in_left_defense_area if yellow_is_right else geometry.is_in_right_defense_area
-
-        yellow_robots, blue_robots = (list(g) for g in _split_by_color(game_frame))
+        # Robots of each colour in each area, with the sides each colour defends
+        # derived from the caller's perspective.
+        occupancy = context.defense_occupancy
 
         # --- Yellow defense area ---
-        n_yellow_defenders = sum(1 for r in yellow_robots if in_yellow_defense(r.p.x, r.p.y))
-        if n_yellow_defenders > self._max_defenders:
+        if occupancy.yellow_defenders > self._max_defenders:
             return RuleViolation(
                 rule_name="defense_area",
                 suggested_command=RefereeCommand.STOP,
@@ -63,19 +43,16 @@ class DefenseAreaRule(BaseRule):
                 status_message="Too many yellow defenders in own area",
             )
 
-        if self._attacker_infringement:
-            for r in blue_robots:
-                if in_yellow_defense(r.p.x, r.p.y):
-                    return RuleViolation(
-                        rule_name="defense_area",
-                        suggested_command=RefereeCommand.STOP,
-                        next_command=RefereeCommand.DIRECT_FREE_YELLOW,
-                        status_message="Blue attacker in yellow defense area",
-                    )
+        if self._attacker_infringement and occupancy.blue_attackers:
+            return RuleViolation(
+                rule_name="defense_area",
+                suggested_command=RefereeCommand.STOP,
+                next_command=RefereeCommand.DIRECT_FREE_YELLOW,
+                status_message="Blue attacker in yellow defense area",
+            )
 
         # --- Blue defense area ---
-        n_blue_defenders = sum(1 for r in blue_robots if in_blue_defense(r.p.x, r.p.y))
-        if n_blue_defenders > self._max_defenders:
+        if occupancy.blue_defenders > self._max_defenders:
             return RuleViolation(
                 rule_name="defense_area",
                 suggested_command=RefereeCommand.STOP,
@@ -83,14 +60,18 @@ class DefenseAreaRule(BaseRule):
                 status_message="Too many blue defenders in own area",
             )
 
-        if self._attacker_infringement:
-            for r in yellow_robots:
-                if in_blue_defense(r.p.x, r.p.y):
-                    return RuleViolation(
-                        rule_name="defense_area",
-                        suggested_command=RefereeCommand.STOP,
-                        next_command=RefereeCommand.DIRECT_FREE_BLUE,
-                        status_message="Yellow attacker in blue defense area",
-                    )
+        if self._attacker_infringement and occupancy.yellow_attackers:
+            return RuleViolation(
+                rule_name="defense_area",
+                suggested_command=RefereeCommand.STOP,
+                next_command=RefereeCommand.DIRECT_FREE_BLUE,
+                status_message="Yellow attacker in blue defense area",
+            )
 
         return None
+
+    def input_key(self, context: RefereeContext) -> Optional[Hashable]:
+        # Stateless: the result depends only on the command and the area counts.
+        if context.command not in _ACTIVE_PLAY_COMMANDS:
+            return "inactive"
+        return context.defense_occupancy
@@ -3,11 +3,10 @@
 from __future__ import annotations
 
 import math
-from typing import Optional
+from typing import Hashable, Optional
 
-from utama_core.custom_referee.geometry import RefereeGeometry
+from utama_core.custom_referee.context import BallZone, RefereeContext
 from utama_core.custom_referee.rules.base_rule import BaseRule, RuleViolation
-from utama_core.entities.game.game_frame import GameFrame
 from utama_core.entities.referee.referee_command import RefereeCommand
 
 # Commands that represent active play — goal detection is only relevant here.
@@ -24,33 +23,27 @@ class GoalRule(BaseRule):
         self._cooldown = cooldown_seconds
         self._last_goal_time: float = -math.inf
 
-    def check(
-        self,
-        game_frame: GameFrame,
-        geometry: RefereeGeometry,
-        current_command: RefereeCommand,
-    ) -> Optional[RuleViolation]:
-        if current_command not in _ACTIVE_PLAY_COMMANDS:
+    def evaluate(self, context: RefereeContext) -> Optional[RuleViolation]:
+        if context.command not in _ACTIVE_PLAY_COMMANDS:
             return None
 
-        ball = game_frame.ball
-        if ball is None:
+        zone = context.ball_zone
+        if zone is BallZone.NONE:
             return None
 
-        current_time = game_frame.ts
+        current_time = context.frame.ts
 
         # Respect cooldown — prevents the same goal being reported for multiple frames.
         if current_time - self._last_goal_time < self._cooldown:
             return None
 
-        bx, by = ball.p.x, ball.p.y
         # Determine which colour team defends each goal from the frame's perspective.
         # my_team_is_right=True  → yellow defends right goal, blue defends left goal.
         # my_team_is_right=False → blue defends right goal, yellow defends left goal.
-        yellow_is_right = game_frame.my_team_is_right == game_frame.my_team_is_yellow
+        yellow_is_right = context.yellow_is_right
 
         # Right goal: the team defending the right side conceded.
-        if geometry.is_in_right_goal(bx, by):
+        if zone is BallZone.RIGHT_GOAL:
             self._last_goal_time = current_time
             if yellow_is_right:
                 # Yellow conceded → Blue scored → Yellow kicks off
@@ -70,7 +63,7 @@ class GoalRule(BaseRule):
                 )
 
         # Left goal: the team defending the left side conceded.
-        if geometry.is_in_left_goal(bx, by):
+        if zone is BallZone.LEFT_GOAL:
             self._last_goal_time = current_time
             if yellow_is_right:
                 # Blue conceded → Yellow scored → Blue kicks off
@@ -91,6 +84,12 @@ class GoalRule(BaseRule):
 
         return None
 
+    def input_key(self, context: RefereeContext) -> Optional[Hashable]:
+        # A ball in a goal depends on the cooldown clock; anywhere else nothing can fire.
+        if context.command in _ACTIVE_PLAY_COMMANDS and context.ball_zone in (BallZone.LEFT_GOAL, BallZone.RIGHT_GOAL):
+            return None
+        return "no_goal"
+
     def reset(self) -> None:
         # Keep last_goal_time across resets so cooldown still applies.
         pass
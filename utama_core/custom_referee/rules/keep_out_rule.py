@@ -2,12 +2,10 @@
 
 from __future__ import annotations
 
-import math
-from typing import Optional  # used by BaseRule.check return type
+from typing import Hashable, Optional
 
-from utama_core.custom_referee.geometry import RefereeGeometry
+from utama_core.custom_referee.context import RefereeContext
 from utama_core.custom_referee.rules.base_rule import BaseRule, RuleViolation
-from utama_core.entities.game.game_frame import GameFrame
 from utama_core.entities.referee.referee_command import RefereeCommand
 
 # Commands during which the keep-out circle must be respected.
@@ -41,36 +39,21 @@ class KeepOutRule(BaseRule):
         self._persistence = violation_persistence_frames
         self._violation_count: int = 0
 
-    def check(
-        self,
-        game_frame: GameFrame,
-        geometry: RefereeGeometry,
-        current_command: RefereeCommand,
-    ) -> Optional[RuleViolation]:
-        if current_command not in _STOPPAGE_COMMANDS:
+    def evaluate(self, context: RefereeContext) -> Optional[RuleViolation]:
+        if context.command not in _STOPPAGE_COMMANDS:
             self._violation_count = 0
             return None
 
-        ball = game_frame.ball
-        if ball is None:
+        if context.ball_xy is None:
             self._violation_count = 0
             return None
 
-        bx, by = ball.p.x, ball.p.y
-
         # Determine which team is the *kicking* team (they are exempt).
-        # current_command is always in _STOPPAGE_COMMANDS here, so
+        # context.command is always in _STOPPAGE_COMMANDS here, so
         # kicking_team_is_yellow is always True or False (never None).
-        kicking_team_is_yellow = _kicking_team_is_yellow(current_command)
+        kicking_team_is_yellow = _kicking_team_is_yellow(context.command)
 
-        # Check non-kicking team robots for encroachment.
-        if kicking_team_is_yellow == game_frame.my_team_is_yellow:
-            # Friendly is kicking — check enemy only.
-            encroaching = self._any_robot_encroaching(game_frame.enemy_robots.values(), bx, by)
-        else:
-            # Enemy is kicking — check friendly only.
-            encroaching = self._any_robot_encroaching(game_frame.friendly_robots.values(), bx, by)
-        if encroaching:
+        if self._encroaching(context, kicking_team_is_yellow):
             self._violation_count += 1
         else:
             self._violation_count = 0
@@ -91,11 +74,24 @@ class KeepOutRule(BaseRule):
 
         return None
 
+    def input_key(self, context: RefereeContext) -> Optional[Hashable]:
+        # While robots encroach the persistence counter advances every frame; otherwise it just stays at 0.
+        if (
+            context.command in _STOPPAGE_COMMANDS
+            and context.ball_xy is not None
+            and self._encroaching(context, _kicking_team_is_yellow(context.command))
+        ):
+            return None
+        return "clear"
+
     def reset(self) -> None:
         self._violation_count = 0
 
-    def _any_robot_encroaching(self, robots, bx: float, by: float) -> bool:
-        return any(math.hypot(r.p.x - bx, r.p.y - by) < self._radius for r in robots)
+    def _encroaching(self, context: RefereeContext, kicking_team_is_yellow: bool) -> bool:
+        """True if a robot of the non-kicking team is inside the keep-out circle."""
+        # Friendly is kicking — check enemy only, and vice versa.
+        check_friendly = kicking_team_is_yellow != context.yellow_is_friendly
+        return context.closest_to_ball(check_friendly) < self._radius
 
 
 def _kicking_team_is_yellow(command: RefereeCommand) -> bool:
@@ -2,9 +2,9 @@
 
 from __future__ import annotations
 
-import math
-from typing import Optional
+from typing import Hashable, Optional
 
+from utama_core.custom_referee.context import BallZone, RefereeContext
 from utama_core.custom_referee.geometry import RefereeGeometry
 from utama_core.custom_referee.rules.base_rule import BaseRule, RuleViolation
 from utama_core.entities.game.game_frame import GameFrame
@@ -16,6 +16,7 @@ _ACTIVE_PLAY_COMMANDS = {
 }
 
 _INFIELD_OFFSET = 0.1  # metres inside the boundary for free-kick placement
+_TOUCH_DIST = 0.15  # metres — closest robot within this distance plausibly touched the ball
 
 
 class OutOfBoundsRule(BaseRule):
@@ -26,31 +27,25 @@ class OutOfBoundsRule(BaseRule):
         # True = friendly last touched, False = enemy last touched, None = unknown.
         self._last_touch_was_friendly: Optional[bool] = None
 
-    def check(
-        self,
-        game_frame: GameFrame,
-        geometry: RefereeGeometry,
-        current_command: RefereeCommand,
-    ) -> Optional[RuleViolation]:
-        if current_command not in _ACTIVE_PLAY_COMMANDS:
+    def evaluate(self, context: RefereeContext) -> Optional[RuleViolation]:
+        if context.command not in _ACTIVE_PLAY_COMMANDS:
             return None
 
-        ball = game_frame.ball
-        if ball is None:
+        zone = context.ball_zone
+        if zone is BallZone.NONE:
             return None
 
-        bx, by = ball.p.x, ball.p.y
-
         # Update last-touch tracking regardless of out-of-bounds state.
-        self._update_last_touch(game_frame, bx, by)
+        self._update_last_touch(context)
 
         # Only fire when ball is outside field AND not in a goal.
-        if geometry.is_in_field(bx, by) or geometry.is_in_left_goal(bx, by) or geometry.is_in_right_goal(bx, by):
+        if zone is not BallZone.OUT:
             return None
 
         # Determine which team gets the free kick (non-touching team).
-        free_kick_cmd = self._assign_free_kick(game_frame)
-        placement = self._nearest_infield_point(bx, by, geometry)
+        bx, by = context.ball_xy
+        free_kick_cmd = self._assign_free_kick(context.frame)
+        placement = self._nearest_infield_point(bx, by, context.geometry)
 
         return RuleViolation(
             rule_name="out_of_bounds",
@@ -60,6 +55,14 @@ class OutOfBoundsRule(BaseRule):
             designated_position=placement,
         )
 
+    def input_key(self, context: RefereeContext) -> Optional[Hashable]:
+        # A ball out of play always needs its placement worked out; in play, only the touch evidence matters.
+        if context.command not in _ACTIVE_PLAY_COMMANDS or context.ball_zone is BallZone.NONE:
+            return "inactive"
+        if context.ball_zone is BallZone.OUT:
+            return None
+        return ("in_play", _touch_evidence(context))
+
     def reset(self) -> None:
         self._last_touch_was_friendly = None
 
@@ -67,33 +70,11 @@ class OutOfBoundsRule(BaseRule):
     # Helpers
     # ------------------------------------------------------------------
 
-    def _update_last_touch(self, game_frame: GameFrame, bx: float, by: float) -> None:
+    def _update_last_touch(self, context: RefereeContext) -> None:
         """Update last-touch tracking based on robot proximity / has_ball flag."""
-        # Check friendly robots first (has_ball from IR sensor is reliable).
-        for robot in game_frame.friendly_robots.values():
-            if robot.has_ball:
-                self._last_touch_was_friendly = True
-                return
-
-        # Fall back to closest robot proximity.
-        min_dist = math.inf
-        closest_is_friendly: Optional[bool] = None
-
-        for robot in game_frame.friendly_robots.values():
-            d = math.hypot(robot.p.x - bx, robot.p.y - by)
-            if d < min_dist:
-                min_dist = d
-                closest_is_friendly = True
-
-        for robot in game_frame.enemy_robots.values():
-            d = math.hypot(robot.p.x - bx, robot.p.y - by)
-            if d < min_dist:
-                min_dist = d
-                closest_is_friendly = False
-
-        # Only update if a robot was actually close enough to plausibly touch (≤ 0.15 m).
-        if closest_is_friendly is not None and min_dist <= 0.15:
-            self._last_touch_was_friendly = closest_is_friendly
+        touch = _touch_evidence(context)
+        if touch is not None:
+            self._last_touch_was_friendly = touch
 
     def _assign_free_kick(self, game_frame: GameFrame) -> RefereeCommand:
         """Return the free-kick command for the non-touching team."""
@@ -120,18 +101,17 @@ class OutOfBoundsRule(BaseRule):
     @staticmethod
     def _nearest_infield_point(bx: float, by: float, geometry: RefereeGeometry) -> tuple[float, float]:
         """Return the nearest point on the field boundary, offset inward."""
-        # Clamp to field bounds and shift inward.
-        px = max(-geometry.half_length, min(geometry.half_length, bx))
-        py = max(-geometry.half_width, min(geometry.half_width, by))
+        return geometry.lookup.nearest_infield_point(bx, by, _INFIELD_OFFSET)
 
-        # If clamped on x boundary, offset inward along x.
-        if abs(bx) > geometry.half_length:
-            sign = 1.0 if bx > 0 else -1.0
-            px = sign * (geometry.half_length - _INFIELD_OFFSET)
 
-        # If clamped on y boundary, offset inward along y.
-        if abs(by) > geometry.half_width:
-            sign = 1.0 if by > 0 else -1.0
-            py = sign * (geometry.half_width - _INFIELD_OFFSET)
+def _touch_evidence(context: RefereeContext) -> Optional[bool]:
+    """Which team touched the ball this frame: True = friendly, False = enemy, None = no evidence."""
+    # Check friendly robots first (has_ball from IR sensor is reliable).
+    if any(robot.has_ball for robot in context.frame.friendly_robots.values()):
+        return True
 
-        return (px, py)
+    # Fall back to closest robot proximity, if close enough to plausibly touch.
+    closest_is_friendly, min_dist = context.closest_robot_to_ball
+    if closest_is_friendly is not None and min_dist <= _TOUCH_DIST:
+        return closest_is_friendly
+    return None
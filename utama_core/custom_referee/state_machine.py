@@ -8,6 +8,7 @@ import math
 from typing import Optional
 
 from utama_core.config.field_params import STANDARD_FIELD_DIMS
+from utama_core.custom_referee.context import RefereeContext
 from utama_core.custom_referee.geometry import RefereeGeometry
 from utama_core.custom_referee.profiles.profile_loader import AutoAdvanceConfig
 from utama_core.custom_referee.rules.base_rule import RuleViolation
@@ -158,8 +159,15 @@ class GameStateMachine:
         current_time: float,
         violation: Optional[RuleViolation],
         game_frame: Optional["GameFrame"] = None,
+        context: Optional[RefereeContext] = None,
     ) -> RefereeData:
-        """Process one tick.  Apply violation if not in cooldown.  Return RefereeData."""
+        """Process one tick.  Apply violation if not in cooldown.  Return RefereeData.
+
+        ``context`` is the RefereeContext CustomReferee already built for ``game_frame`` this tick; one is
+        built on demand when it is not given.
+        """
+        if context is None and game_frame is not None:
+            context = RefereeContext(game_frame, self._geometry, self.command)
         if self.stage_start_time is None:
             self.stage_start_time = current_time
 
@@ -175,7 +183,7 @@ class GameStateMachine:
             and self.command == RefereeCommand.STOP
             and self.next_command in self._NEEDS_STOP_FIRST
             and game_frame is not None
-            and self._all_robots_clear(game_frame)
+            and self._all_robots_clear(context)
         ):
             logger.info("All robots clear — auto-advancing STOP → %s", self.next_command.name)
             self.command = self.next_command
@@ -202,7 +210,7 @@ class GameStateMachine:
             ready = (
                 (current_time - self._prepare_entered_time) >= self._prepare_duration_seconds
                 and game_frame is not None
-                and self._kicker_in_centre_circle(self.command, game_frame)
+                and self._kicker_in_centre_circle(self.command, context)
             )
             if ready:
                 if self._advance2_ready_since == math.inf:
@@ -268,7 +276,7 @@ class GameStateMachine:
         # for _AUTO_ADVANCE_DELAY seconds.
         # ----------------------------------------------------------------
         elif self._auto_advance.direct_free_to_normal and self.command in self._DIRECT_FREE_COMMANDS:
-            ready = game_frame is not None and self._free_kick_ready(self.command, game_frame)
+            ready = game_frame is not None and self._free_kick_ready(self.command, context)
             if ready:
                 if self._advance3_ready_since == math.inf:
                     self._advance3_ready_since = current_time
@@ -357,25 +365,17 @@ class GameStateMachine:
 
         return self._generate_referee_data(current_time)
 
-    def _all_robots_clear(self, game_frame: "GameFrame") -> bool:
+    def _all_robots_clear(self, context: RefereeContext) -> bool:
         """Return True if every robot on both teams is ≥ _BALL_CLEAR_DIST from the ball."""
-        ball = game_frame.ball
-        if ball is None:
+        if context.ball_xy is None:
             return True
-        bx, by = ball.p.x, ball.p.y
-        for r in list(game_frame.friendly_robots.values()) + list(game_frame.enemy_robots.values()):
-            if math.hypot(r.p.x - bx, r.p.y - by) < _BALL_CLEAR_DIST:
-                return False
-        return True
+        return context.closest_to_ball() >= _BALL_CLEAR_DIST
 
-    def _kicker_in_centre_circle(self, command: RefereeCommand, game_frame: "GameFrame") -> bool:
+    def _kicker_in_centre_circle(self, command: RefereeCommand, context: RefereeContext) -> bool:
         """Return True if at least one robot of the attacking team is inside the centre circle."""
         r = self._geometry.center_circle_radius if self._geometry is not None else 0.5  # fallback for standalone use
         kicking_is_yellow = command == RefereeCommand.PREPARE_KICKOFF_YELLOW
-        attackers = (
-            game_frame.friendly_robots if kicking_is_yellow == game_frame.my_team_is_yellow else game_frame.enemy_robots
-        )
-        return any(math.hypot(robot.p.x, robot.p.y) <= r for robot in attackers.values())
+        return context.count_within(kicking_is_yellow == context.yellow_is_friendly, 0.0, 0.0, r) > 0
 
     def _penalty_kicker_ready(self, command: RefereeCommand, game_frame: "GameFrame") -> bool:
         """Return True when an attacking robot is within the ready radius of the penalty mark."""
@@ -399,33 +399,24 @@ class GameStateMachine:
         closest = min(math.hypot(robot.p.x - penalty_mark_x, robot.p.y) for robot in attackers.values())
         return closest <= _KICKER_READY_DIST
 
-    def _free_kick_ready(self, command: RefereeCommand, game_frame: "GameFrame") -> bool:
+    def _free_kick_ready(self, command: RefereeCommand, context: RefereeContext) -> bool:
         """Return True when a free kick is ready to start:
         - The kicker (closest attacker to ball) is within _KICKER_READY_DIST of the ball.
         - All defending robots are ≥ _BALL_CLEAR_DIST from the ball.
         """
-        ball = game_frame.ball
-        if ball is None:
+        if context.ball_xy is None:
             return False
-        bx, by = ball.p.x, ball.p.y
 
         kicking_is_yellow = command == RefereeCommand.DIRECT_FREE_YELLOW
-        attackers = (
-            game_frame.friendly_robots if kicking_is_yellow == game_frame.my_team_is_yellow else game_frame.enemy_robots
-        )
-        defenders = (
-            game_frame.enemy_robots if kicking_is_yellow == game_frame.my_team_is_yellow else game_frame.friendly_robots
-        )
+        attackers_are_friendly = kicking_is_yellow == context.yellow_is_friendly
 
         # Check defending robots are all clear.
-        if any(math.hypot(r.p.x - bx, r.p.y - by) < _BALL_CLEAR_DIST for r in defenders.values()):
+        if context.closest_to_ball(not attackers_are_friendly) < _BALL_CLEAR_DIST:
             return False
 
         # Check at least one attacker is close to the ball (kicker in position).
-        if not attackers:
-            return False
-        closest = min(math.hypot(r.p.x - bx, r.p.y - by) for r in attackers.values())
-        return closest <= _KICKER_READY_DIST
+        # With no attackers the closest distance is inf.
+        return context.closest_to_ball(attackers_are_friendly) <= _KICKER_READY_DIST
 
     def _ball_has_moved(self, game_frame: "GameFrame") -> bool:
         """Return True if the ball has moved ≥ 0.05 m since NORMAL_START."""
@@ -1,96 +1,347 @@
-from typing import Optional
-
-from utama_core.entities.data.vector import Vector2D
-from utama_core.entities.game import Game
-
-### Incomplete Code Snippet ###
-
-#     def predict_frame_after(self, t: float) -> VisionData:
-#         yellow_pos = [
-#             self.predict_object_pos_after(t, RobotEntity(Colour.YELLOW, i))
-#             for i in range(len(self.get_robots_pos(True)))
-#         ]
-#         blue_pos = [
-#             self.predict_object_pos_after(t, RobotEntity(Colour.BLUE, i))
-#             for i in range(len(self.get_robots_pos(False)))
-#         ]
-#         ball_pos = self.predict_object_pos_after(t, Ball)
-#         if ball_pos is None or None in yellow_pos or None in blue_pos:
-#             return None
-#         else:
-#             return VisionData(
-#                 self._records[-1].ts + t,
-#                 list(map(lambda pos: VisionRobotData(pos[0], pos[1], 0), yellow_pos)),
-#                 list(map(lambda pos: VisionRobotData(pos[0], pos[1], 0), blue_pos)),
-#                 [VisionBallData(ball_pos[0], ball_pos[1], 0, 1)],  # TODO : Support z axis
-#             )
-
-#     ### General Object Position Prediction ###
-#     def predict_object_pos_after(self, t: float, object: GameObject) -> Optional[tuple]:
-#         # If t is after the object has stopped we return the position at which object stopped.
-#         sx = 0
-#         sy = 0
-
-#         acceleration = self.get_object_acceleration(object)
-
-#         if acceleration is None:
-#             return None
-
-#         ax, ay = acceleration
-#         vels = self.get_object_velocity(object)
-
-#         if vels is None:
-#             ux, uy = None, None
-#         else:
-#             ux, uy = vels
-
-#         if object is Ball:
-#             ball = self.get_ball_pos()
-#             start_x, start_y = ball[0].x, ball[0].y
-#         else:
-#             posn = self._get_object_position_at_frame(len(self._records) - 1, object)
-#             start_x, start_y = posn.x, posn.y
-
-#         if ax and ux:
-#             sx = self._calculate_displacement(ux, ax, t)
-
-#         if ay and uy:
-#             sy = self._calculate_displacement(uy, ay, t)
-
-#         return (
-#             start_x + sx,
-#             start_y + sy,
-#         )  # TODO: Doesn't take into account spin / angular vel
-
-#     def _calculate_displacement(self, u, a, t) -> float:
-#         if a == 0:  # Handle zero acceleration case
-#             return u * t
-#         else:
-#             stop_time = -u / a
-#             if stop_time < 0:
-#                 stop_time = float("inf")
-#             effective_time = min(t, stop_time)
-#             displacement = (u * effective_time) + (0.5 * a * effective_time**2)
-#             logger.debug(
-#                 f"Displacement: {displacement} for time: {effective_time}, stop time: {stop_time}"
-#             )
-#             return displacement
-
-
-def predict_ball_pos_at_x(game: Game, x: float) -> Optional[tuple]:
-    vel = game.ball.v.to_2d()
-
-    if not vel or not vel[0] or not vel[1]:
-        return None
+"""Ball trajectory prediction.
+
+``BallPredictor`` turns the current ball (its position is the Kalman-filtered one when filtering is on) and the
+recent ball positions in GameHistory into a ``BallTrajectory``: the predicted path sampled every ``dt`` seconds
+over a fixed horizon. The physics model is:
+
+- in flight (a chip): ballistic in z, constant velocity in x/y, and at each bounce the vertical speed is scaled by
+  BALL_CHIP_RESTITUTION and the horizontal speed by BALL_CHIP_BOUNCE_XY_DAMPING until the ball stops bouncing;
+- on the ground: a straight roll under constant rolling friction, BALL_ROLLING_DECELERATION, until it stops.
+
+``Game.ball_trajectory`` builds the trajectory of the current frame on first use, so every skill that asks during
+a tick shares one prediction.
+"""
+
+import math
+from typing import TYPE_CHECKING, Dict, List, Optional, Tuple
+
+import numpy as np
+
+from utama_core.config.physical_constants import (
+    BALL_RADIUS,
+    GRAVITY,
+    ROBOT_HEIGHT,
+    ROBOT_RADIUS,
+)
+from utama_core.config.settings import (
+    BALL_AIRBORNE_HEIGHT,
+    BALL_CHIP_BOUNCE_XY_DAMPING,
+    BALL_CHIP_RESTITUTION,
+    BALL_FIT_POINTS,
+    BALL_MIN_BOUNCE_SPEED,
+    BALL_PREDICTION_DT,
+    BALL_PREDICTION_HORIZON,
+    BALL_ROLLING_DECELERATION,
+    BALL_STATIONARY_SPEED,
+)
+from utama_core.entities.data.vector import Vector2D, Vector3D
+from utama_core.entities.game.ball import Ball
+from utama_core.entities.game.game_history import BALL_SLOT, AttributeType, GameHistory
+from utama_core.entities.game.robot import Robot
+
+if TYPE_CHECKING:
+    from utama_core.entities.game import Game
+
+_MAX_BOUNCES = 16
+_GRAVITY_VEC = np.array((0.0, 0.0, -GRAVITY))
+
+
+class BallTrajectory:
+    """Predicted path of the ball from position ``p0`` and velocity ``v0`` (both (3,)), ``t0`` being the frame time.
+
+    Attributes:
+        ts: (n,) sample times in seconds after ``t0``, ``dt`` apart, covering ``horizon``.
+        positions: (n, 3) predicted ball positions.
+        velocities: (n, 3) predicted ball velocities.
+        landing_times: Times of the bounces of a chip, empty for a rolling ball.
+        stop_time: When the ball comes to rest; inf if it never does (no rolling friction).
+        rest_point: (2,) where it comes to rest, or None with stop_time.
+
+    Query times are seconds after ``t0`` as well. Positions past the horizon are computed from the final roll.
+    """
+
+    def __init__(
+        self,
+        p0,
+        v0,
+        t0: float = 0.0,
+        horizon: float = BALL_PREDICTION_HORIZON,
+        dt: float = BALL_PREDICTION_DT,
+        rolling_deceleration: float = BALL_ROLLING_DECELERATION,
+    ):
+        self.t0 = t0
+        self.p0 = np.array(p0, dtype=float).reshape(3)
+        self.v0 = np.array(v0, dtype=float).reshape(3)
+        self.dt = dt
+        self.rolling_deceleration = rolling_deceleration
+        self.ts = np.arange(int(round(horizon / dt)) + 1) * dt
+        self.positions = np.empty((self.ts.shape[0], 3))
+        self.velocities = np.empty((self.ts.shape[0], 3))
+        self.landing_times: List[float] = []
+        self._simulate()
+
+    @property
+    def horizon(self) -> float:
+        return float(self.ts[-1])
+
+    # ------------------------------------------------------------------
+    # Simulation
+    # ------------------------------------------------------------------
+
+    def _simulate(self):
+        p, v, t = self.p0.copy(), self.v0.copy(), 0.0
+        p[2] = max(p[2], 0.0)
+
+        if p[2] > BALL_AIRBORNE_HEIGHT or v[2] > BALL_MIN_BOUNCE_SPEED:
+            for _ in range(_MAX_BOUNCES):
+                flight = (v[2] + math.sqrt(v[2] * v[2] + 2 * GRAVITY * p[2])) / GRAVITY
+                self._fill_flight(t, t + flight, p, v)
+                p = p + v * flight + 0.5 * _GRAVITY_VEC * flight * flight
+                p[2] = 0.0
+                landing_vz = v[2] - GRAVITY * flight
+                t += flight
+                self.landing_times.append(t)
+                v = np.array(
+                    (
+                        v[0] * BALL_CHIP_BOUNCE_XY_DAMPING,
+                        v[1] * BALL_CHIP_BOUNCE_XY_DAMPING,
+                        -landing_vz * BALL_CHIP_RESTITUTION,
+                    )
+                )
+                if v[2] < BALL_MIN_BOUNCE_SPEED or t > self.horizon:
+                    break
+        v[2] = 0.0
+        p[2] = 0.0
+
+        # Final roll, kept for queries past the horizon.
+        self._roll_start = t
+        self._roll_p = p[:2].copy()
+        speed = math.hypot(v[0], v[1])
+        self._roll_speed = speed
+        self._roll_dir = v[:2] / speed if speed > 0 else np.zeros(2)
+        if speed == 0:
+            self.stop_time = t
+        elif self.rolling_deceleration > 0:
+            self.stop_time = t + speed / self.rolling_deceleration
+        else:
+            self.stop_time = math.inf
+        self.rest_point = self._roll_at(np.array([self.stop_time]))[0][0] if math.isfinite(self.stop_time) else None
+
+        mask = self.ts >= t
+        self.positions[mask, :2], self.velocities[mask, :2] = self._roll_at(self.ts[mask])
+        self.positions[mask, 2] = 0.0
+        self.velocities[mask, 2] = 0.0
+
+    def _fill_flight(self, start: float, end: float, p: np.ndarray, v: np.ndarray):
+        mask = (self.ts >= start) & (self.ts < end)
+        tau = (self.ts[mask] - start)[:, None]
+        self.positions[mask] = p + v * tau + 0.5 * _GRAVITY_VEC * tau * tau
+        self.velocities[mask] = v + _GRAVITY_VEC * tau
+
+    def _roll_at(self, ts: np.ndarray) -> Tuple[np.ndarray, np.ndarray]:
+        """(k, 2) positions and velocities of the final roll at times ``ts`` (all at or after its start)."""
+        tau = np.maximum(ts - self._roll_start, 0.0)
+        speed, decel = self._roll_speed, self.rolling_deceleration
+        if decel > 0:
+            tau = np.minimum(tau, self.stop_time - self._roll_start)
+        distance = speed * tau - 0.5 * max(decel, 0.0) * tau * tau
+        remaining = speed - max(decel, 0.0) * tau
+        positions = self._roll_p + self._roll_dir * distance[:, None]
+        velocities = self._roll_dir * remaining[:, None]
+        return positions, velocities
+
+    # ------------------------------------------------------------------
+    # Queries
+    # ------------------------------------------------------------------
+
+    def positions_at(self, ts) -> np.ndarray:
+        """(k, 3) predicted positions at times ``ts``; linear between samples."""
+        ts = np.atleast_1d(np.asarray(ts, dtype=float))
+        out = np.empty((ts.shape[0], 3))
+        sampled = ts <= self.horizon
+        for dim in range(3):
+            out[sampled, dim] = np.interp(ts[sampled], self.ts, self.positions[:, dim])
+        if not sampled.all():
+            out[~sampled, :2] = self._roll_at(ts[~sampled])[0]
+            out[~sampled, 2] = 0.0
+        return out
 
-    ux, uy = vel
-    pos = game.ball.p
-    bx = pos.x
-    by = pos.y
+    def position_at(self, t: float) -> Vector3D:
+        x, y, z = self.positions_at(t)[0].tolist()
+        return Vector3D(x, y, z)
 
-    if uy == 0:
-        return (bx, by)
+    def time_to_reach(self, point, tolerance: float = BALL_RADIUS) -> Optional[float]:
+        """Earliest time the ball passes within ``tolerance`` of the ground point ``point``; None within the horizon.
 
+        The ball moves in a straight line between samples, so a point passed between two samples is still found.
+        """
+        target = np.array((float(point[0]), float(point[1])))
+        starts = self.positions[:-1, :2]
+        steps = self.positions[1:, :2] - starts
+        offsets = starts - target
+        # |offset + u * step| = tolerance, solved for the smaller root u in [0, 1] per sample interval.
+        a = np.einsum("ij,ij->i", steps, steps)
+        b = 2 * np.einsum("ij,ij->i", offsets, steps)
+        c = np.einsum("ij,ij->i", offsets, offsets) - tolerance * tolerance
+        disc = b * b - 4 * a * c
+        with np.errstate(divide="ignore", invalid="ignore"):
+            u = np.where(c <= 0, 0.0, (-b - np.sqrt(np.maximum(disc, 0.0))) / (2 * a))
+        hit = (c <= 0) | ((a > 0) & (disc >= 0) & (u >= 0) & (u <= 1))
+        if not hit.any():
+            return None
+        i = int(np.argmax(hit))
+        return float(self.ts[i] + u[i] * self.dt)
+
+    def crossing_x(self, x: float) -> Optional[Tuple[float, float]]:
+        """``(t, y)`` of the first time the ball crosses the line at ``x``; None if not within the horizon."""
+        offsets = self.positions[:, 0] - x
+        if offsets[0] == 0:
+            return 0.0, float(self.positions[0, 1])
+        crossed = np.sign(offsets) != np.sign(offsets[0])
+        if not crossed.any():
+            return None
+        i = int(np.argmax(crossed))
+        frac = offsets[i - 1] / (offsets[i - 1] - offsets[i])
+        y = self.positions[i - 1, 1] + frac * (self.positions[i, 1] - self.positions[i - 1, 1])
+        return float(self.ts[i - 1] + frac * self.dt), float(y)
+
+    def interception_times(
+        self,
+        robot_positions,
+        robot_speed: float,
+        reaction_time: float = 0.0,
+        reach: float = ROBOT_RADIUS + BALL_RADIUS,
+    ) -> np.ndarray:
+        """Earliest time each of the (m, 2) robots can get to the ball; inf if none within the horizon.
+
+        A robot is modelled as driving straight at ``robot_speed`` after ``reaction_time``, and can only take a ball
+        that is lower than ROBOT_HEIGHT. Once the ball is at rest every robot gets there eventually.
+        """
+        robots = np.asarray(robot_positions, dtype=float).reshape(-1, 2)
+        ball = self.positions
+        gap = np.hypot(robots[:, 0, None] - ball[None, :, 0], robots[:, 1, None] - ball[None, :, 1]) - reach
+        travel = robot_speed * np.maximum(self.ts - reaction_time, 0.0)
+        reachable = (gap <= travel) & (ball[:, 2] <= ROBOT_HEIGHT)
+        times = np.where(reachable.any(axis=1), self.ts[np.argmax(reachable, axis=1)], np.inf)
+
+        if self.rest_point is not None and robot_speed > 0:
+            rest_gap = np.maximum(np.hypot(*(robots - self.rest_point).T) - reach, 0.0)
+            at_rest = np.maximum(self.stop_time, reaction_time + rest_gap / robot_speed)
+            times = np.minimum(times, at_rest)
+        return times
+
+    def earliest_interception(
+        self,
+        robots: Dict[int, Robot],
+        robot_speed: float,
+        reaction_time: float = 0.0,
+    ) -> Optional[Tuple[int, float, Vector2D]]:
+        """``(robot_id, t, point)`` of the robot that gets to the ball first, or None if none does."""
+        if not robots:
+            return None
+        ids = list(robots)
+        times = self.interception_times([(r.p.x, r.p.y) for r in robots.values()], robot_speed, reaction_time)
+        best = int(np.argmin(times))
+        if not math.isfinite(times[best]):
+            return None
+        point = self.positions_at(times[best])[0]
+        return ids[best], float(times[best]), Vector2D(point[0], point[1])
+
+
+class BallPredictor:
+    """Builds BallTrajectory objects from the current ball and the recent ball positions in GameHistory.
+
+    The velocity is a least-squares fit over the last ``fit_points`` positions (current one included), which is
+    much less noisy than the frame-to-frame difference. In flight the z fit accounts for gravity. Ground speeds below
+    BALL_STATIONARY_SPEED count as a ball at rest.
+    """
+
+    def __init__(
+        self,
+        fit_points: int = BALL_FIT_POINTS,
+        horizon: float = BALL_PREDICTION_HORIZON,
+        dt: float = BALL_PREDICTION_DT,
+        rolling_deceleration: float = BALL_ROLLING_DECELERATION,
+    ):
+        self.fit_points = fit_points
+        self.horizon = horizon
+        self.dt = dt
+        self.rolling_deceleration = rolling_deceleration
+
+    def predict(
+        self, ball: Optional[Ball], ts: float, history: Optional[GameHistory] = None
+    ) -> Optional[BallTrajectory]:
+        """Trajectory of ``ball`` as seen at ``ts``, or None without a ball."""
+        if ball is None or ball.p is None:
+            return None
+        p0 = np.array((ball.p.x, ball.p.y, getattr(ball.p, "z", 0.0)), dtype=float)
+        v0 = self.estimate_velocity(p0, ts, ball, history)
+        return BallTrajectory(p0, v0, ts, self.horizon, self.dt, self.rolling_deceleration)
+
+    def estimate_velocity(
+        self, p0: np.ndarray, ts: float, ball: Ball, history: Optional[GameHistory] = None
+    ) -> np.ndarray:
+        """(3,) velocity of the ball at ``ts``; the frame's velocity if the history holds no earlier positions."""
+        times, positions = self._recent_positions(p0, ts, history)
+        if times.shape[0] < 2:
+            v = ball.v
+            v0 = np.array((v.x, v.y, getattr(v, "z", 0.0)) if v is not None else (0.0, 0.0, 0.0), dtype=float)
+        else:
+            dt = times - ts
+            centred = dt - dt.mean()
+            denom = float(centred @ centred)
+            if denom <= 1e-12:
+                return np.zeros(3)
+            v0 = np.empty(3)
+            v0[:2] = centred @ (positions[:, :2] - positions[:, :2].mean(axis=0)) / denom
+            if positions[:, 2].max() > BALL_AIRBORNE_HEIGHT:
+                # z(t) = z0 + vz t - g t^2 / 2, i.e. z + g t^2 / 2 is linear in t with slope vz at t = 0 (now).
+                lifted = positions[:, 2] + 0.5 * GRAVITY * dt * dt
+                v0[2] = centred @ (lifted - lifted.mean()) / denom
+            else:
+                v0[2] = 0.0
+
+        if math.hypot(v0[0], v0[1]) < BALL_STATIONARY_SPEED:
+            v0[:2] = 0.0
+        return v0
+
+    def _recent_positions(
+        self, p0: np.ndarray, ts: float, history: Optional[GameHistory]
+    ) -> Tuple[np.ndarray, np.ndarray]:
+        """Timestamps (k,) and positions (k, 3) of the ball, oldest first, ending with the current ``p0``."""
+        if history is None or self.fit_points < 2:
+            return np.array([ts]), p0[None, :]
+        h_ts, h_values, h_valid = history.get_attribute_window(AttributeType.POSITION, self.fit_points - 1)
+        valid = h_valid[:, BALL_SLOT] & (h_ts < ts)
+        times = np.append(h_ts[valid], ts)
+        positions = np.vstack([h_values[valid, BALL_SLOT], p0[None, :]])
+        return times, positions
+
+
+def predict_ball_pos_at_x(game: "Game", x: float) -> Optional[Vector2D]:
+    """Where the ball's line of travel meets the vertical line at ``x`` (ahead of or behind the ball).
+
+    Uses the velocity of the shared ``game.ball_trajectory``; None if the ball is not moving along both axes.
+    """
+    trajectory = game.ball_trajectory
+    if trajectory is None:
+        return None
+    ux, uy = trajectory.v0[0], trajectory.v0[1]
+    if not ux or not uy:
+        return None
+
+    bx, by = trajectory.p0[0], trajectory.p0[1]
     t = (x - bx) / ux
     y = by + uy * t
     return Vector2D(x, y)
+
+
+def predict_ball_arrival_at_x(game: "Game", x: float) -> Optional[Vector2D]:
+    """Where the ball will actually cross the line at ``x``, allowing for friction and chips; None if it won't."""
+    trajectory = game.ball_trajectory
+    if trajectory is None:
+        return None
+    crossing = trajectory.crossing_x(x)
+    if crossing is None:
+        return None
+    return Vector2D(x, crossing[1])
@@ -1,2 +1,5 @@
 from utama_core.data_processing.receivers.referee_receiver import RefereeMessageReceiver
-from utama_core.data_processing.receivers.vision_receiver import VisionReceiver
+from utama_core.data_processing.receivers.vision_receiver import (
+    LatestFrameSlot,
+    VisionReceiver,
+)
@@ -2,10 +2,20 @@ import logging
 import threading
 import time
 from collections import deque
-from typing import Callable, Deque, List, Optional
+from typing import Callable, Deque, List, Optional, Sequence, Union
+
+import numpy as np
 
 from utama_core.config.settings import MULTICAST_GROUP, VISION_PORT
-from utama_core.entities.data.raw_vision import RawBallData, RawRobotData, RawVisionData
+from utama_core.entities.data.raw_vision import (
+    BALL_COLUMNS,
+    ROBOT_COLUMNS,
+    RawBallData,
+    RawRobotData,
+    RawVisionArrays,
+    RawVisionData,
+)
+from utama_core.global_utils import latency
 from utama_core.team_controller.src.generated_code.ssl_vision_wrapper_pb2 import (
     SSL_WrapperPacket,
 )
@@ -15,18 +25,138 @@ logger = logging.getLogger(__name__)
 # logger.setLevel(logging.DEBUG)
 
 
+_ROBOT_MM_COLUMNS = slice(1, 3)  # x, y
+_BALL_MM_COLUMNS = slice(0, 3)  # x, y, z
+
+
+def _robot_row(robot) -> tuple:
+    return (robot.robot_id, robot.x, robot.y, robot.orientation, robot.confidence)
+
+
+def _ball_row(ball) -> tuple:
+    return (ball.x, ball.y, ball.z, ball.confidence)
+
+
+class LatestFrameSlot:
+    """Holds only the newest detection frame of one camera, decoded into preallocated arrays.
+
+    Drop-in replacement for the ``deque(maxlen=1)`` vision buffers: the receiver thread calls ``write`` and the
+    consumer calls ``popleft`` (when the slot is truthy). Three frame buffers rotate so the receiver never writes
+    into the frame being published or the one the consumer last took, and no arrays are allocated per packet.
+    A frame returned by ``popleft`` stays valid until the next ``popleft`` on this slot.
+
+    Args:
+        max_robots (int): Capacity per team; extra detections in a packet are dropped with a warning.
+        max_balls (int): Capacity for ball detections; extra detections are dropped with a warning.
+        notify (threading.Event, optional): Set every time a new frame is published, e.g. to wake a
+            vision-triggered control loop.
+    """
+
+    N_BUFFERS = 3
+
+    def __init__(self, max_robots: int = 32, max_balls: int = 32, notify: Optional[threading.Event] = None):
+        self._yellow = np.zeros((self.N_BUFFERS, max_robots, len(ROBOT_COLUMNS)))
+        self._blue = np.zeros((self.N_BUFFERS, max_robots, len(ROBOT_COLUMNS)))
+        self._balls = np.zeros((self.N_BUFFERS, max_balls, len(BALL_COLUMNS)))
+        self._frames: List[Optional[RawVisionArrays]] = [None] * self.N_BUFFERS
+        self._lock = threading.Lock()
+        self._pending: Optional[int] = None  # buffer holding an unconsumed frame
+        self._reading: Optional[int] = None  # buffer last handed to the consumer
+        self._latest: Optional[int] = None  # buffer holding the newest frame, consumed or not
+        self.dropped_detections = 0
+        self._notify = notify
+
+    @property
+    def latest_ts(self) -> Optional[float]:
+        """Capture timestamp of the newest frame written, or None if nothing has arrived yet."""
+        latest = self._latest
+        return None if latest is None else self._frames[latest].ts
+
+    @property
+    def received_at(self) -> Optional[float]:
+        """Wall-clock time the newest frame arrived, or None if nothing has arrived yet."""
+        latest = self._latest
+        return None if latest is None else self._frames[latest].received_at
+
+    def write(self, detection_frame: object, received_at: float) -> bool:
+        """Decodes an SSL_DetectionFrame into a free buffer and publishes it.
+
+        Returns:
+            bool: False if the frame was ignored because it is older than the unconsumed frame.
+        """
+        with self._lock:
+            pending = self._pending
+            if pending is not None and detection_frame.t_capture <= self._frames[pending].ts:
+                return False
+            target = next(i for i in range(self.N_BUFFERS) if i != pending and i != self._reading)
+
+        n_yellow = self._fill(self._yellow[target], detection_frame.robots_yellow, _robot_row, _ROBOT_MM_COLUMNS)
+        n_blue = self._fill(self._blue[target], detection_frame.robots_blue, _robot_row, _ROBOT_MM_COLUMNS)
+        n_balls = self._fill(self._balls[target], detection_frame.balls, _ball_row, _BALL_MM_COLUMNS)
+        frame = RawVisionArrays(
+            ts=detection_frame.t_capture,
+            yellow_robots=self._yellow[target, :n_yellow],
+            blue_robots=self._blue[target, :n_blue],
+            balls=self._balls[target, :n_balls],
+            camera_id=detection_frame.camera_id,
+            received_at=received_at,
+        )
+
+        with self._lock:
+            self._frames[target] = frame
+            self._pending = target
+            self._latest = target
+        if self._notify is not None:
+            self._notify.set()
+        return True
+
+    def _fill(self, out: np.ndarray, detections: Sequence, to_row: Callable, mm_columns: slice) -> int:
+        n = len(detections)
+        if n > out.shape[0]:
+            self.dropped_detections += n - out.shape[0]
+            logger.warning(f"Vision frame has {n} detections but the slot holds {out.shape[0]}; dropping the rest.")
+            detections = detections[: out.shape[0]]
+            n = out.shape[0]
+        if n:
+            out[:n] = [to_row(d) for d in detections]
+            # SSL-Vision reports positions in mm
+            out[:n, mm_columns] /= 1000
+        return n
+
+    def popleft(self) -> RawVisionArrays:
+        with self._lock:
+            if self._pending is None:
+                raise IndexError("pop from an empty LatestFrameSlot")
+            self._reading = self._pending
+            self._pending = None
+            return self._frames[self._reading]
+
+    def __bool__(self) -> bool:
+        return self._pending is not None
+
+    def __len__(self) -> int:
+        return int(self._pending is not None)
+
+
 class VisionReceiver:
     """Receives protobuf data from SSL Vision over the network, formats into RawData types and passes it over to the
-    VisionProcessor."""
+    VisionProcessor.
+
+    ``vision_buffers`` may be ``deque(maxlen=1)`` buffers of RawVisionData, or LatestFrameSlot instances. With slots
+    the receiver drains the socket in batches and decodes detections straight into each slot's preallocated arrays
+    (RawVisionArrays), which avoids building a dataclass per detection on the receiver thread. Both kinds of buffer
+    keep detection frames that contain no robots or balls, so a camera that sees nothing still reports its timestamp.
+    """
 
     def __init__(
         self,
-        vision_buffers: List[Deque[RawVisionData]],
+        vision_buffers: Sequence[Union[Deque[RawVisionData], LatestFrameSlot]],
         on_geometry: Optional[Callable] = None,
         stop_event: Optional[threading.Event] = None,
     ):
         self.net = network_manager.NetworkManager(address=(MULTICAST_GROUP, VISION_PORT), bind_socket=True)
         self.vision_buffers = vision_buffers
+        self._array_ingest = bool(vision_buffers) and all(isinstance(b, LatestFrameSlot) for b in vision_buffers)
         self._on_geometry = on_geometry
         self._geometry_fired = False
         self._stop_event = stop_event
@@ -38,7 +168,14 @@ class VisionReceiver:
         self.last_fps_print_time = time.time()
         self.prev_frame_num = 0
 
-    def _add_detection_to_buffer(self, detection_frame: object) -> None:
+    def _add_detection_to_buffer(self, detection_frame: object, recv_time: Optional[float] = None) -> None:
+        if self._array_ingest:
+            # The slot rejects out of order packets itself
+            self.vision_buffers[detection_frame.camera_id].write(
+                detection_frame, time.time() if recv_time is None else recv_time
+            )
+            return
+
         # Deal with out of order packets by checking timestamp in the buffer
         new_raw_vis_data = self._process_packet(detection_frame)
         if self.vision_buffers[new_raw_vis_data.camera_id]:
@@ -56,22 +193,18 @@ class VisionReceiver:
         vision_packet = SSL_WrapperPacket()
         while True:
             recv_time = time.time()
-            data = self.net.receive_data()
-            if data is not None:
-                vision_packet.Clear()
-                vision_packet.ParseFromString(data)
-                if self._on_geometry and not self._geometry_fired and vision_packet.HasField("geometry"):
-                    try:
-                        self._on_geometry(vision_packet.geometry.field)
-                    except Exception as exc:
-                        self.thread_exception = exc
-                        if self._stop_event is not None:
-                            self._stop_event.set()
+            if self._array_ingest:
+                batch = self.net.receive_batch()
+                recv_time = time.time()
+            else:
+                data = self.net.receive_data()
+                batch = () if data is None else (data,)
+            for data in batch:
+                with latency.span("vision_decode"):
+                    vision_packet.Clear()
+                    vision_packet.ParseFromString(data)
+                    if not self._handle_packet(vision_packet, recv_time):
                         return
-                    self._geometry_fired = True
-                # print(vision_packet.detection)
-                self.prev_frame_num = vision_packet.detection.frame_number
-                self._add_detection_to_buffer(vision_packet.detection)
 
                 # Logging
                 # proc_latency = time.time()-recv_time
@@ -91,6 +224,23 @@ class VisionReceiver:
                         print(f"Current Vision FPS: {fps / cameras}")
                         self.last_fps_print_time = recv_time
 
+    def _handle_packet(self, vision_packet: SSL_WrapperPacket, recv_time: float) -> bool:
+        """Fires the geometry callback and buffers the detection. Returns False if the receiver must stop."""
+        if self._on_geometry and not self._geometry_fired and vision_packet.HasField("geometry"):
+            try:
+                self._on_geometry(vision_packet.geometry.field)
+            except Exception as exc:
+                self.thread_exception = exc
+                if self._stop_event is not None:
+                    self._stop_event.set()
+                return False
+            self._geometry_fired = True
+        if vision_packet.HasField("detection"):
+            # print(vision_packet.detection)
+            self.prev_frame_num = vision_packet.detection.frame_number
+            self._add_detection_to_buffer(vision_packet.detection, recv_time)
+        return True
+
     def _process_packet(self, detection_frame: object):  # detection_frame = protobuf packet detection
         return RawVisionData(
             ts=detection_frame.t_capture,
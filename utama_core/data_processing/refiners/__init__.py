@@ -2,3 +2,4 @@ from utama_core.data_processing.refiners.position import PositionRefiner
 from utama_core.data_processing.refiners.referee import RefereeRefiner
 from utama_core.data_processing.refiners.robot_info import RobotInfoRefiner
 from utama_core.data_processing.refiners.velocity import VelocityRefiner
+from utama_core.data_processing.refiners.workspace import FrameWorkspace
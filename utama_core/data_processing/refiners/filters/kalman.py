@@ -1,7 +1,8 @@
-from typing import Optional
+from typing import Dict, List, Optional, Tuple
 
 import numpy as np
 
+from utama_core.config.physical_constants import ROBOT_ID_SLOTS
 from utama_core.entities.data.vector import Vector3D
 from utama_core.entities.data.vision import VisionRobotData
 from utama_core.entities.game import Ball, Robot
@@ -402,3 +403,192 @@ class KalmanFilterBall:
         filtered_data = self._step(new_data, last_frame, time_elapsed)
 
         return Ball(Vector3D(*filtered_data), velocity, acceleration)
+
+
+class KalmanFilterBank:
+    """
+    A bank of robot Kalman filters stepped together as stacked arrays.
+
+    Runs exactly the same model and parameters as KalmanFilter (see above),
+    but keeps the state of every robot in shared arrays so a whole frame is
+    filtered with a handful of batched numpy operations instead of one small
+    Python filter object per robot.
+
+    Each robot owns a fixed slot: yellow robot ``i`` uses slot ``i`` and blue
+    robot ``i`` uses slot ``ROBOT_ID_SLOTS + i``. A slot behaves like a
+    KalmanFilter that is created the first time its robot is seen and whose
+    state is initialised from the robot's last known frame on its first step.
+
+    Args:
+        noise_xy_sd (float): Standard deviation of position noise in metres. Defaults to 0.01.
+        noise_th_sd_deg (float): Standard deviation of orientation noise in degrees. Defaults to 5.
+    """
+
+    BLUE_SLOT_OFFSET = ROBOT_ID_SLOTS
+    N_SLOTS = 2 * ROBOT_ID_SLOTS
+
+    def __init__(self, noise_xy_sd: float = 0.01, noise_th_sd_deg: float = 5):
+        assert noise_xy_sd > 0, "The standard deviation must be greater than 0"
+        assert noise_th_sd_deg > 0, "The standard deviation must be greater than 0"
+
+        noise_xy_var = pow(noise_xy_sd, 2)
+        self.identity_xy = np.identity(2)
+        # R_n and Q, shared by every slot
+        self.measurement_cov_xy = np.array([[noise_xy_var, 0], [0, noise_xy_var]], dtype=np.float64)
+        self.process_noise_xy = (2 * noise_xy_var) * self.identity_xy
+
+        noise_th_var = pow(deg_to_rad(noise_th_sd_deg), 2)
+        self.measurement_cov_th = noise_th_var
+        self.process_noise_th = noise_th_var
+
+        self.reset()
+
+    def reset(self):
+        """Forget every robot, as if all filters were discarded."""
+        n = self.N_SLOTS
+        # A slot "has a filter" once its robot has been seen, and is "initialised" once it has been stepped.
+        self.has_filter = np.zeros(n, dtype=bool)
+        self.initialised = np.zeros(n, dtype=bool)
+        self.state_xy = np.zeros((n, 2), dtype=np.float64)
+        self.covariance_mat_xy = np.tile(self.measurement_cov_xy, (n, 1, 1))
+        self.state_th = np.zeros(n, dtype=np.float64)
+        self.covariance_th = np.full(n, self.measurement_cov_th, dtype=np.float64)
+
+    def step(
+        self,
+        slots: np.ndarray,
+        measurements: np.ndarray,
+        last_p: np.ndarray,
+        last_v: np.ndarray,
+        last_th: np.ndarray,
+        time_elapsed: float,
+    ) -> np.ndarray:
+        """
+        One prediction–update cycle for every robot in ``slots``.
+
+        Args:
+            slots (np.ndarray): (k,) slot indices of the robots to step.
+            measurements (np.ndarray): (k, 3) new vision data (x, y, orientation);
+                a row of NaNs marks a vanished robot, which uses the prediction.
+            last_p (np.ndarray): (k, 2) last known positions, used to initialise new slots.
+            last_v (np.ndarray): (k, 2) last known velocities (control input).
+            last_th (np.ndarray): (k,) last known orientations, used to initialise new slots.
+            time_elapsed (float): Time since last vision data was received.
+
+        Returns:
+            np.ndarray: (k, 3) filtered (x, y, orientation) for each slot.
+        """
+        # Phase 0: initialise new slots from the last known frame
+        new = ~self.initialised[slots]
+        if new.any():
+            self.state_xy[slots[new]] = last_p[new]
+            self.state_th[slots[new]] = last_th[new]
+            self.initialised[slots[new]] = True
+
+        seen = ~np.isnan(measurements[:, 0])
+
+        # Phase 1: predict. G = time_elapsed * I, so G @ u reduces to a scale.
+        state_xy = self.state_xy[slots] + time_elapsed * last_v
+        cov_xy = self.covariance_mat_xy[slots] + self.process_noise_xy
+        state_th = self.state_th[slots]
+        cov_th = self.covariance_th[slots] + self.process_noise_th
+
+        # Phase 2: update the robots that were seen
+        if seen.any():
+            pred_state_xy = state_xy[seen]
+            pred_cov_xy = cov_xy[seen]
+
+            # K_n, solved per robot from (P + R)^T K^T = P^T
+            innovation_cov = pred_cov_xy + self.measurement_cov_xy
+            kalman_gain_xy = np.swapaxes(
+                np.linalg.solve(np.swapaxes(innovation_cov, -1, -2), np.swapaxes(pred_cov_xy, -1, -2)), -1, -2
+            )
+            kalman_gain_xy_t = np.swapaxes(kalman_gain_xy, -1, -2)
+
+            residual_xy = measurements[seen, :2] - pred_state_xy
+            state_xy[seen] = pred_state_xy + np.matmul(kalman_gain_xy, residual_xy[..., np.newaxis])[..., 0]
+
+            ident_less_kalman_xy = self.identity_xy - kalman_gain_xy
+            measurement_uncertainty_xy = np.matmul(kalman_gain_xy, np.matmul(self.measurement_cov_xy, kalman_gain_xy_t))
+            cov_xy[seen] = (
+                np.matmul(ident_less_kalman_xy, np.matmul(pred_cov_xy, np.swapaxes(ident_less_kalman_xy, -1, -2)))
+                + measurement_uncertainty_xy
+            )
+
+            pred_cov_th = cov_th[seen]
+            measurement_th = normalise_heading(measurements[seen, 2])
+            kalman_gain_th = pred_cov_th / (pred_cov_th + self.measurement_cov_th)
+            prev_th = state_th[seen]
+            # Circular weighted average, already wrapped to (-pi, pi]
+            sines_th = kalman_gain_th * np.sin(measurement_th) + (1 - kalman_gain_th) * np.sin(prev_th)
+            cosines_th = kalman_gain_th * np.cos(measurement_th) + (1 - kalman_gain_th) * np.cos(prev_th)
+            state_th[seen] = np.arctan2(sines_th, cosines_th)
+            cov_th[seen] = (1 - kalman_gain_th) * pred_cov_th
+
+        self.state_xy[slots] = state_xy
+        self.covariance_mat_xy[slots] = cov_xy
+        self.state_th[slots] = state_th
+        self.covariance_th[slots] = cov_th
+
+        return np.column_stack((state_xy, state_th))
+
+    def filter_teams(
+        self,
+        vision_yellow: Dict[int, Optional[VisionRobotData]],
+        last_yellow: Dict[int, Robot],
+        vision_blue: Dict[int, Optional[VisionRobotData]],
+        last_blue: Dict[int, Robot],
+        time_elapsed: float,
+    ) -> Tuple[List[VisionRobotData], List[VisionRobotData]]:
+        """
+        Filter both teams in a single batched step.
+
+        Vanished robots are passed as None. A robot seen for the first time
+        that has no last frame yet is passed through unfiltered, matching
+        PositionRefiner's handling of per-robot KalmanFilter objects.
+
+        Returns:
+            Tuple of filtered (yellow, blue) VisionRobotData lists, in input order.
+        """
+        outputs: List[List[Optional[VisionRobotData]]] = [[], []]
+        # (team index, output position, robot id) for every robot that is stepped
+        stepped: List[Tuple[int, int, int]] = []
+        slots, measurements, last_p, last_v, last_th = [], [], [], [], []
+
+        for team, (vision, last_frame, offset) in enumerate(
+            ((vision_yellow, last_yellow, 0), (vision_blue, last_blue, self.BLUE_SLOT_OFFSET))
+        ):
+            for robot_id, vision_robot in vision.items():
+                if not 0 <= robot_id < ROBOT_ID_SLOTS:
+                    raise ValueError(f"Robot id {robot_id} is outside the {ROBOT_ID_SLOTS} filter slots per team.")
+                slot = offset + robot_id
+                if not self.has_filter[slot]:
+                    self.has_filter[slot] = True
+                    if robot_id not in last_frame:
+                        outputs[team].append(vision_robot)
+                        continue
+                last_robot = last_frame[robot_id]
+                stepped.append((team, len(outputs[team]), robot_id))
+                outputs[team].append(None)
+                slots.append(slot)
+                if vision_robot is not None:
+                    measurements.append((vision_robot.x, vision_robot.y, vision_robot.orientation))
+                else:
+                    measurements.append((np.nan, np.nan, np.nan))
+                last_p.append((last_robot.p.x, last_robot.p.y))
+                last_v.append((last_robot.v.x, last_robot.v.y))
+                last_th.append(last_robot.orientation)
+
+        if stepped:
+            filtered = self.step(
+                np.array(slots, dtype=np.intp),
+                np.array(measurements, dtype=np.float64),
+                np.array(last_p, dtype=np.float64),
+                np.array(last_v, dtype=np.float64),
+                np.array(last_th, dtype=np.float64),
+                time_elapsed,
+            )
+            for (team, position, robot_id), (x_f, y_f, th_f) in zip(stepped, filtered.tolist()):
+                outputs[team][position] = VisionRobotData(robot_id, x_f, y_f, th_f)
+
+        return outputs[0], outputs[1]
@@ -0,0 +1,62 @@
+"""Batched polynomial fits for velocity and acceleration.
+
+In its windowed mode VelocityRefiner fits a low-order polynomial in time to the last few recorded positions of every
+object at once, and reads velocity and acceleration off the fit's derivatives at the current timestamp. With evenly
+spaced samples this is the end-point Savitzky-Golay filter. The fit is made against the actual vision timestamps, so
+late or dropped frames change the weighting of the samples instead of skewing the estimate.
+"""
+
+from typing import Tuple
+
+import numpy as np
+
+
+def fit_derivatives(
+    t: np.ndarray,
+    x: np.ndarray,
+    weights: np.ndarray,
+    order: int = 2,
+    rcond: float = 1e-10,
+) -> Tuple[np.ndarray, np.ndarray]:
+    """First and second derivatives at ``t = 0`` of a weighted least-squares polynomial fit, for every object.
+
+    Args:
+        t (np.ndarray): (n,) sample times relative to the evaluation time, shared by all objects.
+        x (np.ndarray): (n, m, d) samples of the m objects.
+        weights (np.ndarray): (n, m) sample weights. Zero (or False) leaves a sample out, e.g. one from a frame the
+            object was missing from.
+        order (int): Order of the fitted polynomial. An object with too few samples is fitted at the highest order
+            its samples allow; with fewer than two samples both derivatives are zero.
+        rcond (float): Relative cutoff for small singular values, so samples sharing a timestamp cannot blow up
+            the fit.
+
+    Returns:
+        Tuple[np.ndarray, np.ndarray]: (m, d) velocities and accelerations. Acceleration is zero below order 2.
+    """
+    n, m, d = x.shape
+    velocity = np.zeros((m, d))
+    acceleration = np.zeros((m, d))
+    span = float(np.max(np.abs(t))) if n else 0.0
+    if span <= 0.0:
+        return velocity, acceleration
+
+    # Fit in units of the window span so the normal equations stay well conditioned at 60 Hz sample spacing.
+    powers = (t / span)[:, np.newaxis] ** np.arange(2 * order + 1)  # (n, 2 * order + 1)
+    weights = np.asarray(weights, dtype=np.float64)
+    moments = weights.T @ powers  # (m, 2 * order + 1): sum of w * u^p per object
+    rhs = np.einsum("np,nm,nmd->mpd", powers[:, : order + 1], weights, x)  # (m, order + 1, d)
+    n_samples = np.count_nonzero(weights, axis=0)
+
+    fitted = np.zeros(m, dtype=bool)
+    for degree in range(order, 0, -1):
+        rows = np.flatnonzero(~fitted & (n_samples > degree))
+        if rows.size == 0:
+            continue
+        k = np.arange(degree + 1)
+        normal = moments[rows][:, k[:, np.newaxis] + k]  # (r, degree + 1, degree + 1)
+        coeffs = np.linalg.pinv(normal, rcond=rcond) @ rhs[rows, : degree + 1]
+        velocity[rows] = coeffs[:, 1] / span
+        if degree >= 2:
+            acceleration[rows] = 2.0 * coeffs[:, 2] / span**2
+        fitted[rows] = True
+    return velocity, acceleration
@@ -1,7 +1,7 @@
 from collections import defaultdict
 from dataclasses import dataclass, replace
 from functools import partial
-from typing import Dict, List, Optional, Tuple
+from typing import Dict, List, Optional, Tuple, Union
 
 import numpy as np
 
@@ -9,10 +9,18 @@ from utama_core.config.field_params import FieldDimensions
 from utama_core.config.settings import BALL_MERGE_THRESHOLD, VISION_BOUNDS_BUFFER
 from utama_core.data_processing.refiners.base_refiner import BaseRefiner
 from utama_core.data_processing.refiners.filters.kalman import (
-    KalmanFilter,
     KalmanFilterBall,
+    KalmanFilterBank,
+)
+from utama_core.data_processing.refiners.workspace import FrameWorkspace
+from utama_core.entities.data.raw_vision import (
+    BALL_COLUMNS,
+    ROBOT_COLUMNS,
+    RawBallData,
+    RawRobotData,
+    RawVisionArrays,
+    RawVisionData,
 )
-from utama_core.entities.data.raw_vision import RawBallData, RawRobotData, RawVisionData
 from utama_core.entities.data.vector import Vector2D, Vector3D
 from utama_core.entities.data.vision import VisionBallData, VisionData, VisionRobotData
 from utama_core.entities.game import Ball, FieldBounds, GameFrame, Robot
@@ -80,28 +88,90 @@ class PositionRefiner(BaseRefiner):
         )
 
         self.exp_ball = exp_ball
+        self.camera_combiner = VectorisedCameraCombiner()
 
         if self.filtering:
-            # Instantiate a dedicated Kalman filter for each robot so filtering can be kept independent.
-            self.kalman_filters_yellow: dict[int, KalmanFilter] = {}
-            self.kalman_filters_blue: dict[int, KalmanFilter] = {}
+            # One independent Kalman filter per robot, all stepped together as a single batched bank.
+            self.kalman_filter_bank = KalmanFilterBank()
             self.kalman_filter_ball = KalmanFilterBall()
 
     # Primary function for the Refiner interface
     def refine(
         self,
         game_frame: GameFrame,
-        data: List[RawVisionData],
+        data: List[Optional[Union[RawVisionData, RawVisionArrays]]],
     ) -> GameFrame:
-        frames = [frame for frame in data if frame is not None]
+        refined = self._refine_vision(game_frame, data)
 
         # If no information just return the original
-        if not frames:
+        if refined is None:
             return game_frame
+        combined_vision_data, new_ball = refined
+
+        # Some processing of robot vision data
+        new_yellow_robots, new_blue_robots = self._combine_both_teams_game_vision_positions(
+            game_frame,
+            combined_vision_data.yellow_robots,
+            combined_vision_data.blue_robots,
+        )
+
+        if game_frame.my_team_is_yellow:
+            new_game_frame = replace(
+                game_frame,
+                ts=combined_vision_data.ts,
+                friendly_robots=new_yellow_robots,
+                enemy_robots=new_blue_robots,
+                ball=new_ball,
+            )
+        else:
+            new_game_frame = replace(
+                game_frame,
+                ts=combined_vision_data.ts,
+                friendly_robots=new_blue_robots,
+                enemy_robots=new_yellow_robots,
+                ball=new_ball,
+            )
+
+        return new_game_frame
+
+    def refine_into(
+        self,
+        workspace: FrameWorkspace,
+        data: List[Optional[Union[RawVisionData, RawVisionArrays]]],
+    ) -> None:
+        """Same as ``refine``, writing the new positions into ``workspace`` instead of building a GameFrame."""
+        refined = self._refine_vision(workspace.last_frame, data)
+        if refined is None:
+            return
+        combined_vision_data, new_ball = refined
+
+        workspace.ts = combined_vision_data.ts
+        for team, vision_robots in (
+            (workspace.yellow, combined_vision_data.yellow_robots),
+            (workspace.blue, combined_vision_data.blue_robots),
+        ):
+            for robot in vision_robots:
+                team.set_pose(robot.id, robot.x, robot.y, robot.orientation)
+        workspace.set_ball(new_ball)
+
+    def _refine_vision(
+        self,
+        game_frame: GameFrame,
+        data: List[Optional[Union[RawVisionData, RawVisionArrays]]],
+    ) -> Optional[Tuple[VisionData, Optional[Ball]]]:
+        """
+        Combines the camera frames and filters them against ``game_frame``, the previous frame.
+
+        Returns:
+            The (optionally filtered) vision data and the new ball, or None if there are no frames.
+        """
+        frames = [frame for frame in data if frame is not None]
+        if not frames:
+            return None
 
         # class VisionData: ts: float; yellow_robots: List[VisionRobotData]; blue_robots: List[VisionRobotData]; balls: List[VisionBallData]
         # class VisionRobotData: id: int; x: float; y: float; orientation: float
-        combined_vision_data: VisionData = CameraCombiner().combine_cameras(
+        combined_vision_data: VisionData = self.camera_combiner.combine_cameras(
             frames,
             bounds=self.vision_bounds,
         )
@@ -119,36 +189,13 @@ class PositionRefiner(BaseRefiner):
                 game_frame.enemy_robots,
             )
 
-            filtered_yellow_robots = []
-            for y_rbt_id, vision_y_rbt in vision_yellow.items():
-                if y_rbt_id not in self.kalman_filters_yellow:
-                    self.kalman_filters_yellow[y_rbt_id] = KalmanFilter(id=y_rbt_id)
-                    if y_rbt_id not in yellow_rbt_last_frame:
-                        filtered_yellow_robots.append(vision_y_rbt)
-                        continue
-                filtered_robot = self.kalman_filters_yellow[y_rbt_id].filter_data(
-                    vision_y_rbt,  # new measurement
-                    yellow_rbt_last_frame[y_rbt_id],  # last frame
-                    time_elapsed,
-                )
-
-                filtered_yellow_robots.append(filtered_robot)
-
-            filtered_blue_robots = []
-            for b_rbt_id, vision_b_rbt in vision_blue.items():
-                if b_rbt_id not in self.kalman_filters_blue:
-                    self.kalman_filters_blue[b_rbt_id] = KalmanFilter(id=b_rbt_id)
-                    if b_rbt_id not in blue_rbt_last_frame:
-                        filtered_blue_robots.append(vision_b_rbt)
-                        continue
-
-                filtered_robot = self.kalman_filters_blue[b_rbt_id].filter_data(
-                    vision_b_rbt,  # new measurement
-                    blue_rbt_last_frame[b_rbt_id],  # last frame
-                    time_elapsed,
-                )
-
-                filtered_blue_robots.append(filtered_robot)
+            filtered_yellow_robots, filtered_blue_robots = self.kalman_filter_bank.filter_teams(
+                vision_yellow,
+                yellow_rbt_last_frame,
+                vision_blue,
+                blue_rbt_last_frame,
+                time_elapsed,
+            )
 
             combined_vision_data = VisionData(
                 ts=combined_vision_data.ts,
@@ -157,13 +204,6 @@ class PositionRefiner(BaseRefiner):
                 balls=combined_vision_data.balls,
             )
 
-        # Some processing of robot vision data
-        new_yellow_robots, new_blue_robots = self._combine_both_teams_game_vision_positions(
-            game_frame,
-            combined_vision_data.yellow_robots,
-            combined_vision_data.blue_robots,
-        )
-
         # After the balls have been combined, take the most confident
         new_ball = PositionRefiner._get_most_confident_ball(combined_vision_data.balls)
 
@@ -180,24 +220,7 @@ class PositionRefiner(BaseRefiner):
                 # If none, take the ball from the last frame of the game
                 new_ball = game_frame.ball
 
-        if game_frame.my_team_is_yellow:
-            new_game_frame = replace(
-                game_frame,
-                ts=combined_vision_data.ts,
-                friendly_robots=new_yellow_robots,
-                enemy_robots=new_blue_robots,
-                ball=new_ball,
-            )
-        else:
-            new_game_frame = replace(
-                game_frame,
-                ts=combined_vision_data.ts,
-                friendly_robots=new_blue_robots,
-                enemy_robots=new_yellow_robots,
-                ball=new_ball,
-            )
-
-        return new_game_frame
+        return combined_vision_data, new_ball
 
     def reset(self):
         """
@@ -206,8 +229,7 @@ class PositionRefiner(BaseRefiner):
         """
         self._filter_running = False
         if self.filtering:
-            self.kalman_filters_yellow = {}
-            self.kalman_filters_blue = {}
+            self.kalman_filter_bank.reset()
             self.kalman_filter_ball = KalmanFilterBall()
 
     def start_filtering(self):
@@ -445,3 +467,181 @@ class CameraCombiner:
         nz = (b1.z + b2.z) / 2
         nc = max(b1.confidence, b2.confidence)
         return RawBallData(nx, ny, nz, nc)
+
+
+class VectorisedCameraCombiner(CameraCombiner):
+    """
+    Array-based CameraCombiner.
+
+    All detections from every camera are stacked into numpy arrays and merged in
+    one pass:
+
+    - Robots: confidence-weighted mean position and circular mean orientation per
+      robot id, computed with ``np.bincount``.
+    - Balls: detections closer than BALL_MERGE_THRESHOLD (Manhattan distance) are
+      clustered transitively using a uniform grid with cell size equal to the
+      threshold, so only detections in neighbouring cells are ever compared.
+      Each cluster becomes one ball at the confidence-weighted mean position with
+      the maximum confidence of its members.
+
+    Robots and balls are returned in order of first detection, like CameraCombiner.
+    """
+
+    # Half of the 3x3 neighbourhood: every unordered pair of neighbouring cells is visited once.
+    _NEIGHBOUR_OFFSETS = ((0, 0), (1, -1), (1, 0), (1, 1), (0, 1))
+
+    def combine_cameras(
+        self,
+        frames: List[Union[RawVisionData, RawVisionArrays]],
+        bounds: VisionBounds,
+    ) -> VisionData:
+        """
+        Same contract as CameraCombiner.combine_cameras, but frames may also be RawVisionArrays
+        (as produced by LatestFrameSlot), whose detection arrays are used without conversion.
+        """
+        ts = sum(frame.ts for frame in frames) / len(frames)
+
+        return VisionData(
+            ts,
+            self._combine_robots(self._stack(frames, "yellow_robots", self._robot_array), bounds),
+            self._combine_robots(self._stack(frames, "blue_robots", self._robot_array), bounds),
+            self._combine_balls(self._stack(frames, "balls", self._ball_array), bounds),
+        )
+
+    @staticmethod
+    def _stack(frames: List[Union[RawVisionData, RawVisionArrays]], attr: str, to_array) -> np.ndarray:
+        """Concatenates the ``attr`` detections of every frame into one array."""
+        arrays = [
+            getattr(frame, attr) if isinstance(frame, RawVisionArrays) else to_array(getattr(frame, attr))
+            for frame in frames
+        ]
+        return arrays[0] if len(arrays) == 1 else np.concatenate(arrays)
+
+    @staticmethod
+    def _robot_array(robots: List[RawRobotData]) -> np.ndarray:
+        """(n, 5) array with columns ROBOT_COLUMNS."""
+        if not robots:
+            return np.empty((0, len(ROBOT_COLUMNS)))
+        return np.array([(r.id, r.x, r.y, r.orientation, r.confidence) for r in robots], dtype=np.float64)
+
+    @staticmethod
+    def _ball_array(balls: List[RawBallData]) -> np.ndarray:
+        """(n, 4) array with columns BALL_COLUMNS."""
+        if not balls:
+            return np.empty((0, len(BALL_COLUMNS)))
+        return np.array([(b.x, b.y, b.z, b.confidence) for b in balls], dtype=np.float64)
+
+    @staticmethod
+    def _in_bounds(x: np.ndarray, y: np.ndarray, bounds: VisionBounds) -> np.ndarray:
+        return (bounds.x_min <= x) & (x <= bounds.x_max) & (bounds.y_min <= y) & (y <= bounds.y_max)
+
+    def _combine_robots(self, robots: np.ndarray, bounds: VisionBounds) -> List[VisionRobotData]:
+        robots = robots[self._in_bounds(robots[:, 1], robots[:, 2], bounds)]
+        if robots.shape[0] == 0:
+            return []
+
+        ids = robots[:, 0].astype(np.intp)
+        unique_ids, first_seen, group = np.unique(ids, return_index=True, return_inverse=True)
+        n_groups = unique_ids.shape[0]
+
+        weights = robots[:, 4]
+        weight_sums = np.bincount(group, weights=weights, minlength=n_groups)
+        # Fall back to a plain mean for ids whose detections all have zero confidence.
+        unweighted = weight_sums[group] <= 0
+        if unweighted.any():
+            weights = np.where(unweighted, 1.0, weights)
+            weight_sums = np.bincount(group, weights=weights, minlength=n_groups)
+
+        x = np.bincount(group, weights=weights * robots[:, 1], minlength=n_groups) / weight_sums
+        y = np.bincount(group, weights=weights * robots[:, 2], minlength=n_groups) / weight_sums
+        sin_th = np.bincount(group, weights=weights * np.sin(robots[:, 3]), minlength=n_groups)
+        cos_th = np.bincount(group, weights=weights * np.cos(robots[:, 3]), minlength=n_groups)
+        orientation = np.arctan2(sin_th, cos_th)
+
+        order = np.argsort(first_seen, kind="stable")
+        return [
+            VisionRobotData(int(unique_ids[i]), float(x[i]), float(y[i]), float(orientation[i])) for i in order.tolist()
+        ]
+
+    def _combine_balls(self, balls: np.ndarray, bounds: VisionBounds) -> List[VisionBallData]:
+        balls = balls[self._in_bounds(balls[:, 0], balls[:, 1], bounds)]
+        n = balls.shape[0]
+        if n == 0:
+            return []
+
+        labels = self._cluster(balls[:, :2], BALL_MERGE_THRESHOLD)
+        n_clusters = int(labels.max()) + 1
+
+        weights = balls[:, 3]
+        weight_sums = np.bincount(labels, weights=weights, minlength=n_clusters)
+        unweighted = weight_sums[labels] <= 0
+        if unweighted.any():
+            weights = np.where(unweighted, 1.0, weights)
+            weight_sums = np.bincount(labels, weights=weights, minlength=n_clusters)
+
+        merged = np.empty((n_clusters, 4))
+        for dim in range(3):
+            merged[:, dim] = np.bincount(labels, weights=weights * balls[:, dim], minlength=n_clusters) / weight_sums
+        merged[:, 3] = -np.inf
+        np.maximum.at(merged[:, 3], labels, balls[:, 3])
+
+        return [VisionBallData(x, y, z, c) for x, y, z, c in merged.tolist()]
+
+    @classmethod
+    def _cluster(cls, xy: np.ndarray, threshold: float) -> np.ndarray:
+        """
+        Label points so that any two points closer than ``threshold`` (Manhattan)
+        share a label, transitively. Labels are 0..k-1 in order of first point.
+        """
+        n = xy.shape[0]
+        if n == 1:
+            return np.zeros(1, dtype=np.intp)
+
+        # Bucket points into a grid of threshold-sized cells; points sorted by cell so each cell is a contiguous run.
+        cells = np.floor(xy / threshold).astype(np.int64)
+        cell_keys = cells[:, 0] * (1 << 32) + cells[:, 1]
+        order = np.argsort(cell_keys, kind="stable")
+        sorted_keys = cell_keys[order]
+        unique_keys, cell_starts, cell_counts = np.unique(sorted_keys, return_index=True, return_counts=True)
+
+        pairs_i, pairs_j = [], []
+        for dx, dy in cls._NEIGHBOUR_OFFSETS:
+            neighbour_keys = cell_keys + dx * (1 << 32) + dy
+            pos = np.searchsorted(unique_keys, neighbour_keys)
+            pos = np.minimum(pos, unique_keys.shape[0] - 1)
+            has_neighbour = unique_keys[pos] == neighbour_keys
+            if not has_neighbour.any():
+                continue
+            src = np.flatnonzero(has_neighbour)
+            counts = cell_counts[pos[src]]
+            # Expand each point into one candidate pair per point in its neighbouring cell.
+            i = np.repeat(src, counts)
+            run_offsets = np.arange(counts.sum()) - np.repeat(np.cumsum(counts) - counts, counts)
+            j = order[np.repeat(cell_starts[pos[src]], counts) + run_offsets]
+            if dx == 0 and dy == 0:
+                keep = i < j
+                i, j = i[keep], j[keep]
+            pairs_i.append(i)
+            pairs_j.append(j)
+
+        labels = np.arange(n)
+        if pairs_i:
+            i = np.concatenate(pairs_i)
+            j = np.concatenate(pairs_j)
+            close = np.abs(xy[i] - xy[j]).sum(axis=1) < threshold
+            i, j = i[close], j[close]
+            # Min-label propagation; clusters are tiny so this converges in a few sweeps.
+            while i.size:
+                new_labels = labels.copy()
+                np.minimum.at(new_labels, i, labels[j])
+                np.minimum.at(new_labels, j, labels[i])
+                new_labels = new_labels[new_labels]
+                if np.array_equal(new_labels, labels):
+                    break
+                labels = new_labels
+
+        # Relabel densely in order of first appearance.
+        _, first, dense = np.unique(labels, return_index=True, return_inverse=True)
+        rank = np.empty_like(first)
+        rank[np.argsort(first, kind="stable")] = np.arange(first.shape[0])
+        return rank[dense]
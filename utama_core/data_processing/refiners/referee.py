@@ -2,6 +2,7 @@ import dataclasses
 from typing import Optional
 
 from utama_core.data_processing.refiners.base_refiner import BaseRefiner
+from utama_core.data_processing.refiners.workspace import FrameWorkspace
 from utama_core.entities.data.referee import RefereeData
 from utama_core.entities.game.team_info import TeamInfo
 from utama_core.entities.referee.referee_command import RefereeCommand
@@ -27,6 +28,19 @@ class RefereeRefiner(BaseRefiner):
         if data is None:
             return game_frame
 
+        self._track(data)
+
+        # Return a new GameFrame with referee data injected
+        return dataclasses.replace(game_frame, referee=data)
+
+    def refine_into(self, workspace: FrameWorkspace, data: Optional[RefereeData]) -> None:
+        """Same as ``refine``, attaching the referee data to ``workspace``."""
+        if data is None:
+            return
+        self._track(data)
+        workspace.referee = data
+
+    def _track(self, data: RefereeData) -> None:
         # Always track the latest data so live properties (status_message, etc.)
         # stay current even when deduplication skips appending a new record.
         self._latest_referee_data = data
@@ -35,9 +49,6 @@ class RefereeRefiner(BaseRefiner):
         # Add to history
         self.add_new_referee_data(data)
 
-        # Return a new GameFrame with referee data injected
-        return dataclasses.replace(game_frame, referee=data)
-
     def add_new_referee_data(self, referee_data: RefereeData) -> None:
         if not self._referee_records or referee_data != self._referee_records[-1]:
             self._referee_records.append(referee_data)
@@ -3,6 +3,7 @@ from dataclasses import replace
 from typing import List
 
 from utama_core.data_processing.refiners.base_refiner import BaseRefiner
+from utama_core.data_processing.refiners.workspace import FrameWorkspace
 from utama_core.entities.data.command import RobotResponse
 from utama_core.entities.game.game_frame import GameFrame
 
@@ -24,3 +25,16 @@ class RobotInfoRefiner(BaseRefiner):
                 warnings.warn(f"Robot ID {id} in robot responses not found in friendly robots. ")
         new_game_frame = replace(game_frame, friendly_robots=friendly_robots)
         return new_game_frame
+
+    def refine_into(self, workspace: FrameWorkspace, robot_responses: List[RobotResponse]) -> None:
+        """Same as ``refine``, setting has_ball on the friendly robots in ``workspace``."""
+        if not robot_responses:
+            return
+
+        friendly = workspace.friendly
+        for robot_response in robot_responses:
+            row = friendly.row(robot_response.id)
+            if row is not None:
+                friendly.has_ball[row] = robot_response.has_ball
+            else:
+                warnings.warn(f"Robot ID {robot_response.id} in robot responses not found in friendly robots. ")
@@ -1,17 +1,29 @@
 import logging
 from dataclasses import replace
-from typing import Dict, Tuple, Union  # Added List for type hinting
+from typing import Dict, List, Optional, Tuple, Union
 
 import numpy as np  # Import NumPy
 
 from utama_core.data_processing.refiners.base_refiner import BaseRefiner
-from utama_core.entities.data.object import ObjectKey, TeamType
+from utama_core.data_processing.refiners.kinematics import fit_derivatives
+from utama_core.data_processing.refiners.workspace import (
+    AX,
+    AY,
+    VX,
+    VY,
+    X,
+    Y,
+    FrameWorkspace,
+)
+from utama_core.entities.data.object import ObjectKey, ObjectType, TeamType
 from utama_core.entities.data.vector import Vector2D, Vector3D
 from utama_core.entities.game import GameFrame, Robot
 from utama_core.entities.game.game_history import (
+    BALL_SLOT,
     AttributeType,
     GameHistory,
     get_structured_object_key,
+    object_slot,
 )
 
 logger = logging.getLogger(__name__)
@@ -22,10 +34,33 @@ def zero_vector(twod: bool) -> Union[Vector2D, Vector3D]:
 
 
 class VelocityRefiner(BaseRefiner):
+    """Estimates the velocity and acceleration of the ball and every robot from the game history.
+
+    Args:
+        fit_window (int, optional): Estimate all objects in one batched least-squares polynomial fit (see
+            ``kinematics.fit_derivatives``) over each object's positions in the last ``fit_window`` history frames
+            plus its current one, against the actual timestamps. Defaults to None, which differences the current
+            position against the last recorded one and takes acceleration from windowed averages of the recorded
+            velocities, one object at a time.
+        fit_order (int): Order of the fitted polynomial when ``fit_window`` is set. 2 also estimates acceleration,
+            1 leaves it at zero. Defaults to 2.
+    """
+
     ACCELERATION_WINDOW_SIZE = 5
     ACCELERATION_N_WINDOWS = 3
 
+    def __init__(self, fit_window: Optional[int] = None, fit_order: int = 2):
+        if fit_window is not None and fit_window < 1:
+            raise ValueError(f"fit_window must be at least 1, got {fit_window}.")
+        if fit_order < 1:
+            raise ValueError(f"fit_order must be at least 1, got {fit_order}.")
+        self.fit_window = fit_window
+        self.fit_order = fit_order
+
     def refine(self, game_history: GameHistory, game_frame: GameFrame) -> GameFrame:
+        if self.fit_window is not None:
+            return self._refine_fitted(game_history, game_frame)
+
         current_game_ts = game_frame.ts
 
         # Process Ball (Keep this commented if you want to focus on robots first)
@@ -55,6 +90,115 @@ class VelocityRefiner(BaseRefiner):
         )
         return game_frame
 
+    def refine_into(self, game_history: GameHistory, workspace: FrameWorkspace) -> None:
+        """Same as ``refine``, writing velocities and accelerations into ``workspace``."""
+        if self.fit_window is not None:
+            self._refine_into_fitted(game_history, workspace)
+            return
+
+        current_ts = workspace.ts
+
+        if workspace.ball_present:
+            ball = workspace.ball_state
+            ball_obj_key = ObjectKey(TeamType.NEUTRAL, ObjectType.BALL, 0)
+            new_ball_v = self._calculate_object_velocity(
+                game_history, Vector3D(ball[0], ball[1], ball[2]), ball_obj_key, current_ts, twod=False
+            )
+            new_ball_a = zero_vector(twod=False)
+            try:
+                new_ball_a = self._calculate_object_acceleration(game_history, ball_obj_key, twod=False)
+            except Exception as e:
+                logger.warning(f"Could not calculate acceleration for ball (key: {ball_obj_key}), setting to zero: {e}")
+            ball[3:] = (new_ball_v.x, new_ball_v.y, new_ball_v.z, new_ball_a.x, new_ball_a.y, new_ball_a.z)
+
+        for team, team_type in ((workspace.friendly, TeamType.FRIENDLY), (workspace.enemy, TeamType.ENEMY)):
+            state = team.state
+            for row, (robot_id, (x, y)) in enumerate(zip(team.ids, state[: len(team), X : Y + 1].tolist())):
+                robot_obj_key = ObjectKey(team_type, ObjectType.ROBOT, robot_id)
+                new_v = self._calculate_object_velocity(game_history, Vector2D(x, y), robot_obj_key, current_ts, True)
+                new_a = self._calculate_object_acceleration(game_history, robot_obj_key, True)
+                state[row, VX : AY + 1] = (new_v.x, new_v.y, new_a.x, new_a.y)
+
+    def _refine_fitted(self, game_history: GameHistory, game_frame: GameFrame) -> GameFrame:
+        ball = game_frame.ball
+        teams = (
+            ("friendly_robots", game_frame.friendly_robots, TeamType.FRIENDLY),
+            ("enemy_robots", game_frame.enemy_robots, TeamType.ENEMY),
+        )
+        slots = [BALL_SLOT] if ball else []
+        current = [(ball.p.x, ball.p.y, ball.p.z)] if ball else []
+        for _, robots, team_type in teams:
+            for robot_id, robot in robots.items():
+                slots.append(self._robot_slot(team_type, robot_id))
+                current.append((robot.p.x, robot.p.y, 0.0))
+
+        velocity, acceleration = self._fit_kinematics(game_history, game_frame.ts, slots, np.array(current))
+        velocity, acceleration = velocity.tolist(), acceleration.tolist()
+
+        changes = {}
+        i = 0
+        if ball:
+            changes["ball"] = replace(ball, v=Vector3D(*velocity[0]), a=Vector3D(*acceleration[0]))
+            i = 1
+        for field_name, robots, _ in teams:
+            updated_robots = {}
+            for robot_id, robot in robots.items():
+                (vx, vy, _), (ax, ay, _) = velocity[i], acceleration[i]
+                updated_robots[robot_id] = replace(robot, v=Vector2D(vx, vy), a=Vector2D(ax, ay))
+                i += 1
+            changes[field_name] = updated_robots
+        return replace(game_frame, **changes)
+
+    def _refine_into_fitted(self, game_history: GameHistory, workspace: FrameWorkspace) -> None:
+        teams = ((workspace.friendly, TeamType.FRIENDLY), (workspace.enemy, TeamType.ENEMY))
+        slots = [BALL_SLOT] if workspace.ball_present else []
+        for team, team_type in teams:
+            slots.extend(self._robot_slot(team_type, robot_id) for robot_id in team.ids)
+
+        current = np.zeros((len(slots), 3))
+        start = 1 if workspace.ball_present else 0
+        if workspace.ball_present:
+            current[0] = workspace.ball_state[:3]
+        for team, _ in teams:
+            n = len(team)
+            current[start : start + n, :2] = team.state[:n, X : Y + 1]
+            start += n
+
+        velocity, acceleration = self._fit_kinematics(game_history, workspace.ts, slots, current)
+
+        start = 1 if workspace.ball_present else 0
+        if workspace.ball_present:
+            workspace.ball_state[3:6] = velocity[0]
+            workspace.ball_state[6:9] = acceleration[0]
+        for team, _ in teams:
+            n = len(team)
+            team.state[:n, VX : VY + 1] = velocity[start : start + n, :2]
+            team.state[:n, AX : AY + 1] = acceleration[start : start + n, :2]
+            start += n
+
+    @staticmethod
+    def _robot_slot(team_type: TeamType, robot_id: int) -> int:
+        """History column of a robot, or -1 if its id has no slot (it then has no history to fit)."""
+        slot = object_slot(ObjectKey(team_type, ObjectType.ROBOT, robot_id))
+        return -1 if slot is None else slot
+
+    def _fit_kinematics(
+        self, game_history: GameHistory, current_ts: float, slots: List[int], current: np.ndarray
+    ) -> Tuple[np.ndarray, np.ndarray]:
+        """(m, 3) velocities and accelerations of the objects in history ``slots``, now at ``current`` (m, 3)."""
+        if not slots:
+            return np.zeros((0, 3)), np.zeros((0, 3))
+        slots = np.asarray(slots)
+        timestamps, positions, valid = game_history.get_attribute_window(AttributeType.POSITION, self.fit_window)
+        columns = np.maximum(slots, 0)
+        # Samples not strictly older than the current frame (a stalled or reset clock) cannot constrain the fit.
+        history_weights = valid[:, columns] & (slots >= 0) & (timestamps < current_ts)[:, np.newaxis]
+
+        t = np.append(timestamps - current_ts, 0.0)
+        x = np.concatenate([positions[:, columns], current[np.newaxis]])
+        weights = np.concatenate([history_weights, np.ones((1, len(slots)), dtype=bool)])
+        return fit_derivatives(t, x, weights, self.fit_order)
+
     def _refine_robot_group(
         self,
         game_history: GameHistory,
@@ -0,0 +1,147 @@
+"""Mutable per-tick frame for the refiner pipeline.
+
+With ``StrategyRunner(refine_in_place=True)`` each side keeps one FrameWorkspace for the whole game. Every refiner's
+``refine_into`` writes its results into the workspace arrays instead of rebuilding the frozen GameFrame (and each
+Robot in it) with ``dataclasses.replace``. ``snapshot`` then builds the GameFrame handed to the strategy, the game
+history and the replay writer once per tick.
+"""
+
+from typing import Dict, List, Optional
+
+import numpy as np
+
+from utama_core.config.physical_constants import ROBOT_ID_SLOTS
+from utama_core.entities.data.referee import RefereeData
+from utama_core.entities.data.vector import Vector2D, Vector3D
+from utama_core.entities.game import Ball, GameFrame, Robot
+
+ROBOT_STATE_COLUMNS = ("x", "y", "vx", "vy", "ax", "ay", "orientation")
+X, Y, VX, VY, AX, AY, ORIENTATION = range(len(ROBOT_STATE_COLUMNS))
+
+BALL_STATE_COLUMNS = ("x", "y", "z", "vx", "vy", "vz", "ax", "ay", "az")
+
+
+class TeamWorkspace:
+    """The robots of one colour: one ``state`` row (ROBOT_STATE_COLUMNS) and one ``has_ball`` entry per robot.
+
+    Rows are assigned in order of first sighting, which is the dict order of the robots in a GameFrame. Robots
+    are never removed, like the chained refiners, which keep a vanished robot at its last known state.
+    """
+
+    def __init__(self, is_friendly: bool, capacity: int = ROBOT_ID_SLOTS):
+        self.is_friendly = is_friendly
+        self.state = np.zeros((capacity, len(ROBOT_STATE_COLUMNS)))
+        self.has_ball = np.zeros(capacity, dtype=bool)
+        self.ids: List[int] = []
+        self._rows: Dict[int, int] = {}
+
+    def __len__(self) -> int:
+        return len(self.ids)
+
+    def __contains__(self, robot_id: int) -> bool:
+        return robot_id in self._rows
+
+    def row(self, robot_id: int) -> Optional[int]:
+        return self._rows.get(robot_id)
+
+    def add(self, robot_id: int) -> int:
+        """Row for a robot seen for the first time: zero velocity and acceleration, no ball."""
+        row = len(self.ids)
+        if row == self.state.shape[0]:
+            self.state = np.concatenate([self.state, np.zeros_like(self.state)])
+            self.has_ball = np.concatenate([self.has_ball, np.zeros_like(self.has_ball)])
+        self.state[row] = 0.0
+        self.has_ball[row] = False
+        self.ids.append(robot_id)
+        self._rows[robot_id] = row
+        return row
+
+    def set_pose(self, robot_id: int, x: float, y: float, orientation: float):
+        row = self._rows.get(robot_id)
+        if row is None:
+            row = self.add(robot_id)
+        state = self.state
+        state[row, X] = x
+        state[row, Y] = y
+        state[row, ORIENTATION] = orientation
+
+    def load(self, robots: Dict[int, Robot]):
+        self.ids.clear()
+        self._rows.clear()
+        for robot in robots.values():
+            row = self.add(robot.id)
+            self.state[row] = (robot.p.x, robot.p.y, robot.v.x, robot.v.y, robot.a.x, robot.a.y, robot.orientation)
+            self.has_ball[row] = robot.has_ball
+
+    def robots(self) -> Dict[int, Robot]:
+        n = len(self.ids)
+        is_friendly = self.is_friendly
+        return {
+            robot_id: Robot(
+                robot_id, is_friendly, has_ball, Vector2D(x, y), Vector2D(vx, vy), Vector2D(ax, ay), orientation
+            )
+            for robot_id, (x, y, vx, vy, ax, ay, orientation), has_ball in zip(
+                self.ids, self.state[:n].tolist(), self.has_ball[:n].tolist()
+            )
+        }
+
+
+class FrameWorkspace:
+    """Array-backed, mutable counterpart of GameFrame for one side.
+
+    ``last_frame`` is the GameFrame of the previous ``snapshot`` (or ``load``). Refiners that need last tick's
+    frozen state, such as the Kalman filters, read it from there, so call each ``refine_into`` once per tick
+    between snapshots.
+    """
+
+    def __init__(self, frame: GameFrame):
+        self.my_team_is_yellow = frame.my_team_is_yellow
+        self.my_team_is_right = frame.my_team_is_right
+        self.yellow = TeamWorkspace(is_friendly=frame.my_team_is_yellow)
+        self.blue = TeamWorkspace(is_friendly=not frame.my_team_is_yellow)
+        self.ball_state = np.zeros(len(BALL_STATE_COLUMNS))
+        self.ball_present = False
+        self.load(frame)
+
+    @property
+    def friendly(self) -> TeamWorkspace:
+        return self.yellow if self.my_team_is_yellow else self.blue
+
+    @property
+    def enemy(self) -> TeamWorkspace:
+        return self.blue if self.my_team_is_yellow else self.yellow
+
+    def load(self, frame: GameFrame):
+        """Overwrites the workspace with ``frame``, e.g. after the game was reloaded outside the pipeline."""
+        self.ts: float = frame.ts
+        self.referee: Optional[RefereeData] = frame.referee
+        self.friendly.load(frame.friendly_robots)
+        self.enemy.load(frame.enemy_robots)
+        self.set_ball(frame.ball)
+        self.last_frame = frame
+
+    def set_ball(self, ball: Optional[Ball]):
+        self.ball_present = ball is not None
+        if ball is not None:
+            p, v, a = ball.p, ball.v, ball.a
+            self.ball_state[:] = (p.x, p.y, p.z, v.x, v.y, v.z, a.x, a.y, a.z)
+
+    def ball(self) -> Optional[Ball]:
+        if not self.ball_present:
+            return None
+        px, py, pz, vx, vy, vz, ax, ay, az = self.ball_state.tolist()
+        return Ball(Vector3D(px, py, pz), Vector3D(vx, vy, vz), Vector3D(ax, ay, az))
+
+    def snapshot(self) -> GameFrame:
+        """Freezes the current state into a new GameFrame, which also becomes ``last_frame``."""
+        frame = GameFrame(
+            ts=self.ts,
+            my_team_is_yellow=self.my_team_is_yellow,
+            my_team_is_right=self.my_team_is_right,
+            friendly_robots=self.friendly.robots(),
+            enemy_robots=self.enemy.robots(),
+            ball=self.ball(),
+            referee=self.referee,
+        )
+        self.last_frame = frame
+        return frame
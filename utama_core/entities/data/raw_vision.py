@@ -1,6 +1,8 @@
 from dataclasses import dataclass
 from typing import List
 
+import numpy as np
+
 # Unit: m
 
 
@@ -28,3 +30,25 @@ class RawVisionData:
     blue_robots: List[RawRobotData]
     balls: List[RawBallData]
     camera_id: int
+
+
+# Column layout of the RawVisionArrays detection arrays
+ROBOT_COLUMNS = ("id", "x", "y", "orientation", "confidence")
+BALL_COLUMNS = ("x", "y", "z", "confidence")
+
+
+@dataclass
+class RawVisionArrays:
+    """Array form of RawVisionData, one row per detection.
+
+    yellow_robots / blue_robots have shape (n, 5) with columns ROBOT_COLUMNS and balls has shape (n, 4) with
+    columns BALL_COLUMNS. The arrays may be views into a receiver's preallocated buffers, so they should be
+    treated as read-only. received_at is the local wall-clock time the packet arrived, used to judge staleness.
+    """
+
+    ts: float
+    yellow_robots: np.ndarray
+    blue_robots: np.ndarray
+    balls: np.ndarray
+    camera_id: int
+    received_at: float
@@ -1,11 +1,29 @@
 import math
 from abc import ABC, abstractmethod
-from typing import Type, TypeVar
+from typing import Iterable, Optional, Tuple, Type, TypeVar, Union
 
 import numpy as np
 
 T = TypeVar("T", bound="VectorBase")
 
+# Results of vector-vector arithmetic are already floats, so they skip __init__'s float() conversions.
+_new = object.__new__
+
+
+def _vec2(x: float, y: float) -> "Vector2D":
+    v = _new(Vector2D)
+    v.x = x
+    v.y = y
+    return v
+
+
+def _vec3(x: float, y: float, z: float) -> "Vector3D":
+    v = _new(Vector3D)
+    v.x = x
+    v.y = y
+    v.z = z
+    return v
+
 
 class VectorBase(ABC):
     __slots__ = ("x", "y")
@@ -69,8 +87,10 @@ class Vector2D(VectorBase):
         self.y = float(y)
 
     def __iter__(self):
-        yield self.x
-        yield self.y
+        return iter((self.x, self.y))
+
+    def __len__(self) -> int:
+        return 2
 
     def __getitem__(self, index: int) -> float:
         if index == 0:
@@ -80,10 +100,10 @@ class Vector2D(VectorBase):
         raise IndexError("Vector2D index out of range")
 
     def __add__(self, other: "Vector2D") -> "Vector2D":
-        return Vector2D(self.x + other.x, self.y + other.y)
+        return _vec2(self.x + other.x, self.y + other.y)
 
     def __sub__(self, other: "Vector2D") -> "Vector2D":
-        return Vector2D(self.x - other.x, self.y - other.y)
+        return _vec2(self.x - other.x, self.y - other.y)
 
     def __mul__(self, scalar: float) -> "Vector2D":
         return Vector2D(self.x * scalar, self.y * scalar)
@@ -115,7 +135,7 @@ class Vector2D(VectorBase):
         return Vector2D(self.x / scalar, self.y / scalar)
 
     def __neg__(self) -> "Vector2D":
-        return Vector2D(-self.x, -self.y)
+        return _vec2(-self.x, -self.y)
 
     def __eq__(self, other: object) -> bool:
         if not isinstance(other, Vector2D):
@@ -125,15 +145,18 @@ class Vector2D(VectorBase):
     def __array__(self, dtype=None, copy=True):
         return np.array([self.x, self.y], dtype=dtype, copy=copy)
 
+    def to_array(self) -> np.ndarray:
+        return np.array((self.x, self.y))
+
     def mag(self) -> float:
         return math.hypot(self.x, self.y)
 
     def norm(self) -> "Vector2D":
         """Return a normalized copy of the vector. Returns zero vector if magnitude is too small."""
-        magnitude = self.mag()
+        magnitude = math.hypot(self.x, self.y)
         if magnitude < 1e-8:
-            return Vector2D(0.0, 0.0)
-        return Vector2D(self.x / magnitude, self.y / magnitude)
+            return _vec2(0.0, 0.0)
+        return _vec2(self.x / magnitude, self.y / magnitude)
 
     def __repr__(self):
         return f"Vector2D(x={self.x}, y={self.y})"
@@ -148,9 +171,10 @@ class Vector3D(VectorBase):
         self.z = float(coords[2])
 
     def __iter__(self):
-        yield self.x
-        yield self.y
-        yield self.z
+        return iter((self.x, self.y, self.z))
+
+    def __len__(self) -> int:
+        return 3
 
     def __getitem__(self, index: int) -> float:
         if index == 0:
@@ -162,10 +186,10 @@ class Vector3D(VectorBase):
         raise IndexError("Vector3D index out of range")
 
     def __add__(self, other: "Vector3D") -> "Vector3D":
-        return Vector3D(self.x + other.x, self.y + other.y, self.z + other.z)
+        return _vec3(self.x + other.x, self.y + other.y, self.z + other.z)
 
     def __sub__(self, other: "Vector3D") -> "Vector3D":
-        return Vector3D(self.x - other.x, self.y - other.y, self.z - other.z)
+        return _vec3(self.x - other.x, self.y - other.y, self.z - other.z)
 
     def __mul__(self, scalar: float) -> "Vector3D":
         return Vector3D(self.x * scalar, self.y * scalar, self.z * scalar)
@@ -201,7 +225,7 @@ class Vector3D(VectorBase):
         return Vector3D(self.x / scalar, self.y / scalar, self.z / scalar)
 
     def __neg__(self) -> "Vector3D":
-        return Vector3D(-self.x, -self.y, -self.z)
+        return _vec3(-self.x, -self.y, -self.z)
 
     def __eq__(self, other: object) -> bool:
         if not isinstance(other, Vector3D):
@@ -211,23 +235,192 @@ class Vector3D(VectorBase):
     def __array__(self, dtype=None, copy=True):
         return np.array([self.x, self.y, self.z], dtype=dtype, copy=copy)
 
+    def to_array(self) -> np.ndarray:
+        return np.array((self.x, self.y, self.z))
+
     def mag(self) -> float:
-        return math.sqrt(self.x**2 + self.y**2 + self.z**2)
+        return math.hypot(self.x, self.y, self.z)
 
     def norm(self) -> "Vector3D":
         """Return a normalized copy of the vector. Returns zero vector if magnitude is too small."""
-        magnitude = self.mag()
+        magnitude = math.hypot(self.x, self.y, self.z)
         if magnitude < 1e-8:
-            return Vector3D(0.0, 0.0, 0.0)
-        return Vector3D(self.x / magnitude, self.y / magnitude, self.z / magnitude)
+            return _vec3(0.0, 0.0, 0.0)
+        return _vec3(self.x / magnitude, self.y / magnitude, self.z / magnitude)
 
     def to_2d(self) -> Vector2D:
-        return Vector2D(self.x, self.y)
+        return _vec2(self.x, self.y)
 
     def __repr__(self):
         return f"Vector3D(x={self.x}, y={self.y}, z={self.z})"
 
 
+Operand = Union["VectorArray", VectorBase, np.ndarray, float]
+
+
+class VectorArray:
+    """A contiguous (n, 2) or (n, 3) block of vectors, e.g. the positions of a whole team.
+
+    Arithmetic and geometry run as single NumPy calls over all rows instead of one ``Vector2D`` operation per robot.
+    Operands may be another ``VectorArray`` (row-wise), a single vector (broadcast to every row), a plain array, or
+    a scalar. Indexing with an int returns a ``Vector2D``/``Vector3D``; slices and masks return a ``VectorArray``
+    viewing the same data.
+    """
+
+    __slots__ = ("data",)
+
+    def __init__(self, data):
+        data = np.asarray(data, dtype=float)
+        if data.ndim == 1 and data.size == 0:
+            data = data.reshape(0, 2)
+        if data.ndim != 2 or data.shape[1] not in (2, 3):
+            raise ValueError(f"VectorArray expects an (n, 2) or (n, 3) array, got shape {data.shape}")
+        self.data = data
+
+    @classmethod
+    def from_vectors(cls, vectors: Iterable[VectorBase], dim: int = 2) -> "VectorArray":
+        """Packs vectors into one array, keeping the first ``dim`` components of each."""
+        if dim == 2:
+            flat = [c for v in vectors for c in (v.x, v.y)]
+        else:
+            flat = [c for v in vectors for c in (v.x, v.y, v.z)]
+        return cls(np.array(flat, dtype=float).reshape(-1, dim))
+
+    @classmethod
+    def from_objects(cls, objects: Iterable, attr: str = "p", dim: int = 2) -> "VectorArray":
+        """Packs one vector attribute (``p``, ``v``, ``a``) of robots or balls. Missing (None) values become zero."""
+        if isinstance(objects, dict):
+            objects = objects.values()
+        vectors = [getattr(o, attr) for o in objects]
+        zero = Vector3D(0.0, 0.0, 0.0)
+        return cls.from_vectors((zero if v is None else v for v in vectors), dim)
+
+    @property
+    def dim(self) -> int:
+        return self.data.shape[1]
+
+    @property
+    def x(self) -> np.ndarray:
+        return self.data[:, 0]
+
+    @property
+    def y(self) -> np.ndarray:
+        return self.data[:, 1]
+
+    @property
+    def z(self) -> np.ndarray:
+        if self.dim < 3:
+            raise AttributeError("2D VectorArray has no z component")
+        return self.data[:, 2]
+
+    def __len__(self) -> int:
+        return self.data.shape[0]
+
+    def __getitem__(self, index):
+        if isinstance(index, (int, np.integer)):
+            row = self.data[index]
+            if self.dim == 2:
+                return _vec2(float(row[0]), float(row[1]))
+            return _vec3(float(row[0]), float(row[1]), float(row[2]))
+        return VectorArray(self.data[index])
+
+    def __iter__(self):
+        for i in range(len(self)):
+            yield self[i]
+
+    def __array__(self, dtype=None, copy=None):
+        if dtype is None and not copy:
+            return self.data
+        return np.array(self.data, dtype=dtype, copy=True)
+
+    def to_array(self) -> np.ndarray:
+        return self.data
+
+    def to_2d(self) -> "VectorArray":
+        return self if self.dim == 2 else VectorArray(self.data[:, :2])
+
+    def _operand(self, other: Operand):
+        # Single vectors broadcast across rows; arrays and VectorArrays combine row-wise.
+        if isinstance(other, VectorArray):
+            return other.data
+        if isinstance(other, VectorBase):
+            return other.to_array()[: self.dim]
+        return other
+
+    @staticmethod
+    def _scalars(other):
+        # Per-row scalars (n,) must broadcast over the component axis.
+        other = np.asarray(other, dtype=float)
+        return other[:, None] if other.ndim == 1 else other
+
+    def __add__(self, other: Operand) -> "VectorArray":
+        return VectorArray(self.data + self._operand(other))
+
+    __radd__ = __add__
+
+    def __sub__(self, other: Operand) -> "VectorArray":
+        return VectorArray(self.data - self._operand(other))
+
+    def __rsub__(self, other: Operand) -> "VectorArray":
+        return VectorArray(self._operand(other) - self.data)
+
+    def __mul__(self, scalar) -> "VectorArray":
+        return VectorArray(self.data * self._scalars(scalar))
+
+    __rmul__ = __mul__
+
+    def __truediv__(self, scalar) -> "VectorArray":
+        return VectorArray(self.data / self._scalars(scalar))
+
+    def __neg__(self) -> "VectorArray":
+        return VectorArray(-self.data)
+
+    def mag(self) -> np.ndarray:
+        """Magnitude of each row."""
+        return np.sqrt(np.einsum("ij,ij->i", self.data, self.data))
+
+    def norm(self) -> "VectorArray":
+        """Row-normalised copy; rows with magnitude below 1e-8 become zero, as in ``Vector2D.norm``."""
+        mags = self.mag()
+        out = np.zeros_like(self.data)
+        ok = mags >= 1e-8
+        out[ok] = self.data[ok] / mags[ok, None]
+        return VectorArray(out)
+
+    def dot(self, other: Operand) -> np.ndarray:
+        """2D: Row-wise dot product using only x and y, like ``VectorBase.dot``."""
+        other = np.broadcast_to(self._operand(other), self.data.shape)
+        return self.data[:, 0] * other[:, 0] + self.data[:, 1] * other[:, 1]
+
+    def distance_to(self, other: Operand) -> np.ndarray:
+        """2D: Distance from each row to ``other`` (one vector, or row-wise for another array)."""
+        other = np.broadcast_to(self._operand(other), self.data.shape)
+        return np.hypot(other[:, 0] - self.data[:, 0], other[:, 1] - self.data[:, 1])
+
+    def angle_to(self, other: Operand) -> np.ndarray:
+        """2D: Angle from each row to ``other`` in radians, like ``VectorBase.angle_to``."""
+        other = np.broadcast_to(self._operand(other), self.data.shape)
+        return np.arctan2(other[:, 1] - self.data[:, 1], other[:, 0] - self.data[:, 0])
+
+    def pairwise_distances(self, other: Optional["VectorArray"] = None) -> np.ndarray:
+        """2D: (n, m) distances between every row of self and every row of ``other`` (defaults to self)."""
+        a = self.data[:, :2]
+        b = a if other is None else other.data[:, :2]
+        diff = a[:, None, :] - b[None, :, :]
+        return np.hypot(diff[..., 0], diff[..., 1])
+
+    def nearest(self, point: Union[VectorBase, np.ndarray]) -> Tuple[int, float]:
+        """2D: Index of and distance to the row closest to ``point``. Returns (-1, inf) when empty."""
+        if len(self) == 0:
+            return -1, math.inf
+        distances = self.distance_to(point)
+        index = int(np.argmin(distances))
+        return index, float(distances[index])
+
+    def __repr__(self):
+        return f"VectorArray({self.data.tolist()})"
+
+
 if __name__ == "__main__":
     import numpy as np
 
@@ -1,15 +1,22 @@
 from dataclasses import dataclass, field
-from typing import Optional
+from typing import TYPE_CHECKING, Optional
 
 from utama_core.entities.data.object import ObjectKey, ObjectType, TeamType
 from utama_core.entities.game.game_frame import GameFrame
 from utama_core.entities.game.proximity_lookup import ProximityLookup
 
+if TYPE_CHECKING:
+    from utama_core.motion_planning.src.planning.obstacle_snapshot import (
+        ObstacleSnapshot,
+    )
+
 
 @dataclass(frozen=True)
 class CurrentGameFrame(GameFrame):
     robot_with_ball: Optional[ObjectKey] = field(init=False)
     proximity_lookup: ProximityLookup = field(init=False)
+    # Filled in by ObstacleSnapshot.for_game on first use, so every planner shares one snapshot per frame.
+    obstacle_snapshot: Optional["ObstacleSnapshot"] = field(init=False, repr=False, compare=False)
 
     def __init__(self, game: GameFrame):
         object.__setattr__(self, "ts", game.ts)
@@ -21,6 +28,7 @@ class CurrentGameFrame(GameFrame):
         object.__setattr__(self, "referee", game.referee)
         object.__setattr__(self, "robot_with_ball", self._set_robot_with_ball(game))
         object.__setattr__(self, "proximity_lookup", self._init_proximity_lookup(game))
+        object.__setattr__(self, "obstacle_snapshot", None)
 
     def _set_robot_with_ball(self, game: GameFrame) -> ObjectKey:
         """Initialize the robot_with_ball attribute based on the current state of the game.
@@ -40,7 +48,7 @@ class CurrentGameFrame(GameFrame):
         """Initialize the proximity map for the game.
 
         The proximity map contains the positions of all robots and the ball. It is used to lookup distances between
-        objects in the game.
+        objects in the game, and only builds its point array when first queried.
         """
         return ProximityLookup(
             friendly_robots=game.friendly_robots,
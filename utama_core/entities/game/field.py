@@ -1,7 +1,9 @@
 from dataclasses import dataclass
+from functools import cached_property
 
 import numpy as np
 
+from utama_core.config.field_geometry import FieldGeometry, field_geometry
 from utama_core.config.field_params import FieldBounds, FieldDimensions
 
 
@@ -24,6 +26,27 @@ class Field:
         self._half_length = (field_bounds.bottom_right[0] - field_bounds.top_left[0]) / 2
         self._half_width = (field_bounds.top_left[1] - field_bounds.bottom_right[1]) / 2
 
+    @cached_property
+    def geometry(self) -> FieldGeometry:
+        """Shapes and lookup tables for the full field, shared with every Field of the same size."""
+        dims = self._field_dims
+        return field_geometry(
+            dims.full_field_half_length,
+            dims.full_field_half_width,
+            dims.half_goal_width,
+            dims.half_defense_area_depth,
+            dims.half_defense_area_width,
+            dims.goal_depth,
+        )
+
+    @property
+    def my_goal_x(self) -> float:
+        return self.geometry.goal_x(self.my_team_is_right)
+
+    @property
+    def enemy_goal_x(self) -> float:
+        return self.geometry.goal_x(not self.my_team_is_right)
+
     @property
     def includes_left_goal(self) -> bool:
         return self._field_bounds.top_left[0] == -self._field_dims.full_field_half_length and (
@@ -1,8 +1,16 @@
+from typing import TYPE_CHECKING, Optional
+
 from utama_core.entities.game.current_game_frame import CurrentGameFrame
 from utama_core.entities.game.field import Field
 from utama_core.entities.game.game_frame import GameFrame
 from utama_core.entities.game.game_history import GameHistory
 
+if TYPE_CHECKING:
+    from utama_core.data_processing.predictors.position import (
+        BallPredictor,
+        BallTrajectory,
+    )
+
 
 class Game:
     def __init__(self, past: GameHistory, current: GameFrame, field: Field):
@@ -10,13 +18,32 @@ class Game:
         self._current_game_standard_frame = current
         self.current = CurrentGameFrame(current)
         self._field = field
+        self._ball_predictor: Optional["BallPredictor"] = None
+        self._ball_trajectory: Optional["BallTrajectory"] = None
+        self._ball_trajectory_ready = False
 
     def add_game_frame(self, game_frame: GameFrame):
         self.__past.add_game_frame(self._current_game_standard_frame)
         self._current_game_standard_frame = game_frame
         self.current = CurrentGameFrame(game_frame)
+        self._ball_trajectory = None
+        self._ball_trajectory_ready = False
+
+    @property
+    def ball_trajectory(self) -> Optional["BallTrajectory"]:
+        """Predicted ball path for the current frame, or None without a ball.
+
+        Built on first use and shared by every caller until the next frame.
+        """
+        if not self._ball_trajectory_ready:
+            if self._ball_predictor is None:
+                # Imported here because the predictors depend on the entities package.
+                from utama_core.data_processing.predictors.position import BallPredictor
 
-    # def predict_/
+                self._ball_predictor = BallPredictor()
+            self._ball_trajectory = self._ball_predictor.predict(self.ball, self.ts, self.__past)
+            self._ball_trajectory_ready = True
+        return self._ball_trajectory
 
     @property
     def ts(self) -> float:
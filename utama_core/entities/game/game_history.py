@@ -1,13 +1,12 @@
 import logging
 from collections import deque
 from enum import Enum, auto
-from itertools import islice
-from typing import Any, Dict, List, Optional, Tuple, Union
+from typing import Any, Dict, Optional, Tuple
 
 import numpy as np
 
+from utama_core.config.physical_constants import ROBOT_ID_SLOTS
 from utama_core.entities.data.object import ObjectKey, ObjectType, TeamType
-from utama_core.entities.data.vector import Vector2D, Vector3D
 from utama_core.entities.game.game_frame import Ball, GameFrame, Robot
 
 logger = logging.getLogger(__name__)
@@ -29,82 +28,136 @@ def get_structured_object_key(obj: Any, team: TeamType) -> Optional[ObjectKey]:
     return None
 
 
-# Helper to convert Vector to NumPy array
-def _vector_to_numpy(vector: Union[Vector2D, Vector3D]) -> np.ndarray:
-    if isinstance(vector, Vector2D):
-        return np.array([vector.x, vector.y], dtype=np.float64)
-    elif isinstance(vector, Vector3D):
-        return np.array([vector.x, vector.y, vector.z], dtype=np.float64)
-    raise TypeError(f"Unsupported vector type for NumPy conversion: {type(vector)}")
+# --- Object slot layout ---
+# Every tracked object owns a fixed column in the history buffers:
+#   slot 0                      -> ball
+#   slots 1 .. ROBOT_ID_SLOTS   -> friendly robots by id
+#   the next ROBOT_ID_SLOTS     -> enemy robots by id
+BALL_SLOT = 0
+FRIENDLY_SLOT_OFFSET = 1
+ENEMY_SLOT_OFFSET = FRIENDLY_SLOT_OFFSET + ROBOT_ID_SLOTS
+N_OBJECT_SLOTS = ENEMY_SLOT_OFFSET + ROBOT_ID_SLOTS
+HISTORY_DIMS = 3  # robots only use x, y; the ball also uses z
+
+_TEAM_SLOT_OFFSET = {TeamType.FRIENDLY: FRIENDLY_SLOT_OFFSET, TeamType.ENEMY: ENEMY_SLOT_OFFSET}
+
+
+def object_slot(object_key: ObjectKey) -> Optional[int]:
+    """Column of ``object_key`` in the history buffers, or None if it cannot be stored."""
+    if object_key.object_type == ObjectType.BALL:
+        return BALL_SLOT
+    offset = _TEAM_SLOT_OFFSET.get(object_key.team_type)
+    if offset is None or not 0 <= object_key.id < ROBOT_ID_SLOTS:
+        return None
+    return offset + object_key.id
+
+
+def _object_dims(object_key: ObjectKey) -> int:
+    return 3 if object_key.object_type == ObjectType.BALL else 2
+
+
+_EMPTY = np.array([], dtype=np.float64)
+_EMPTY.flags.writeable = False
 
 
 class GameHistory:
+    """History of refined game frames, stored struct-of-arrays.
+
+    Positions and velocities of every object live in preallocated
+    ``(2 * max_history, N_OBJECT_SLOTS, HISTORY_DIMS)`` ring buffers that share a single
+    timestamp column. Each frame is written twice, at ``i`` and ``i + max_history``, so the
+    most recent ``n <= max_history`` frames are always a contiguous slice and series queries
+    can return views instead of building new arrays.
+
+    ``max_history`` counts frames, not observations: an object seen in only some frames keeps
+    just the samples from the last ``max_history`` frames. (The per-object deques this replaced
+    kept each object's last ``max_history`` observations however old.) Estimates for
+    intermittently seen robots or the ball therefore work from fewer, but recent, samples.
+    """
+
     def __init__(self, max_history: int):
+        if max_history < 1:
+            raise ValueError(f"max_history must be at least 1, got {max_history}.")
         self.max_history = max_history
         self.raw_games_history: deque[GameFrame] = deque(maxlen=max_history)
 
-        # Generic historical data storage:
-        # ObjectKey -> AttributeType -> deque[(timestamp: float, value: np.ndarray)]
-        self.historical_data: Dict[ObjectKey, Dict[AttributeType, deque[Tuple[float, np.ndarray]]]] = {}
-
-    def _ensure_attribute_deque_exists(self, object_key: ObjectKey, attribute_type: AttributeType):
-        """Ensures a deque exists for the given object_key and attribute_type."""
-        if object_key not in self.historical_data:
-            self.historical_data[object_key] = {}
-        if attribute_type not in self.historical_data[object_key]:
-            self.historical_data[object_key][attribute_type] = deque(maxlen=self.max_history)
-
-    def _add_attribute_to_history(
-        self,
-        object_key: ObjectKey,
-        attribute_type: AttributeType,
-        timestamp: float,
-        value_vector_obj: Optional[Union[Vector2D, Vector3D]],
-    ):
-        """Adds a single attribute value (after converting to NumPy) to the history."""
-        if value_vector_obj is None:
-            return  # Don't store None values, or decide on a specific handling
-
-        self._ensure_attribute_deque_exists(object_key, attribute_type)
-        try:
-            value_np = _vector_to_numpy(value_vector_obj)
-            self.historical_data[object_key][attribute_type].append((timestamp, value_np))
-        except TypeError as e:
-            logger.error(f"Error converting vector for {object_key}, {attribute_type}: {e}")
-
-    def _process_entity_for_history(self, entity: Any, entity_key: ObjectKey, timestamp: float):
-        """Helper to process position and velocity for a given entity."""
-        if not entity_key:
-            return
-
-        if hasattr(entity, "p"):
-            self._add_attribute_to_history(entity_key, AttributeType.POSITION, timestamp, entity.p)
-        if hasattr(entity, "v"):
-            self._add_attribute_to_history(entity_key, AttributeType.VELOCITY, timestamp, entity.v)
-        # If you pre-calculate and store acceleration:
-        # if hasattr(entity, "a"):
-        #     self._add_attribute_to_history(entity_key, AttributeType.ACCELERATION, timestamp, entity.a)
+        rows = 2 * max_history
+        self._timestamps = np.zeros(rows, dtype=np.float64)
+        self._values: Dict[AttributeType, np.ndarray] = {
+            attr: np.zeros((rows, N_OBJECT_SLOTS, HISTORY_DIMS), dtype=np.float64) for attr in AttributeType
+        }
+        self._valid: Dict[AttributeType, np.ndarray] = {
+            attr: np.zeros((rows, N_OBJECT_SLOTS), dtype=bool) for attr in AttributeType
+        }
+        self._n_frames = 0  # total frames ever added
+
+    @property
+    def n_stored(self) -> int:
+        """Number of frames currently held in the buffers."""
+        return min(self._n_frames, self.max_history)
+
+    def _window(self, num_points: int) -> slice:
+        """Slice (into the doubled buffers) covering the last ``num_points`` stored frames."""
+        end = (self._n_frames - 1) % self.max_history + self.max_history + 1
+        return slice(end - num_points, end)
+
+    def _write(self, row: int, slot: int, entity: Any, dims: int):
+        for attr, vec in ((AttributeType.POSITION, entity.p), (AttributeType.VELOCITY, entity.v)):
+            valid = vec is not None
+            self._valid[attr][row, slot] = valid
+            self._valid[attr][row + self.max_history, slot] = valid
+            if not valid:
+                continue
+            values = self._values[attr]
+            values[row, slot, 0] = values[row + self.max_history, slot, 0] = vec.x
+            values[row, slot, 1] = values[row + self.max_history, slot, 1] = vec.y
+            if dims == 3:
+                values[row, slot, 2] = values[row + self.max_history, slot, 2] = vec.z
 
     def add_game_frame(self, game: GameFrame):
         self.raw_games_history.append(game)
-        current_ts = game.ts
 
-        # Process Ball
+        row = self._n_frames % self.max_history
+        mirror = row + self.max_history
+        self._timestamps[row] = self._timestamps[mirror] = game.ts
+        for valid in self._valid.values():
+            valid[row] = False
+            valid[mirror] = False
+
         if game.ball:
-            ball_key = get_structured_object_key(game.ball, TeamType.NEUTRAL)  # Ball is neutral
-            if ball_key:
-                self._process_entity_for_history(game.ball, ball_key, current_ts)
-
-        # Process Robots (Friendly and Enemy)
-        robot_groups = [
-            (game.friendly_robots, TeamType.FRIENDLY),
-            (game.enemy_robots, TeamType.ENEMY),
-        ]
-        for robots_dict, team_type in robot_groups:
-            for robot_instance in robots_dict.values():
-                robot_key = get_structured_object_key(robot_instance, team_type)
-                if robot_key:
-                    self._process_entity_for_history(robot_instance, robot_key, current_ts)
+            self._write(row, BALL_SLOT, game.ball, dims=3)
+
+        for robots_dict, offset in (
+            (game.friendly_robots, FRIENDLY_SLOT_OFFSET),
+            (game.enemy_robots, ENEMY_SLOT_OFFSET),
+        ):
+            for robot_id, robot in robots_dict.items():
+                if not 0 <= robot_id < ROBOT_ID_SLOTS:
+                    logger.warning(f"Robot id {robot_id} is outside the {ROBOT_ID_SLOTS} history slots; skipping.")
+                    continue
+                self._write(row, offset + robot_id, robot, dims=2)
+
+        self._n_frames += 1
+
+    def get_attribute_window(
+        self, attribute_type: AttributeType, num_points: int
+    ) -> Tuple[np.ndarray, np.ndarray, np.ndarray]:
+        """Last ``num_points`` frames of ``attribute_type`` for every object slot at once.
+
+        Returns:
+            ``(timestamps, values, valid)`` views of shape ``(n,)``, ``(n, N_OBJECT_SLOTS, HISTORY_DIMS)``
+            and ``(n, N_OBJECT_SLOTS)``, oldest to newest, where ``n = min(num_points, n_stored)``.
+            The views are only valid until the next ``add_game_frame``.
+        """
+        n = min(num_points, self.n_stored)
+        if n <= 0:
+            return (
+                _EMPTY,
+                np.empty((0, N_OBJECT_SLOTS, HISTORY_DIMS)),
+                np.empty((0, N_OBJECT_SLOTS), dtype=bool),
+            )
+        window = self._window(n)
+        return self._timestamps[window], self._values[attribute_type][window], self._valid[attribute_type][window]
 
     def get_historical_attribute_series(
         self,
@@ -115,41 +168,33 @@ class GameHistory:
         """Retrieves the last num_points of (timestamp, attribute_value_np) for a given object.
 
         Returns data as NumPy arrays (timestamps, values), oldest to newest. Returns empty NumPy arrays if no data is
-        available.
+        available. When the object was recorded in every one of those frames the arrays are views into the
+        history buffers (valid until the next ``add_game_frame``); otherwise the recorded samples are gathered.
+        Only the last ``max_history`` frames are searched, so an object missing from some of them can return
+        fewer than ``num_points`` samples even if it was seen more often before that.
         """
-        if num_points <= 0:
-            return np.array([], dtype=np.float64), np.array([], dtype=np.float64)
-
-        object_attributes = self.historical_data.get(object_key)
-        if not object_attributes:
-            # logger.debug(f"No historical data for object_key {object_key}")
-            return np.array([], dtype=np.float64), np.array([], dtype=np.float64)
-
-        history_deque = object_attributes.get(attribute_type)
-        if not history_deque:  # Handles both key not found or empty deque
-            # logger.debug(f"No historical {attribute_type.name} for {object_key}")
-            return np.array([], dtype=np.float64), np.array([], dtype=np.float64)
-
-        # Efficiently get the last num_points using islice
-        start_index = max(0, len(history_deque) - num_points)
-        relevant_data_iter = islice(history_deque, start_index, len(history_deque))
-
-        timestamps_list: List[float] = []
-        vector_values_list: List[np.ndarray] = []
-
-        for ts, vec_np in relevant_data_iter:
-            timestamps_list.append(ts)
-            vector_values_list.append(vec_np)
-
-        if not timestamps_list:
-            return np.array([], dtype=np.float64), np.array([], dtype=np.float64)
-
-        timestamps_np = np.array(timestamps_list, dtype=np.float64)
-        # vector_values_list contains a list of small np.ndarrays.
-        # np.array() will create a 2D array if all elements of the list are 1D arrays of the same size.
-        values_np = np.array(vector_values_list)
-
-        return timestamps_np, values_np
+        if num_points <= 0 or self._n_frames == 0:
+            return _EMPTY, _EMPTY
+
+        slot = object_slot(object_key)
+        if slot is None:
+            return _EMPTY, _EMPTY
+        dims = _object_dims(object_key)
+
+        window = self._window(self.n_stored)
+        valid = self._valid[attribute_type][window, slot]
+        values = self._values[attribute_type][window, slot, :dims]
+        timestamps = self._timestamps[window]
+
+        n = min(num_points, valid.shape[0])
+        if valid[-n:].all():
+            return timestamps[-n:], values[-n:]
+
+        # The object was missing from some recent frames: fall back to its last recorded samples.
+        rows = np.flatnonzero(valid)[-num_points:]
+        if rows.size == 0:
+            return _EMPTY, _EMPTY
+        return timestamps[rows], values[rows]
 
     def n_steps_ago(self, n: int) -> GameFrame:
         if not (0 < n <= len(self.raw_games_history)):
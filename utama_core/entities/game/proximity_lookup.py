@@ -1,16 +1,25 @@
 import warnings
-from typing import Dict, List, Optional, Tuple
+from typing import Dict, List, Optional, Tuple, Union
 
 import numpy as np
 
 from utama_core.entities.data.object import ObjectKey, ObjectType, TeamType
-from utama_core.entities.data.vector import Vector2D
+from utama_core.entities.data.vector import VectorBase
 from utama_core.entities.game.ball import Ball
 from utama_core.entities.game.robot import Robot
 
+BALL_KEY = ObjectKey(TeamType.NEUTRAL, ObjectType.BALL, 0)
+
+Point = Union[VectorBase, Tuple[float, float], np.ndarray]
+
 
 class ProximityLookup:
-    """A proximity map that tracks the distance between robots and the ball."""
+    """A proximity map that tracks the distance between robots and the ball.
+
+    Nothing is computed until the first query: one is created for every frame, and most ticks never ask. Queries
+    then work on a single (n, 2) point array (friendly robots, enemy robots, ball) and rank on squared distances,
+    taking the square root only of the distances they return.
+    """
 
     def __init__(
         self,
@@ -18,102 +27,189 @@ class ProximityLookup:
         enemy_robots: Optional[Dict[int, Robot]],
         ball: Optional[Ball],
     ):
-        """Initialize the proximity map with a set of points.
-
-        :param point_array: A 2D numpy array where each row is a point in the format [x, y].
-        """
-        self.friendly_end_idx = len(friendly_robots) if friendly_robots else 0
-        self.enemy_end_idx = self.friendly_end_idx + len(enemy_robots) if enemy_robots else self.friendly_end_idx
-        self.object_keys, self.point_array = self._get_object_keys_and_point_array(friendly_robots, enemy_robots, ball)
-        self.key_index_map = {key: i for i, key in enumerate(self.object_keys)}
-        self.proximity_matrix = self._build_proximity_matrix(self.point_array)
-
-    def _get_object_keys_and_point_array(
-        self,
-        friendly_robots: Optional[Dict[int, Robot]],
-        enemy_robots: Optional[Dict[int, Robot]],
-        ball: Optional[Ball],
-    ) -> Tuple[List[ObjectKey], np.ndarray]:
-        object_keys: List[ObjectKey] = []
-        point_array: List[Vector2D] = []
-
-        if friendly_robots:
-            for robot in friendly_robots.values():
-                object_keys.append(ObjectKey(TeamType.FRIENDLY, ObjectType.ROBOT, robot.id))
-                point_array.append(robot.p.to_array())
-
-        if enemy_robots:
-            for robot in enemy_robots.values():
-                object_keys.append(ObjectKey(TeamType.ENEMY, ObjectType.ROBOT, robot.id))
-                point_array.append(robot.p.to_array())
-
-        if ball:
-            object_keys.append(ObjectKey(TeamType.NEUTRAL, ObjectType.BALL, 0))
-            point_array.append(ball.p.to_2d().to_array())
-
-        return object_keys, np.array(point_array)
-
-    # Optimisation: could potentially store np.dot for ranking purposes,
-    # then sqrt only when querying (profile to see if this is worth it)
-    def _build_proximity_matrix(self, point_array: np.ndarray) -> np.ndarray:
-        """Build the pairwise Euclidean distance matrix between all objects."""
-        if point_array.size < 2:
-            return None
-
-        diffs = point_array[:, np.newaxis, :] - point_array[np.newaxis, :, :]  # (n, n, 2)
-        dist_matrix = np.linalg.norm(diffs, axis=-1)  # (n, n)
-        np.fill_diagonal(dist_matrix, np.inf)  # Exclude self-comparison
-        return dist_matrix
-
-    def _closest_to_index(
-        self,
-        source_index: int,
-        team_type_filter: Optional[TeamType] = None,
-    ) -> Tuple[Optional[ObjectKey], float]:
-        """Generalized helper to find the closest object to a given index, filtered by team type."""
-        if self.proximity_matrix is None:
-            warnings.warn("Proximity matrix is empty, cannot compute closest object.")
-            return (None, np.inf)
-
-        distances = self.proximity_matrix[source_index]
-
-        # Determine slice based on team
+        self._friendly_robots = friendly_robots or {}
+        self._enemy_robots = enemy_robots or {}
+        self._ball = ball
+
+        self.friendly_end_idx = len(self._friendly_robots)
+        self.enemy_end_idx = self.friendly_end_idx + len(self._enemy_robots)
+
+        self._object_keys: Optional[List[ObjectKey]] = None
+        self._point_array: Optional[np.ndarray] = None
+        self._key_index_map: Optional[Dict[ObjectKey, int]] = None
+        self._proximity_matrix: Optional[np.ndarray] = None
+
+    @property
+    def object_keys(self) -> List[ObjectKey]:
+        if self._object_keys is None:
+            self._build()
+        return self._object_keys
+
+    @property
+    def point_array(self) -> np.ndarray:
+        if self._point_array is None:
+            self._build()
+        return self._point_array
+
+    @property
+    def key_index_map(self) -> Dict[ObjectKey, int]:
+        if self._key_index_map is None:
+            self._key_index_map = {key: i for i, key in enumerate(self.object_keys)}
+        return self._key_index_map
+
+    @property
+    def proximity_matrix(self) -> Optional[np.ndarray]:
+        """Pairwise Euclidean distances between all objects, with inf on the diagonal. None without objects."""
+        if self._proximity_matrix is None and self.point_array.size >= 2:
+            points = self.point_array
+            diffs = points[:, np.newaxis, :] - points[np.newaxis, :, :]
+            sq = np.einsum("ijk,ijk->ij", diffs, diffs)
+            np.fill_diagonal(sq, np.inf)
+            self._proximity_matrix = np.sqrt(sq)
+        return self._proximity_matrix
+
+    def _build(self):
+        """Packs all positions into one array in a single pass, without per-robot temporary arrays."""
+        keys: List[ObjectKey] = []
+        coords: List[float] = []
+        for robot in self._friendly_robots.values():
+            keys.append(ObjectKey(TeamType.FRIENDLY, ObjectType.ROBOT, robot.id))
+            coords += (robot.p.x, robot.p.y)
+        for robot in self._enemy_robots.values():
+            keys.append(ObjectKey(TeamType.ENEMY, ObjectType.ROBOT, robot.id))
+            coords += (robot.p.x, robot.p.y)
+        if self._ball:
+            keys.append(BALL_KEY)
+            coords += (self._ball.p.x, self._ball.p.y)
+
+        self._object_keys = keys
+        self._point_array = np.array(coords, dtype=float).reshape(-1, 2)
+
+    def _team_range(self, team_type_filter: Optional[TeamType]) -> Tuple[int, int]:
+        """Index range of the robots matching the filter. The ball is never a candidate."""
         if team_type_filter == TeamType.FRIENDLY:
-            if self.friendly_end_idx == 0:
-                return (None, np.inf)
-            sub_distances = distances[: self.friendly_end_idx]
-            offset = 0
-        elif team_type_filter == TeamType.ENEMY:
-            if self.enemy_end_idx == self.friendly_end_idx:
-                return (None, np.inf)
-            sub_distances = distances[self.friendly_end_idx : self.enemy_end_idx]
-            offset = self.friendly_end_idx
+            return 0, self.friendly_end_idx
+        if team_type_filter == TeamType.ENEMY:
+            return self.friendly_end_idx, self.enemy_end_idx
+        return 0, self.enemy_end_idx
+
+    def _squared_distances(self, source: Union[int, Point], team_type_filter: Optional[TeamType]):
+        """Squared distances from an object index or a point to the candidate robots, and the range's offset."""
+        lo, hi = self._team_range(team_type_filter)
+        candidates = self.point_array[lo:hi]
+        if isinstance(source, (int, np.integer)):
+            origin = self.point_array[source]
         else:
-            if self.enemy_end_idx == 0:
-                return (None, np.inf)
-            sub_distances = distances[: self.enemy_end_idx]
-            offset = 0
-
-        closest_relative_index = np.argmin(sub_distances)
-        closest_absolute_index = offset + closest_relative_index
-        closest_distance = sub_distances[closest_relative_index]
+            origin = np.array((float(source[0]), float(source[1])))
+        diff = candidates - origin
+        sq = np.einsum("ij,ij->i", diff, diff)
+        if isinstance(source, (int, np.integer)) and lo <= source < hi:
+            sq[source - lo] = np.inf  # Exclude self-comparison
+        return sq, lo
+
+    def _closest(
+        self, source: Union[int, Point], team_type_filter: Optional[TeamType]
+    ) -> Tuple[Optional[ObjectKey], float]:
+        sq, offset = self._squared_distances(source, team_type_filter)
+        if sq.size == 0:
+            return (None, np.inf)
+        index = int(np.argmin(sq))
+        if not np.isfinite(sq[index]):
+            return (None, np.inf)  # only the source itself matched the filter
+        return self.object_keys[offset + index], float(np.sqrt(sq[index]))
+
+    def _k_nearest(
+        self, source: Union[int, Point], k: int, team_type_filter: Optional[TeamType]
+    ) -> List[Tuple[ObjectKey, float]]:
+        sq, offset = self._squared_distances(source, team_type_filter)
+        k = min(k, sq.size)
+        if k <= 0:
+            return []
+        order = np.argpartition(sq, k - 1)[:k] if k < sq.size else np.arange(sq.size)
+        order = order[np.argsort(sq[order], kind="stable")]
+        return [(self.object_keys[offset + i], float(np.sqrt(sq[i]))) for i in order if np.isfinite(sq[i])]
+
+    def _within_radius(
+        self, source: Union[int, Point], radius: float, team_type_filter: Optional[TeamType]
+    ) -> List[Tuple[ObjectKey, float]]:
+        sq, offset = self._squared_distances(source, team_type_filter)
+        (inside,) = np.nonzero(sq <= radius * radius)
+        inside = inside[np.argsort(sq[inside], kind="stable")]
+        return [(self.object_keys[offset + i], float(np.sqrt(sq[i]))) for i in inside]
+
+    def _ball_index(self) -> Optional[int]:
+        if not self.object_keys or self.object_keys[-1].object_type != ObjectType.BALL:
+            warnings.warn("Invalid closest_to_ball query: cannot find ball in proximity lookup.")
+            return None
+        return len(self.object_keys) - 1
 
-        return self.object_keys[closest_absolute_index], closest_distance
+    def _robot_index(self, robot_key: ObjectKey) -> Optional[int]:
+        if robot_key not in self.key_index_map:
+            warnings.warn(f"Robot {robot_key} not found in proximity lookup.")
+            return None
+        return self.key_index_map[robot_key]
 
     def closest_to_ball(self, team_type_filter: Optional[TeamType] = None) -> Tuple[Optional[ObjectKey], float]:
-        if not self.object_keys or self.object_keys[-1].object_type != ObjectType.BALL:
-            warnings.warn("Invalid closest_to_ball query: cannot find ball in proximity lookup.")
+        ball_index = self._ball_index()
+        if ball_index is None:
             return (None, np.inf)
-
-        ball_index = len(self.object_keys) - 1
-        return self._closest_to_index(ball_index, team_type_filter)
+        return self._closest(ball_index, team_type_filter)
 
     def closest_to_robot(
         self, robot_key: ObjectKey, team_type_filter: Optional[TeamType] = None
     ) -> Tuple[Optional[ObjectKey], float]:
-        if robot_key not in self.key_index_map:
-            warnings.warn(f"Robot {robot_key} not found in proximity lookup.")
+        robot_index = self._robot_index(robot_key)
+        if robot_index is None:
             return (None, np.inf)
+        return self._closest(robot_index, team_type_filter)
 
-        robot_index = self.key_index_map[robot_key]
-        return self._closest_to_index(robot_index, team_type_filter)
+    def closest_to_point(
+        self, point: Point, team_type_filter: Optional[TeamType] = None
+    ) -> Tuple[Optional[ObjectKey], float]:
+        return self._closest(point, team_type_filter)
+
+    def k_nearest_to_ball(self, k: int, team_type_filter: Optional[TeamType] = None) -> List[Tuple[ObjectKey, float]]:
+        """Up to ``k`` robots closest to the ball as (key, distance), nearest first."""
+        ball_index = self._ball_index()
+        if ball_index is None:
+            return []
+        return self._k_nearest(ball_index, k, team_type_filter)
+
+    def k_nearest_to_robot(
+        self, robot_key: ObjectKey, k: int, team_type_filter: Optional[TeamType] = None
+    ) -> List[Tuple[ObjectKey, float]]:
+        """Up to ``k`` other robots closest to ``robot_key`` as (key, distance), nearest first."""
+        robot_index = self._robot_index(robot_key)
+        if robot_index is None:
+            return []
+        return self._k_nearest(robot_index, k, team_type_filter)
+
+    def k_nearest_to_point(
+        self, point: Point, k: int, team_type_filter: Optional[TeamType] = None
+    ) -> List[Tuple[ObjectKey, float]]:
+        """Up to ``k`` robots closest to ``point`` as (key, distance), nearest first."""
+        return self._k_nearest(point, k, team_type_filter)
+
+    def within_radius_of_ball(
+        self, radius: float, team_type_filter: Optional[TeamType] = None
+    ) -> List[Tuple[ObjectKey, float]]:
+        """Robots within ``radius`` of the ball as (key, distance), nearest first."""
+        ball_index = self._ball_index()
+        if ball_index is None:
+            return []
+        return self._within_radius(ball_index, radius, team_type_filter)
+
+    def within_radius_of_robot(
+        self, robot_key: ObjectKey, radius: float, team_type_filter: Optional[TeamType] = None
+    ) -> List[Tuple[ObjectKey, float]]:
+        """Other robots within ``radius`` of ``robot_key`` as (key, distance), nearest first."""
+        robot_index = self._robot_index(robot_key)
+        if robot_index is None:
+            return []
+        return self._within_radius(robot_index, radius, team_type_filter)
+
+    def within_radius_of_point(
+        self, point: Point, radius: float, team_type_filter: Optional[TeamType] = None
+    ) -> List[Tuple[ObjectKey, float]]:
+        """Robots within ``radius`` of ``point`` as (key, distance), nearest first."""
+        return self._within_radius(point, radius, team_type_filter)
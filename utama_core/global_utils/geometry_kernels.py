@@ -0,0 +1,402 @@
+"""Compiled 2D geometry kernels shared by ``math_utils`` and the motion-planning geometry helpers.
+
+The planners call point/segment/rectangle primitives thousands of times per tick on 2-element inputs, where NumPy's
+per-call overhead (array creation, ``np.dot`` dispatch, 0-d results) dominates the arithmetic. The scalar kernels
+here work on plain floats instead, and are compiled with numba's ``njit`` when numba is installed. Without numba they
+run as ordinary Python, which is still several times cheaper than the NumPy versions on 2-element arrays.
+
+The batched kernels take (n, 2) point arrays and (m, 4) ``min_x, max_x, min_y, max_y`` rectangle arrays. With numba
+they are compiled loops over the scalar kernels; without it they fall back to vectorised NumPy.
+
+Run ``python -m benchmarks.bench_geometry_kernels`` to compare per-call cost against the previous NumPy versions.
+"""
+
+import math
+from typing import Tuple
+
+import numpy as np
+
+try:
+    from numba import njit
+
+    HAVE_NUMBA = True
+except ImportError:  # pragma: no cover - depends on the environment
+    HAVE_NUMBA = False
+
+    def njit(*args, **kwargs):
+        """Stand-in for ``numba.njit`` that returns the function unchanged."""
+        if len(args) == 1 and callable(args[0]) and not kwargs:
+            return args[0]
+        return lambda func: func
+
+
+EPS = 1e-9
+
+
+# ---------- Scalar kernels ----------
+
+
+@njit(cache=True)
+def point_segment_distance(px: float, py: float, ax: float, ay: float, bx: float, by: float, eps: float = EPS) -> float:
+    """Distance from point p to segment a-b. Segments shorter than ``sqrt(eps)`` are treated as the point a."""
+    sx = bx - ax
+    sy = by - ay
+    denom = sx * sx + sy * sy
+    if denom < eps:
+        return math.hypot(px - ax, py - ay)
+    t = ((px - ax) * sx + (py - ay) * sy) / denom
+    t = min(1.0, max(0.0, t))
+    return math.hypot(px - (ax + t * sx), py - (ay + t * sy))
+
+
+@njit(cache=True)
+def closest_point_on_segment(
+    px: float, py: float, ax: float, ay: float, bx: float, by: float, eps: float = EPS
+) -> Tuple[float, float]:
+    """Point on segment a-b closest to p."""
+    sx = bx - ax
+    sy = by - ay
+    denom = sx * sx + sy * sy
+    if denom < eps:
+        return ax, ay
+    t = ((px - ax) * sx + (py - ay) * sy) / denom
+    if t < 0.0:
+        return ax, ay
+    if t > 1.0:
+        return bx, by
+    return ax + t * sx, ay + t * sy
+
+
+@njit(cache=True)
+def orientation(ax: float, ay: float, bx: float, by: float, cx: float, cy: float) -> float:
+    """Cross product of (b - a) and (c - a): positive if a, b, c turn counterclockwise, negative if clockwise."""
+    return (bx - ax) * (cy - ay) - (by - ay) * (cx - ax)
+
+
+@njit(cache=True)
+def _within_box(ax: float, ay: float, bx: float, by: float, cx: float, cy: float, eps: float) -> bool:
+    # b lies in the bounding box of a-c
+    return min(ax, cx) - eps <= bx <= max(ax, cx) + eps and min(ay, cy) - eps <= by <= max(ay, cy) + eps
+
+
+@njit(cache=True)
+def segments_intersect(
+    p1x: float,
+    p1y: float,
+    q1x: float,
+    q1y: float,
+    p2x: float,
+    p2y: float,
+    q2x: float,
+    q2y: float,
+    eps: float = EPS,
+) -> bool:
+    """True if the closed segments p1-q1 and p2-q2 intersect. Orientations within ``eps`` count as collinear."""
+    o1 = orientation(p1x, p1y, q1x, q1y, p2x, p2y)
+    o2 = orientation(p1x, p1y, q1x, q1y, q2x, q2y)
+    o3 = orientation(p2x, p2y, q2x, q2y, p1x, p1y)
+    o4 = orientation(p2x, p2y, q2x, q2y, q1x, q1y)
+
+    if ((o1 > eps and o2 < -eps) or (o1 < -eps and o2 > eps)) and (
+        (o3 > eps and o4 < -eps) or (o3 < -eps and o4 > eps)
+    ):
+        return True
+
+    if abs(o1) <= eps and _within_box(p1x, p1y, p2x, p2y, q1x, q1y, eps):
+        return True
+    if abs(o2) <= eps and _within_box(p1x, p1y, q2x, q2y, q1x, q1y, eps):
+        return True
+    if abs(o3) <= eps and _within_box(p2x, p2y, p1x, p1y, q2x, q2y, eps):
+        return True
+    if abs(o4) <= eps and _within_box(p2x, p2y, q1x, q1y, q2x, q2y, eps):
+        return True
+    return False
+
+
+@njit(cache=True)
+def segment_to_segment_distance(
+    a1x: float,
+    a1y: float,
+    a2x: float,
+    a2y: float,
+    b1x: float,
+    b1y: float,
+    b2x: float,
+    b2y: float,
+    eps: float = EPS,
+) -> float:
+    """Shortest distance between segments a1-a2 and b1-b2; zero if they intersect."""
+    if segments_intersect(a1x, a1y, a2x, a2y, b1x, b1y, b2x, b2y, eps):
+        return 0.0
+    return min(
+        point_segment_distance(a1x, a1y, b1x, b1y, b2x, b2y, eps),
+        point_segment_distance(a2x, a2y, b1x, b1y, b2x, b2y, eps),
+        point_segment_distance(b1x, b1y, a1x, a1y, a2x, a2y, eps),
+        point_segment_distance(b2x, b2y, a1x, a1y, a2x, a2y, eps),
+    )
+
+
+@njit(cache=True)
+def line_intersection(
+    ax: float,
+    ay: float,
+    bx: float,
+    by: float,
+    cx: float,
+    cy: float,
+    dx: float,
+    dy: float,
+    eps: float = EPS,
+) -> Tuple[bool, float, float]:
+    """Intersection of segments a-b and c-d as ``(found, x, y)``. Parallel segments never intersect."""
+    denom = (bx - ax) * (dy - cy) - (by - ay) * (dx - cx)
+    if abs(denom) < eps:
+        return False, 0.0, 0.0
+    t = ((cx - ax) * (dy - cy) - (cy - ay) * (dx - cx)) / denom
+    u = ((cx - ax) * (by - ay) - (cy - ay) * (bx - ax)) / denom
+    if -eps <= t <= 1.0 + eps and -eps <= u <= 1.0 + eps:
+        return True, ax + t * (bx - ax), ay + t * (by - ay)
+    return False, 0.0, 0.0
+
+
+@njit(cache=True)
+def point_rect_distance(px: float, py: float, min_x: float, max_x: float, min_y: float, max_y: float) -> float:
+    """Distance from p to an axis-aligned rectangle; zero inside it."""
+    dx = max(min_x - px, 0.0, px - max_x)
+    dy = max(min_y - py, 0.0, py - max_y)
+    return math.hypot(dx, dy)
+
+
+@njit(cache=True)
+def rect_segment_distance(
+    min_x: float,
+    max_x: float,
+    min_y: float,
+    max_y: float,
+    ax: float,
+    ay: float,
+    bx: float,
+    by: float,
+    eps: float = EPS,
+) -> float:
+    """Distance from segment a-b to an axis-aligned rectangle; zero if the segment touches or crosses it."""
+    if (min_x <= ax <= max_x and min_y <= ay <= max_y) or (min_x <= bx <= max_x and min_y <= by <= max_y):
+        return 0.0
+    best = min(
+        point_rect_distance(ax, ay, min_x, max_x, min_y, max_y),
+        point_rect_distance(bx, by, min_x, max_x, min_y, max_y),
+    )
+    best = min(best, segment_to_segment_distance(ax, ay, bx, by, min_x, min_y, max_x, min_y, eps))
+    best = min(best, segment_to_segment_distance(ax, ay, bx, by, max_x, min_y, max_x, max_y, eps))
+    best = min(best, segment_to_segment_distance(ax, ay, bx, by, max_x, max_y, min_x, max_y, eps))
+    best = min(best, segment_to_segment_distance(ax, ay, bx, by, min_x, max_y, min_x, min_y, eps))
+    return best
+
+
+# ---------- Batched kernels ----------
+
+
+@njit(cache=True)
+def _points_to_segment_distance_loop(points: np.ndarray, ax: float, ay: float, bx: float, by: float) -> np.ndarray:
+    out = np.empty(points.shape[0])
+    for i in range(points.shape[0]):
+        out[i] = point_segment_distance(points[i, 0], points[i, 1], ax, ay, bx, by, 1e-12)
+    return out
+
+
+@njit(cache=True)
+def _segments_to_segments_distance_loop(
+    a_starts: np.ndarray, a_ends: np.ndarray, b_starts: np.ndarray, b_ends: np.ndarray
+) -> np.ndarray:
+    out = np.empty((a_starts.shape[0], b_starts.shape[0]))
+    for i in range(a_starts.shape[0]):
+        for j in range(b_starts.shape[0]):
+            out[i, j] = segment_to_segment_distance(
+                a_starts[i, 0],
+                a_starts[i, 1],
+                a_ends[i, 0],
+                a_ends[i, 1],
+                b_starts[j, 0],
+                b_starts[j, 1],
+                b_ends[j, 0],
+                b_ends[j, 1],
+                EPS,
+            )
+    return out
+
+
+@njit(cache=True)
+def _rects_to_segments_distance_loop(rects: np.ndarray, starts: np.ndarray, ends: np.ndarray) -> np.ndarray:
+    out = np.empty((starts.shape[0], rects.shape[0]))
+    for i in range(starts.shape[0]):
+        for j in range(rects.shape[0]):
+            out[i, j] = rect_segment_distance(
+                rects[j, 0],
+                rects[j, 1],
+                rects[j, 2],
+                rects[j, 3],
+                starts[i, 0],
+                starts[i, 1],
+                ends[i, 0],
+                ends[i, 1],
+                1e-12,
+            )
+    return out
+
+
+def _points_to_segment_distance_numpy(points: np.ndarray, start: np.ndarray, end: np.ndarray) -> np.ndarray:
+    segment = end - start
+    denom = float(segment @ segment)
+    offsets = points - start
+    if denom < 1e-12:
+        return np.hypot(offsets[:, 0], offsets[:, 1])
+    t = np.clip(offsets @ segment / denom, 0.0, 1.0)
+    diff = offsets - t[:, None] * segment
+    return np.hypot(diff[:, 0], diff[:, 1])
+
+
+def _segments_to_segments_distance_numpy(
+    a_starts: np.ndarray, a_ends: np.ndarray, b_starts: np.ndarray, b_ends: np.ndarray
+) -> np.ndarray:
+    p1 = a_starts[:, None, :]
+    q1 = a_ends[:, None, :]
+    p2 = b_starts[None, :, :]
+    q2 = b_ends[None, :, :]
+
+    def points_to_segments(p, s, e):
+        seg = e - s
+        denom = np.sum(seg * seg, axis=-1)
+        with np.errstate(divide="ignore", invalid="ignore"):
+            t = np.sum((p - s) * seg, axis=-1) / denom
+        t = np.where(denom < EPS, 0.0, np.clip(t, 0.0, 1.0))
+        diff = p - (s + t[..., None] * seg)
+        return np.hypot(diff[..., 0], diff[..., 1])
+
+    def orient(a, b, c):
+        return (b[..., 0] - a[..., 0]) * (c[..., 1] - a[..., 1]) - (b[..., 1] - a[..., 1]) * (c[..., 0] - a[..., 0])
+
+    def within_box(a, b, c):
+        lo = np.minimum(a, c) - EPS
+        hi = np.maximum(a, c) + EPS
+        return np.all((lo <= b) & (b <= hi), axis=-1)
+
+    o1, o2 = orient(p1, q1, p2), orient(p1, q1, q2)
+    o3, o4 = orient(p2, q2, p1), orient(p2, q2, q1)
+    crossing = (((o1 > EPS) & (o2 < -EPS)) | ((o1 < -EPS) & (o2 > EPS))) & (
+        ((o3 > EPS) & (o4 < -EPS)) | ((o3 < -EPS) & (o4 > EPS))
+    )
+    touching = (
+        ((np.abs(o1) <= EPS) & within_box(p1, p2, q1))
+        | ((np.abs(o2) <= EPS) & within_box(p1, q2, q1))
+        | ((np.abs(o3) <= EPS) & within_box(p2, p1, q2))
+        | ((np.abs(o4) <= EPS) & within_box(p2, q1, q2))
+    )
+
+    best = np.minimum(
+        np.minimum(points_to_segments(p1, p2, q2), points_to_segments(q1, p2, q2)),
+        np.minimum(points_to_segments(p2, p1, q1), points_to_segments(q2, p1, q1)),
+    )
+    best[crossing | touching] = 0.0
+    return best
+
+
+def _rects_to_segments_distance_numpy(rects: np.ndarray, starts: np.ndarray, ends: np.ndarray) -> np.ndarray:
+    min_x, max_x, min_y, max_y = (col[None, :] for col in rects.T)
+
+    def points_to_rects(p):
+        dx = np.maximum(np.maximum(min_x - p[:, :1], 0.0), p[:, :1] - max_x)
+        dy = np.maximum(np.maximum(min_y - p[:, 1:], 0.0), p[:, 1:] - max_y)
+        return np.hypot(dx, dy)
+
+    best = np.minimum(points_to_rects(starts), points_to_rects(ends))
+
+    # Rectangle corners to each segment; together with the endpoint distances this covers every closest pair
+    # unless the segment crosses the rectangle, handled below.
+    corners = np.stack(
+        [
+            np.stack([rects[:, 0], rects[:, 2]], axis=1),
+            np.stack([rects[:, 1], rects[:, 2]], axis=1),
+            np.stack([rects[:, 1], rects[:, 3]], axis=1),
+            np.stack([rects[:, 0], rects[:, 3]], axis=1),
+        ],
+        axis=1,
+    ).reshape(-1, 2)
+    segments = ends - starts
+    denom = np.einsum("ij,ij->i", segments, segments)
+    offsets = corners[None, :, :] - starts[:, None, :]
+    with np.errstate(divide="ignore", invalid="ignore"):
+        t = np.einsum("ikj,ij->ik", offsets, segments) / denom[:, None]
+    t = np.where(denom[:, None] < 1e-12, 0.0, np.clip(t, 0.0, 1.0))
+    diff = offsets - t[:, :, None] * segments[:, None, :]
+    corner_dist = np.hypot(diff[..., 0], diff[..., 1]).reshape(starts.shape[0], -1, 4).min(axis=2)
+    best = np.minimum(best, corner_dist)
+
+    # Liang-Barsky clip: a segment crosses a rectangle iff the clipped parameter range is non-empty.
+    t0 = np.zeros_like(best)
+    t1 = np.ones_like(best)
+    crosses = np.ones(best.shape, dtype=bool)
+    for axis, lo, hi in ((0, min_x, max_x), (1, min_y, max_y)):
+        p0 = starts[:, axis : axis + 1]
+        d = segments[:, axis : axis + 1]
+        parallel = np.abs(d) < 1e-12
+        with np.errstate(divide="ignore", invalid="ignore"):
+            ta = (lo - p0) / d
+            tb = (hi - p0) / d
+        t0 = np.where(parallel, t0, np.maximum(t0, np.minimum(ta, tb)))
+        t1 = np.where(parallel, t1, np.minimum(t1, np.maximum(ta, tb)))
+        crosses &= ~parallel | ((p0 >= lo) & (p0 <= hi))
+    crosses &= t0 <= t1
+    best[crosses] = 0.0
+    return best
+
+
+def points_to_segment_distance(points: np.ndarray, start: np.ndarray, end: np.ndarray) -> np.ndarray:
+    """Distances from each of the (n, 2) ``points`` to the segment start-end."""
+    points = np.ascontiguousarray(points, dtype=float).reshape(-1, 2)
+    if HAVE_NUMBA:
+        return _points_to_segment_distance_loop(points, float(start[0]), float(start[1]), float(end[0]), float(end[1]))
+    return _points_to_segment_distance_numpy(points, np.asarray(start, dtype=float), np.asarray(end, dtype=float))
+
+
+def segments_to_segments_distance(
+    a_starts: np.ndarray, a_ends: np.ndarray, b_starts: np.ndarray, b_ends: np.ndarray
+) -> np.ndarray:
+    """(n, m) distances from each of the n segments ``a_starts[i]-a_ends[i]`` to each of the m ``b`` segments."""
+    arrays = [np.ascontiguousarray(a, dtype=float).reshape(-1, 2) for a in (a_starts, a_ends, b_starts, b_ends)]
+    if HAVE_NUMBA:
+        return _segments_to_segments_distance_loop(*arrays)
+    return _segments_to_segments_distance_numpy(*arrays)
+
+
+def rects_to_segments_distance(rects: np.ndarray, starts: np.ndarray, ends: np.ndarray) -> np.ndarray:
+    """(k, m) distances from each of the (k, 2) segments ``starts[i]-ends[i]`` to each of the (m, 4) rectangles.
+
+    Zero where the segment touches or crosses the rectangle.
+    """
+    rects = np.ascontiguousarray(rects, dtype=float).reshape(-1, 4)
+    starts = np.ascontiguousarray(starts, dtype=float).reshape(-1, 2)
+    ends = np.ascontiguousarray(ends, dtype=float).reshape(-1, 2)
+    if HAVE_NUMBA:
+        return _rects_to_segments_distance_loop(rects, starts, ends)
+    return _rects_to_segments_distance_numpy(rects, starts, ends)
+
+
+def warm_up() -> None:
+    """Call every kernel once so numba compiles (or loads from its cache) before the first tick needs it.
+
+    Without numba this just runs each Python version once. Used by ``StrategyRunner(prewarm=True)``.
+    """
+    point_segment_distance(0.0, 1.0, -1.0, 0.0, 1.0, 0.0)
+    closest_point_on_segment(0.0, 1.0, -1.0, 0.0, 1.0, 0.0)
+    orientation(0.0, 0.0, 1.0, 0.0, 0.0, 1.0)
+    segments_intersect(-1.0, 0.0, 1.0, 0.0, 0.0, -1.0, 0.0, 1.0)
+    segment_to_segment_distance(-1.0, 0.0, 1.0, 0.0, 0.0, 1.0, 0.0, 2.0)
+    line_intersection(-1.0, 0.0, 1.0, 0.0, 0.0, -1.0, 0.0, 1.0)
+    point_rect_distance(2.0, 0.0, -1.0, 1.0, -1.0, 1.0)
+    rect_segment_distance(-1.0, 1.0, -1.0, 1.0, 2.0, -2.0, 2.0, 2.0)
+
+    points = np.zeros((1, 2))
+    start, end = np.array([-1.0, 1.0]), np.array([1.0, 1.0])
+    points_to_segment_distance(points, start, end)
+    segments_to_segments_distance(points, points + 1.0, start.reshape(1, 2), end.reshape(1, 2))
+    rects_to_segments_distance(np.array([[-0.5, 0.5, -0.5, 0.5]]), start.reshape(1, 2), end.reshape(1, 2))
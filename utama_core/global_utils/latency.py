@@ -0,0 +1,213 @@
+"""Lightweight latency instrumentation for the control loop.
+
+A single process-wide LatencyTracker collects how long each pipeline stage takes. Code anywhere in the loop
+wraps its work in ``latency.span("stage")``; when tracking is disabled (the default) this returns a shared
+no-op context manager, so instrumented code costs one attribute lookup.
+
+Spans opened on the control-loop thread between ``begin_tick`` and ``end_tick`` are summed per stage, so a
+stage hit several times in one tick (e.g. motion planning for each robot) is reported as its per-tick total.
+Spans from other threads (e.g. the vision receiver) go straight into their stage histogram.
+
+Each tick is also recorded against the capture timestamp of the newest vision frame it consumed, so the
+export can be used to measure capture-to-actuation latency. In PvP both sides send in the same tick; each marks
+its own send time, and the opponent's end-to-end stages are reported with an ``opp.`` prefix. Only the most
+recent ``max_ticks`` tick records are kept.
+"""
+
+import csv
+import threading
+import time
+from collections import deque
+from dataclasses import dataclass, field
+from typing import Deque, Dict, Optional, Tuple
+
+import numpy as np
+
+# Per-tick end-to-end stages computed by end_tick.
+CAPTURE_TO_SEND = "capture_to_send"
+RECEIVE_TO_SEND = "receive_to_send"
+TICK = "tick"
+
+# Sides passed to mark_sent.
+MY_SIDE = "my"
+OPP_SIDE = "opp"
+
+
+class StageHistogram:
+    """Ring buffer of the most recent ``window`` samples of one stage, in seconds."""
+
+    def __init__(self, window: int):
+        self._samples = np.zeros(window)
+        self.count = 0
+        self.max = 0.0  # over the whole run, not just the window
+
+    def add(self, seconds: float):
+        self._samples[self.count % self._samples.shape[0]] = seconds
+        self.count += 1
+        if seconds > self.max:
+            self.max = seconds
+
+    def percentiles(self) -> Tuple[float, float, float]:
+        """(p50, p99, max) over the current window, in seconds."""
+        if self.count == 0:
+            return 0.0, 0.0, 0.0
+        window = self._samples[: min(self.count, self._samples.shape[0])]
+        p50, p99 = np.percentile(window, (50, 99))
+        return float(p50), float(p99), float(window.max())
+
+
+@dataclass
+class TickRecord:
+    t_capture: Optional[float]  # SSL-Vision capture time of the newest frame used this tick
+    received_at: Optional[float]  # wall-clock arrival time of that frame
+    started_at: float  # wall-clock start of the tick
+    sent_at: Dict[str, float] = field(default_factory=dict)  # wall-clock send time of each side's commands
+    stages: Dict[str, float] = field(default_factory=dict)
+
+
+class _Span:
+    __slots__ = ("_tracker", "_stage", "_start")
+
+    def __init__(self, tracker: "LatencyTracker", stage: str):
+        self._tracker = tracker
+        self._stage = stage
+
+    def __enter__(self):
+        self._start = time.perf_counter()
+        return self
+
+    def __exit__(self, *exc):
+        self._tracker.add(self._stage, time.perf_counter() - self._start)
+        return False
+
+
+class _NullSpan:
+    __slots__ = ()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        return False
+
+
+_NULL_SPAN = _NullSpan()
+
+
+class LatencyTracker:
+    """Collects per-stage latency histograms and per-tick records.
+
+    Args:
+        window (int): Number of recent samples per stage used for percentiles.
+        enabled (bool): When False, spans are no-ops and nothing is recorded.
+        max_ticks (int): Number of recent tick records kept for ``ticks`` and ``export``. Defaults to 36000,
+            ten minutes at 60 Hz.
+    """
+
+    def __init__(self, window: int = 600, enabled: bool = False, max_ticks: int = 36_000):
+        self.window = window
+        self.enabled = enabled
+        self._histograms: Dict[str, StageHistogram] = {}
+        self._ticks: Deque[TickRecord] = deque(maxlen=max_ticks)
+        self._current: Optional[TickRecord] = None
+        self._tick_thread: Optional[int] = None
+        self._tick_start = 0.0
+        self._lock = threading.Lock()
+
+    def span(self, stage: str):
+        """Context manager timing the enclosed block as ``stage``."""
+        if not self.enabled:
+            return _NULL_SPAN
+        return _Span(self, stage)
+
+    def add(self, stage: str, seconds: float):
+        """Records ``seconds`` spent in ``stage``."""
+        if not self.enabled:
+            return
+        current = self._current
+        if current is not None and threading.get_ident() == self._tick_thread:
+            current.stages[stage] = current.stages.get(stage, 0.0) + seconds
+        else:
+            self._histogram(stage).add(seconds)
+
+    def begin_tick(self, t_capture: Optional[float] = None, received_at: Optional[float] = None):
+        """Opens a tick on the calling thread. ``t_capture`` / ``received_at`` describe the newest vision frame."""
+        if not self.enabled:
+            return
+        self._current = TickRecord(t_capture, received_at, time.time())
+        self._tick_thread = threading.get_ident()
+        self._tick_start = time.perf_counter()
+
+    def mark_sent(self, side: str = MY_SIDE):
+        """Marks that ``side`` has just sent its commands for the current tick."""
+        if self._current is not None:
+            self._current.sent_at[side] = time.time()
+
+    def end_tick(self):
+        """Closes the current tick and folds its stage totals into the histograms."""
+        current = self._current
+        if current is None:
+            return
+        self._current = None
+        current.stages[TICK] = time.perf_counter() - self._tick_start
+        if current.received_at is not None:
+            for side, sent_at in current.sent_at.items():
+                prefix = "" if side == MY_SIDE else f"{side}."
+                current.stages[prefix + RECEIVE_TO_SEND] = sent_at - current.received_at
+                # t_capture is on the SSL-Vision clock, so this is only meaningful for frames received over the network.
+                if current.t_capture is not None:
+                    current.stages[prefix + CAPTURE_TO_SEND] = sent_at - current.t_capture
+        for stage, seconds in current.stages.items():
+            self._histogram(stage).add(seconds)
+        self._ticks.append(current)
+
+    def summary(self) -> Dict[str, Tuple[float, float, float]]:
+        """Maps each stage to its (p50, p99, max) over the recent window, in seconds."""
+        with self._lock:
+            histograms = list(self._histograms.items())
+        return {stage: hist.percentiles() for stage, hist in histograms}
+
+    @property
+    def ticks(self) -> Deque[TickRecord]:
+        return self._ticks
+
+    def export(self, path: str):
+        """Writes one CSV row per kept tick, keyed by t_capture, with every stage duration in seconds."""
+        sides = sorted({side for tick in self._ticks for side in tick.sent_at}, key=lambda side: side != MY_SIDE)
+        stages = sorted({stage for tick in self._ticks for stage in tick.stages})
+        sent_columns = ["sent_at" if side == MY_SIDE else f"{side}.sent_at" for side in sides]
+        with open(path, "w", newline="") as f:
+            writer = csv.writer(f)
+            writer.writerow(["t_capture", "received_at", "started_at", *sent_columns, *stages])
+            for tick in self._ticks:
+                writer.writerow(
+                    [tick.t_capture, tick.received_at, tick.started_at]
+                    + [tick.sent_at.get(side, "") for side in sides]
+                    + [tick.stages.get(stage, "") for stage in stages]
+                )
+
+    def reset(self):
+        with self._lock:
+            self._histograms = {}
+        self._ticks.clear()
+        self._current = None
+
+    def _histogram(self, stage: str) -> StageHistogram:
+        hist = self._histograms.get(stage)
+        if hist is None:
+            with self._lock:
+                hist = self._histograms.setdefault(stage, StageHistogram(self.window))
+        return hist
+
+
+_tracker = LatencyTracker()
+
+
+def get_tracker() -> LatencyTracker:
+    """The process-wide tracker used by ``span``."""
+    return _tracker
+
+
+def span(stage: str):
+    """Times the enclosed block as ``stage`` on the process-wide tracker."""
+    return _tracker.span(stage)
@@ -4,6 +4,7 @@ import numpy as np
 
 from utama_core.entities.data.vector import Vector2D
 from utama_core.entities.game.field import Field, FieldBounds
+from utama_core.global_utils import geometry_kernels as kernels
 
 EPS = 1e-9
 
@@ -190,14 +191,16 @@ def distance_between_line_segments(
     Returns:
         float: The minimum distance between the two line segments.
     """
-    if segments_intersect(seg1_start, seg1_end, seg2_start, seg2_end):
-        return 0.0
-
-    return min(
-        distance_point_to_segment(seg1_start, seg2_start, seg2_end),
-        distance_point_to_segment(seg1_end, seg2_start, seg2_end),
-        distance_point_to_segment(seg2_start, seg1_start, seg1_end),
-        distance_point_to_segment(seg2_end, seg1_start, seg1_end),
+    return kernels.segment_to_segment_distance(
+        float(seg1_start[0]),
+        float(seg1_start[1]),
+        float(seg1_end[0]),
+        float(seg1_end[1]),
+        float(seg2_start[0]),
+        float(seg2_start[1]),
+        float(seg2_end[0]),
+        float(seg2_end[1]),
+        EPS,
     )
 
 
@@ -211,28 +214,15 @@ def distance_point_to_segment(point: np.ndarray, seg_start: np.ndarray, seg_end:
     Returns:
         float: The minimum distance from the point to the line segment.
     """
-    point = np.asarray(point)
-    seg_start = np.asarray(seg_start)
-    seg_end = np.asarray(seg_end)
-
-    seg_vec = seg_end - seg_start
-    pt_vec = point - seg_start
-
-    seg_len_sq = np.dot(seg_vec, seg_vec)
-
-    if seg_len_sq < EPS:
-        return np.linalg.norm(point - seg_start)
-
-    t = np.dot(pt_vec, seg_vec) / seg_len_sq
-
-    if t < 0:
-        closest = seg_start
-    elif t > 1:
-        closest = seg_end
-    else:
-        closest = seg_start + t * seg_vec
-
-    return np.linalg.norm(point - closest)
+    return kernels.point_segment_distance(
+        float(point[0]),
+        float(point[1]),
+        float(seg_start[0]),
+        float(seg_start[1]),
+        float(seg_end[0]),
+        float(seg_end[1]),
+        EPS,
+    )
 
 
 def closest_point_on_segment(point, seg_start, seg_end):
@@ -245,26 +235,16 @@ def closest_point_on_segment(point, seg_start, seg_end):
     Returns:
         np.ndarray: An np array representing the closest point on the segment.
     """
-    point = np.asarray(point)
-    seg_start = np.asarray(seg_start)
-    seg_end = np.asarray(seg_end)
-
-    seg_vec = seg_end - seg_start
-    pt_vec = point - seg_start
-
-    seg_len_sq = np.dot(seg_vec, seg_vec)
-
-    if seg_len_sq < EPS:
-        return seg_start
-
-    t = np.dot(pt_vec, seg_vec) / seg_len_sq
-
-    if t < 0:
-        return seg_start
-    elif t > 1:
-        return seg_end
-    else:
-        return seg_start + t * seg_vec
+    x, y = kernels.closest_point_on_segment(
+        float(point[0]),
+        float(point[1]),
+        float(seg_start[0]),
+        float(seg_start[1]),
+        float(seg_end[0]),
+        float(seg_end[1]),
+        EPS,
+    )
+    return np.array([x, y])
 
 
 def segments_intersect(
@@ -283,29 +263,17 @@ def segments_intersect(
     Returns:
         bool: True if the segments intersect, False otherwise.
     """
-    p1 = np.asarray(seg1_start)
-    q1 = np.asarray(seg1_end)
-    p2 = np.asarray(seg2_start)
-    q2 = np.asarray(seg2_end)
-
-    o1 = point_orientation(p1, q1, p2)
-    o2 = point_orientation(p1, q1, q2)
-    o3 = point_orientation(p2, q2, p1)
-    o4 = point_orientation(p2, q2, q1)
-
-    if o1 != o2 and o3 != o4:
-        return True
-
-    if o1 == 0 and on_segment(p1, p2, q1):
-        return True
-    if o2 == 0 and on_segment(p1, q2, q1):
-        return True
-    if o3 == 0 and on_segment(p2, p1, q2):
-        return True
-    if o4 == 0 and on_segment(p2, q1, q2):
-        return True
-
-    return False
+    return kernels.segments_intersect(
+        float(seg1_start[0]),
+        float(seg1_start[1]),
+        float(seg1_end[0]),
+        float(seg1_end[1]),
+        float(seg2_start[0]),
+        float(seg2_start[1]),
+        float(seg2_end[0]),
+        float(seg2_end[1]),
+        EPS,
+    )
 
 
 def point_orientation(p_1: np.ndarray, p_2: np.ndarray, p_3: np.ndarray) -> int:
@@ -363,18 +331,9 @@ def find_intersection(line1, line2):
     Returns:
         np.array of intersection point (x, y), or None if no intersection.
     """
-    A, B = np.asarray(line1[0]), np.asarray(line1[1])
-    C, D = np.asarray(line2[0]), np.asarray(line2[1])
-
-    denom = (B[0] - A[0]) * (D[1] - C[1]) - (B[1] - A[1]) * (D[0] - C[0])
-
-    if abs(denom) < EPS:
-        return None
-
-    t = ((C[0] - A[0]) * (D[1] - C[1]) - (C[1] - A[1]) * (D[0] - C[0])) / denom
-    u = ((C[0] - A[0]) * (B[1] - A[1]) - (C[1] - A[1]) * (B[0] - A[0])) / denom
-
-    if -EPS <= t <= 1 + EPS and -EPS <= u <= 1 + EPS:
-        return A + t * (B - A)
-
-    return None
+    (ax, ay), (bx, by) = line1
+    (cx, cy), (dx, dy) = line2
+    found, x, y = kernels.line_intersection(
+        float(ax), float(ay), float(bx), float(by), float(cx), float(cy), float(dx), float(dy), EPS
+    )
+    return np.array([x, y]) if found else None
@@ -1,15 +1,18 @@
 from abc import ABC, abstractmethod
+from typing import TYPE_CHECKING, Optional
 
 from utama_core.config.enums import Mode
 from utama_core.entities.data.vector import Vector2D
 from utama_core.entities.game import Game
-from utama_core.rsoccer_simulator.src.ssl.envs import SSLStandardEnv
+
+if TYPE_CHECKING:
+    from utama_core.rsoccer_simulator.src.ssl.envs import SSLStandardEnv
 
 
 class MotionController(ABC):
-    def __init__(self, mode: Mode, rsim_env: SSLStandardEnv | None = None):
+    def __init__(self, mode: Mode, rsim_env: Optional["SSLStandardEnv"] = None):
         self.mode = mode
-        self.rsim_env: SSLStandardEnv | None = rsim_env
+        self.rsim_env: Optional["SSLStandardEnv"] = rsim_env
 
     @abstractmethod
     def calculate(
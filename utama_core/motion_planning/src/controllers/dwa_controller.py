@@ -1,3 +1,5 @@
+from typing import TYPE_CHECKING, Optional
+
 from utama_core.config.enums import Mode
 from utama_core.entities.data.vector import Vector2D
 from utama_core.entities.game import Game
@@ -7,15 +9,17 @@ from utama_core.motion_planning.src.dwa.translation_controller import (
     DWATranslationController,
 )
 from utama_core.motion_planning.src.pid import PID, get_pids
-from utama_core.rsoccer_simulator.src.ssl.envs.standard_ssl import SSLStandardEnv
+
+if TYPE_CHECKING:
+    from utama_core.rsoccer_simulator.src.ssl.envs.standard_ssl import SSLStandardEnv
 
 
 class DWAController(MotionController):
-    def __init__(self, mode: Mode, rsim_env: SSLStandardEnv | None):
+    def __init__(self, mode: Mode, rsim_env: Optional["SSLStandardEnv"]):
         super().__init__(mode, rsim_env)
         self._dwa_oren, self._dwa_trans = self._initialize_dwa(mode, rsim_env)
 
-    def _initialize_dwa(self, mode: Mode, env: SSLStandardEnv | None) -> tuple[PID, DWATranslationController]:
+    def _initialize_dwa(self, mode: Mode, env: Optional["SSLStandardEnv"]) -> tuple[PID, DWATranslationController]:
 
         pid_oren, _ = get_pids(mode)
         dwa_config = get_dwa_config(mode)
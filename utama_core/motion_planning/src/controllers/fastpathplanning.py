@@ -1,4 +1,5 @@
 from abc import ABC, abstractmethod
+from typing import TYPE_CHECKING, Optional
 
 import numpy as np
 
@@ -10,13 +11,14 @@ from utama_core.entities.game.field import Field
 from utama_core.motion_planning.src.common.motion_controller import MotionController
 from utama_core.motion_planning.src.fastpathplanning.planner import FastPathPlanner
 from utama_core.motion_planning.src.pid.pid import get_pids
-from utama_core.rsoccer_simulator.src.ssl.envs import SSLStandardEnv
+
+if TYPE_CHECKING:
+    from utama_core.rsoccer_simulator.src.ssl.envs import SSLStandardEnv
 
 
 class FastPathPlanningController(MotionController):
-    def __init__(self, mode: Mode, rsim_env: SSLStandardEnv | None = None):
-        self.mode = mode
-        self.rsim_env: SSLStandardEnv | None = rsim_env
+    def __init__(self, mode: Mode, rsim_env: Optional["SSLStandardEnv"] = None):
+        super().__init__(mode, rsim_env)
         self.pid_oren, self.pid_trans = get_pids(mode)
         self.fpp = FastPathPlanner(env=self.rsim_env)
 
@@ -42,3 +44,4 @@ class FastPathPlanningController(MotionController):
     def reset(self, robot_id):
         self.pid_oren.reset(robot_id)
         self.pid_trans.reset(robot_id)
+        self.fpp.reset(robot_id)
@@ -17,6 +17,9 @@ class DynamicWindowConfig:
     max_speed_for_full_bubble: float = 1.0
     target_tolerance: float = 0.01
     n_directions: int = 8
+    # Score every candidate segment in one NumPy pass. False uses the per-candidate loop, which stops at the first
+    # velocity scale with a non-negative score and draws each evaluated candidate in RSim.
+    vectorised: bool = True
 
 
 def get_dwa_config(mode: Mode) -> DynamicWindowConfig:
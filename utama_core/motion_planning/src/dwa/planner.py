@@ -1,7 +1,8 @@
 import copy
 import math
-from math import exp
-from typing import Iterable, List, Optional
+from typing import TYPE_CHECKING, Iterable, List, Optional
+
+import numpy as np
 
 from utama_core.config.physical_constants import ROBOT_RADIUS
 from utama_core.config.settings import TIMESTEP
@@ -9,15 +10,12 @@ from utama_core.entities.data.vector import Vector2D
 from utama_core.entities.game import Game, Robot
 from utama_core.global_utils.math_utils import normalise_heading
 from utama_core.motion_planning.src.dwa.config import DynamicWindowConfig
-from utama_core.motion_planning.src.planning.geometry import (
-    AxisAlignedRectangle,
-    point_segment_distance,
-)
-from utama_core.motion_planning.src.planning.obstacles import (
-    ObstacleRegion,
-    to_rectangles,
-)
-from utama_core.rsoccer_simulator.src.ssl.envs import SSLStandardEnv
+from utama_core.motion_planning.src.planning.geometry import point_segment_distance
+from utama_core.motion_planning.src.planning.obstacle_snapshot import ObstacleSnapshot
+from utama_core.motion_planning.src.planning.obstacles import ObstacleRegion
+
+if TYPE_CHECKING:
+    from utama_core.rsoccer_simulator.src.ssl.envs import SSLStandardEnv
 
 
 class DynamicWindowPlanner:
@@ -26,7 +24,7 @@ class DynamicWindowPlanner:
     def __init__(
         self,
         config: DynamicWindowConfig,
-        env: SSLStandardEnv | None = None,
+        env: Optional["SSLStandardEnv"] = None,
     ):
         self._config = config
         self._simulate_timestep = self._config.simulate_frames * TIMESTEP
@@ -80,23 +78,55 @@ class DynamicWindowPlanner:
             Optional[tuple[Vector2D, float]]: A tuple containing the best waypoint and its score,
             or None if no valid path is found.
         """
-        velocity = robot.v
-        current_speed = velocity.mag()
-        safety_radius = self._dynamic_safety_radius(current_speed)
-        safety_radius_sq = safety_radius * safety_radius
-
-        delta_max_vel = self._control_period * self._max_acceleration
-        best_score = float("-inf")
+        safety_radius = self._dynamic_safety_radius(robot.v.mag())
         start = robot.p
-        best_move = start
 
-        rect_obstacles = to_rectangles(temporary_obstacles)
+        snapshot = ObstacleSnapshot.for_game(game).with_regions(temporary_obstacles)
+        others = snapshot.others(robot.id)
+        obstacle_positions = snapshot.positions[others]
+        obstacle_velocities = snapshot.velocities[others]
 
         dx, dy = target - start
         ang0 = math.atan2(dy, dx)
         step = 2 * math.pi / self._config.n_directions
         ordered_angles = [normalise_heading(ang0 + k * step) for k in range(self._config.n_directions)]
 
+        if self._config.vectorised:
+            best_move, best_score = self._search_window_vectorised(
+                robot, target, snapshot, obstacle_positions, obstacle_velocities, ordered_angles, safety_radius
+            )
+        else:
+            best_move, best_score = self._search_window_loop(
+                robot, target, snapshot, obstacle_positions, obstacle_velocities, ordered_angles, safety_radius
+            )
+
+        if best_score == float("-inf"):
+            return None
+
+        segment_start = copy.copy(start)
+        if self._segment_overshoots_target(segment_start, best_move, target):
+            best_move = copy.copy(target)
+
+        return best_move, best_score
+
+    def _search_window_loop(
+        self,
+        robot: Robot,
+        target: Vector2D,
+        snapshot: ObstacleSnapshot,
+        obstacle_positions: np.ndarray,
+        obstacle_velocities: np.ndarray,
+        ordered_angles: List[float],
+        safety_radius: float,
+    ) -> tuple[Vector2D, float]:
+        """Evaluates candidates one at a time, stopping after the first scale that yields a non-negative score."""
+        start = robot.p
+        velocity = robot.v
+        safety_radius_sq = safety_radius * safety_radius
+        delta_max_vel = self._control_period * self._max_acceleration
+        best_score = float("-inf")
+        best_move = start
+
         for scale in self._candidate_scales():
             for ang in ordered_angles:
                 segment_start, segment_end = self._get_motion_segment(
@@ -109,12 +139,13 @@ class DynamicWindowPlanner:
                 if self.env is not None:
                     self.env.draw_line([segment_start, segment_end], color="red", width=2)
 
-                if self._segment_too_close(segment_start, segment_end, rect_obstacles, safety_radius):
+                if snapshot.segment_hits_rect(segment_start.to_array(), segment_end.to_array(), safety_radius):
                     continue
 
                 score = self._evaluate_segment(
-                    game,
                     robot,
+                    obstacle_positions,
+                    obstacle_velocities,
                     segment_start,
                     segment_end,
                     target,
@@ -130,69 +161,140 @@ class DynamicWindowPlanner:
             if best_score >= 0:
                 break
 
-        if best_score == float("-inf"):
-            return None
-
-        segment_start = copy.copy(start)
-        if self._segment_overshoots_target(segment_start, best_move, target):
-            best_move = copy.copy(target)
-
         return best_move, best_score
 
-    def _get_obstacles(self, game: Game, robot_id: int) -> List[Robot]:
-        friendly = [r for rid, r in game.friendly_robots.items() if rid != robot_id]
-        enemies = list(game.enemy_robots.values())
-        return friendly + enemies
+    def _search_window_vectorised(
+        self,
+        robot: Robot,
+        target: Vector2D,
+        snapshot: ObstacleSnapshot,
+        obstacle_positions: np.ndarray,
+        obstacle_velocities: np.ndarray,
+        ordered_angles: List[float],
+        safety_radius: float,
+    ) -> tuple[Vector2D, float]:
+        """Scores every (scale, direction) candidate at once.
+
+        The winner is the one the loop would pick: the best candidate over all scales up to and including the first
+        scale whose best score is non-negative, ties going to the earlier candidate.
+        """
+        scales = np.fromiter(self._candidate_scales(), dtype=float)
+        angles = np.asarray(ordered_angles, dtype=float)
+        start = np.array([robot.p.x, robot.p.y])
+        velocity = np.array([robot.v.x, robot.v.y])
+        target_arr = np.array([target.x, target.y])
+
+        # (n_scales * n_directions, 2) segment ends, scale-major like the loop.
+        directions = np.stack([np.cos(angles), np.sin(angles)], axis=1)
+        delta_max_vel = self._control_period * self._max_acceleration
+        new_velocities = velocity + (delta_max_vel * scales)[:, None, None] * directions[None, :, :]
+        ends = (start + new_velocities * self._simulate_timestep).reshape(-1, 2)
+        starts = np.broadcast_to(start, ends.shape)
+
+        scores = self._evaluate_segments(
+            start, obstacle_positions, obstacle_velocities, ends, target_arr, safety_radius * safety_radius
+        )
+        scores[snapshot.segments_hit_rects(starts, ends, safety_radius)] = -np.inf
+
+        per_scale = scores.reshape(scales.shape[0], -1)
+        running_best = np.maximum.accumulate(per_scale.max(axis=1))
+        stop = np.flatnonzero(running_best >= 0)
+        n_used = (stop[0] + 1) * per_scale.shape[1] if stop.size else scores.shape[0]
+
+        best = int(np.argmax(scores[:n_used]))
+        best_score = float(scores[best])
+        if best_score == float("-inf"):
+            return robot.p, best_score
+        return Vector2D(float(ends[best, 0]), float(ends[best, 1])), best_score
 
-    def _obstacle_penalty(self, value: float) -> float:
-        return exp(-8 * (value - self._safety_penalty_distance_sq))
+    def _evaluate_segments(
+        self,
+        start: np.ndarray,
+        obstacle_positions: np.ndarray,
+        obstacle_velocities: np.ndarray,
+        ends: np.ndarray,
+        target: np.ndarray,
+        safety_radius_sq: float,
+    ) -> np.ndarray:
+        """Batched _evaluate_segment for (k, 2) segment ends all starting at ``start``; returns (k,) scores."""
+        seg_vecs = ends - start
+        target_factor = np.hypot(*(target - start)) - np.hypot(*(target - ends).T)
+
+        # (k, n) closest approach of every candidate to every obstacle, assuming constant velocities.
+        our_velocities = seg_vecs / self._simulate_timestep
+        diff_v = our_velocities[:, None, :] - obstacle_velocities[None, :, :]
+        diff_p = start - obstacle_positions
+        denom = np.einsum("knj,knj->kn", diff_v, diff_v)
+        moving = denom != 0.0
+        with np.errstate(divide="ignore", invalid="ignore"):
+            t = np.where(moving, -np.einsum("knj,nj->kn", diff_v, diff_p) / denom, 0.0)
+        approaching = moving & (t > 0.0)
+
+        closest = diff_p[None, :, :] + t[:, :, None] * diff_v
+        d_sq = np.einsum("knj,knj->kn", closest, closest)
+        adjustment = max(self._safety_penalty_distance_sq - safety_radius_sq, 0.0)
+        # Receding obstacles (t <= 0) can overflow here; they are masked out below.
+        with np.errstate(over="ignore", invalid="ignore"):
+            penalties = self._obstacle_penalty(d_sq + adjustment) * self._obstacle_penalty(t)
+        obstacle_factor = np.where(approaching, penalties, 0.0).max(axis=1, initial=0.0)
+
+        # Distance from the target to each candidate segment.
+        seg_len_sq = np.einsum("kj,kj->k", seg_vecs, seg_vecs)
+        with np.errstate(divide="ignore", invalid="ignore"):
+            along = np.where(seg_len_sq < 1e-9, 0.0, np.clip(seg_vecs @ (target - start) / seg_len_sq, 0.0, 1.0))
+        to_line = target - (start + along[:, None] * seg_vecs)
+        distance_to_line = np.hypot(to_line[:, 0], to_line[:, 1])
+
+        return 5 * target_factor - obstacle_factor + self._target_closeness(distance_to_line)
+
+    def _obstacle_penalty(self, value):
+        return np.exp(-8 * (value - self._safety_penalty_distance_sq))
 
     @staticmethod
-    def _target_closeness(value: float) -> float:
-        return 4 * exp(-8 * value)
+    def _target_closeness(value):
+        return 4 * np.exp(-8 * value)
 
     def _evaluate_segment(
         self,
-        game: Game,
         robot: Robot,
+        obstacle_positions: np.ndarray,
+        obstacle_velocities: np.ndarray,
         start: Vector2D,
         end: Vector2D,
         target: Vector2D,
         safety_radius_sq: float,
     ) -> float:
-        """Evaluate a candidate motion segment; higher score is better."""
+        """Evaluate a candidate motion segment; higher score is better.
+
+        obstacle_positions / obstacle_velocities are the (k, 2) rows of the tick's ObstacleSnapshot for every
+        robot other than this one.
+        """
         seg_vec = end - start
 
         start_dist = target.distance_to(start)
         end_dist = target.distance_to(end)
         target_factor = start_dist - end_dist
 
-        our_velocity_vector = seg_vec / self._simulate_timestep
-        our_position = robot.p
+        our_velocity = np.array([seg_vec.x, seg_vec.y]) / self._simulate_timestep
+        our_position = np.array([robot.p.x, robot.p.y])
+
+        # Time and distance of closest approach to every obstacle at once, assuming constant velocities.
+        diff_v = our_velocity - obstacle_velocities
+        diff_p = our_position - obstacle_positions
+        denom = np.einsum("ij,ij->i", diff_v, diff_v)
+        moving = denom != 0.0
+        t = np.zeros_like(denom)
+        t[moving] = -np.einsum("ij,ij->i", diff_v[moving], diff_p[moving]) / denom[moving]
+        approaching = moving & (t > 0.0)
 
         obstacle_factor = 0.0
-        for obstacle in self._get_obstacles(game, robot.id):
-            their_velocity = obstacle.v
-            their_position = obstacle.p
-
-            diff_v = our_velocity_vector - their_velocity
-            denom = diff_v.dot(diff_v)
-            if denom == 0.0:
-                continue
-
-            diff_p = our_position - their_position
-            t = -diff_v.dot(diff_p) / denom
-            if t <= 0.0:
-                continue
-
-            closest = diff_p + t * diff_v
-            d_sq = closest.dot(closest)
+        if approaching.any():
+            t = t[approaching]
+            closest = diff_p[approaching] + t[:, None] * diff_v[approaching]
+            d_sq = np.einsum("ij,ij->i", closest, closest)
             adjustment = max(self._safety_penalty_distance_sq - safety_radius_sq, 0.0)
-            effective_d_sq = d_sq + adjustment
-            obstacle_factor = max(
-                obstacle_factor,
-                self._obstacle_penalty(effective_d_sq) * self._obstacle_penalty(t),
-            )
+            penalties = self._obstacle_penalty(d_sq + adjustment) * self._obstacle_penalty(t)
+            obstacle_factor = max(float(penalties.max()), 0.0)
 
         distance_to_line = point_segment_distance(target, start, end)
         score = 5 * target_factor - obstacle_factor + self._target_closeness(distance_to_line)
@@ -243,15 +345,3 @@ class DynamicWindowPlanner:
 
         distance = point_segment_distance(target, start, end)
         return distance <= self._config.target_tolerance
-
-    def _segment_too_close(
-        self,
-        start: Vector2D,
-        end: Vector2D,
-        obstacles: List[AxisAlignedRectangle],
-        clearance: float,
-    ) -> bool:
-        for obstacle in obstacles:
-            if obstacle.distance_to_segment(start, end) < clearance:
-                return True
-        return False
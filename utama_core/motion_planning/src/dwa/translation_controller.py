@@ -1,4 +1,4 @@
-from typing import Optional
+from typing import TYPE_CHECKING, Optional
 
 from utama_core.config.settings import TIMESTEP
 from utama_core.entities.data.vector import Vector2D
@@ -7,10 +7,12 @@ from utama_core.motion_planning.src.common.acceleration_limiter import (
     AccelerationLimiter,
 )
 from utama_core.motion_planning.src.dwa.config import DynamicWindowConfig
-from utama_core.rsoccer_simulator.src.ssl.envs import SSLStandardEnv
 
 from .planner import DynamicWindowPlanner
 
+if TYPE_CHECKING:
+    from utama_core.rsoccer_simulator.src.ssl.envs import SSLStandardEnv
+
 
 class DWATranslationController:
     """Compute global linear velocities using a Dynamic Window Approach."""
@@ -18,10 +20,10 @@ class DWATranslationController:
     def __init__(
         self,
         config: DynamicWindowConfig,
-        env: SSLStandardEnv | None = None,
+        env: Optional["SSLStandardEnv"] = None,
     ):
         self._planner_config = config
-        self.env: SSLStandardEnv | None = env
+        self.env: Optional["SSLStandardEnv"] = env
         self._control_period = TIMESTEP
         self._planner = DynamicWindowPlanner(
             config=self._planner_config,
@@ -16,3 +16,10 @@ class fastpathplanningconfig:
     MAXRECURSION_LENGTH = 3
     PROJECTEDFRAMES = 20
     PROJECTION_DISTANCE = 1
+
+    # Cross-tick path cache: reuse last tick's detour while the target and obstacles stay within these tolerances
+    PATH_CACHE = True
+    CACHE_TARGET_TOLERANCE = 0.05
+    CACHE_OBSTACLE_TOLERANCE = 0.05
+    # Drop a cached waypoint once the robot is this close to it
+    WAYPOINT_REACHED_DISTANCE = ROBOT_RADIUS
@@ -1,5 +1,7 @@
 import math
-from typing import List, Tuple
+import time
+from dataclasses import dataclass
+from typing import TYPE_CHECKING, Dict, List, Optional, Tuple
 
 import numpy as np  # type: ignore
 
@@ -17,11 +19,45 @@ from utama_core.global_utils.math_utils import (
 from utama_core.motion_planning.src.fastpathplanning.config import (
     fastpathplanningconfig as config,
 )
-from utama_core.rsoccer_simulator.src.ssl.envs.standard_ssl import SSLStandardEnv
+from utama_core.motion_planning.src.planning.obstacle_snapshot import ObstacleSnapshot
+
+if TYPE_CHECKING:
+    from utama_core.rsoccer_simulator.src.ssl.envs.standard_ssl import SSLStandardEnv
+
+
+@dataclass
+class _CachedPath:
+    target: np.ndarray  # target when the whole path was last planned or checked
+    waypoints: List[np.ndarray]  # intermediate subgoals, excluding the robot position and the target
+    obstacles: np.ndarray  # (n, 2, 2) obstacle segments when the whole path was last planned or checked
+
+
+@dataclass
+class PathCacheStats:
+    """How often the cross-tick path cache let _path_to skip (hit) or shorten (repair) planning."""
+
+    hits: int = 0  # previous path reused as-is
+    repairs: int = 0  # previous path reused with colliding segments replanned
+    misses: int = 0  # planned from scratch
+    hit_time: float = 0.0  # total planning seconds per outcome
+    repair_time: float = 0.0
+    miss_time: float = 0.0
+
+    @property
+    def calls(self) -> int:
+        return self.hits + self.repairs + self.misses
+
+    @property
+    def time_saved(self) -> float:
+        """Estimated seconds saved, assuming every hit and repair would otherwise have cost a mean miss."""
+        if self.misses == 0:
+            return 0.0
+        mean_miss = self.miss_time / self.misses
+        return (self.hits + self.repairs) * mean_miss - self.hit_time - self.repair_time
 
 
 class FastPathPlanner:
-    def __init__(self, env: SSLStandardEnv):
+    def __init__(self, env: "SSLStandardEnv"):
         self._env = env
         self.config = config
         self.OBSTACLE_CLEARANCE = self.config.OBSTACLE_CLEARANCE
@@ -34,6 +70,17 @@ class FastPathPlanner:
         # Initialize collision cache dictionary
         self._collision_cache = {}
 
+        # Per-robot path from the previous call, reused across ticks
+        self._path_cache: Dict[int, _CachedPath] = {}
+        self.cache_stats = PathCacheStats()
+
+    def reset(self, robot_id: Optional[int] = None):
+        """Forget the cached path of ``robot_id``, or of every robot."""
+        if robot_id is None:
+            self._path_cache.clear()
+        else:
+            self._path_cache.pop(robot_id, None)
+
     def is_point_in_field(self, point, field_bounds: FieldBounds) -> bool:
         x, y = float(point[0]), float(point[1])
         min_x = min(field_bounds.top_left[0], field_bounds.bottom_right[0])
@@ -48,23 +95,19 @@ class FastPathPlanner:
         """
         Compiles obstacles and draws projected velocity lines in Red.
         """
-        friendly_obstacles = [robot for robot in game.friendly_robots.values() if robot.id != robot_id]
-        robots = friendly_obstacles + list(game.enemy_robots.values())
-        obstacle_list = []
+        snapshot = ObstacleSnapshot.for_game(game)
+        nearby = snapshot.robots_near_segment(our_pos, our_pos, self.LOOK_AHEAD_RANGE, exclude_friendly_id=robot_id)
+        nearby = nearby[snapshot.robot_distances_to_segment(our_pos, our_pos, nearby) < self.LOOK_AHEAD_RANGE]
 
-        for r in robots:
-            robot_pos = np.array([r.p.x, r.p.y])
-            if distance(our_pos, robot_pos) < self.LOOK_AHEAD_RANGE:
-                velocity = np.array([r.v.x, r.v.y])
-                # Project the "Ghost Wall" based on current velocity
-                point = robot_pos + velocity * (self.PROJECTEDFRAMES / CONTROL_FREQUENCY)
-                obstacle_segment = (robot_pos, point)
+        # Project the "Ghost Wall" based on current velocity
+        starts = snapshot.positions[nearby]
+        ends = starts + snapshot.velocities[nearby] * (self.PROJECTEDFRAMES / CONTROL_FREQUENCY)
+        obstacle_list = list(zip(starts, ends))
 
-                obstacle_list.append(obstacle_segment)
-
-                # DRAWING: Show the projected velocity line in Red
-                if self._env is not None:
-                    self._env.draw_line(obstacle_segment, color="Red")
+        # DRAWING: Show the projected velocity lines in Red
+        if self._env is not None:
+            for obstacle_segment in obstacle_list:
+                self._env.draw_line(obstacle_segment, color="Red")
 
         # Field bounds as obstacles (static, usually not drawn to keep screen clean)
         tl, br = np.array(field_bounds.top_left), np.array(field_bounds.bottom_right)
@@ -246,6 +289,70 @@ class FastPathPlanner:
                 break
         return safe_target
 
+    def _plan_with_cache(
+        self,
+        robot_id: int,
+        our_pos: np.ndarray,
+        target: np.ndarray,
+        obstacles: List[Tuple[np.ndarray, np.ndarray]],
+        field_bounds: FieldBounds,
+    ) -> Tuple[List[Tuple[np.ndarray, np.ndarray]], str]:
+        """Returns the trajectory and whether it was a cache "hit", "repair" or "miss"."""
+        obstacle_array = np.array([(o[0], o[1]) for o in obstacles], dtype=float).reshape(-1, 2, 2)
+        cached = self._path_cache.get(robot_id) if self.config.PATH_CACHE else None
+
+        if (
+            cached is None
+            or distance(cached.target, target) > self.config.CACHE_TARGET_TOLERANCE
+            or cached.obstacles.shape != obstacle_array.shape
+        ):
+            trajectory, _ = self.check_segment((our_pos, target), obstacles, 0, target, field_bounds)
+            outcome = "miss"
+            validated = True
+        else:
+            waypoints = list(cached.waypoints)
+            while waypoints and distance(our_pos, waypoints[0]) < self.config.WAYPOINT_REACHED_DISTANCE:
+                waypoints.pop(0)
+            points = [our_pos, *waypoints, target]
+            segments = list(zip(points[:-1], points[1:]))
+
+            # If nothing has moved much since the whole path was last checked, only the first segment (which
+            # starts at the robot's new position) can have become blocked.
+            drift = np.max(np.linalg.norm(cached.obstacles - obstacle_array, axis=2), initial=0.0)
+            to_check = len(segments) if drift > self.config.CACHE_OBSTACLE_TOLERANCE else 1
+            validated = to_check == len(segments)
+
+            trajectory = []
+            outcome = "hit"
+            for i, segment in enumerate(segments):
+                if i < to_check and self.collides(segment, obstacles) is not None:
+                    repaired, _ = self.check_segment(segment, obstacles, 0, target, field_bounds)
+                    trajectory.extend(repaired)
+                    outcome = "repair"
+                else:
+                    trajectory.append(segment)
+
+        if self.config.PATH_CACHE:
+            waypoints = [seg[1] for seg in trajectory[:-1]]
+            if validated:
+                self._path_cache[robot_id] = _CachedPath(target=target, waypoints=waypoints, obstacles=obstacle_array)
+            else:
+                # Keep the scene of the last full check as the baseline, so slow drift adds up across ticks
+                cached.waypoints = waypoints
+        return trajectory, outcome
+
+    def _record(self, outcome: str, seconds: float):
+        stats = self.cache_stats
+        if outcome == "hit":
+            stats.hits += 1
+            stats.hit_time += seconds
+        elif outcome == "repair":
+            stats.repairs += 1
+            stats.repair_time += seconds
+        else:
+            stats.misses += 1
+            stats.miss_time += seconds
+
     def _path_to(
         self,
         game: Game,
@@ -268,8 +375,10 @@ class FastPathPlanner:
         # 3. Sanitize target (Critical for velocity obstacles)
         safe_target = self.sanitize_target(raw_target, obstacles, our_pos)
 
-        # 4. Plan geometric path
-        final_trajectory, _ = self.check_segment((our_pos, safe_target), obstacles, 0, safe_target, field_bounds)
+        # 4. Plan geometric path, reusing last tick's path for this robot when it still fits
+        start_time = time.perf_counter()
+        final_trajectory, outcome = self._plan_with_cache(robot_id, our_pos, safe_target, obstacles, field_bounds)
+        self._record(outcome, time.perf_counter() - start_time)
 
         # 5. Draw the resulting safe path segments
         if self._env is not None:
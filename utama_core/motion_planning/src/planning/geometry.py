@@ -2,7 +2,8 @@
 
 The Dynamic Window planner previously relied on Shapely primitives inside the
 per-frame evaluation loop. To reduce per-step overhead we replace those calls
-with simple numeric utilities implemented here.
+with simple numeric utilities implemented here, which in turn call the float
+kernels in ``utama_core.global_utils.geometry_kernels``.
 """
 
 from __future__ import annotations
@@ -13,6 +14,8 @@ from typing import Iterable, Tuple
 
 import numpy as np
 
+from utama_core.global_utils import geometry_kernels as kernels
+
 EPSILON = 1e-9
 
 
@@ -22,54 +25,24 @@ def _clamp(value: float, minimum: float, maximum: float) -> float:
 
 def point_segment_distance(point: np.ndarray, start: np.ndarray, end: np.ndarray, eps: float = 1e-9) -> float:
     """Optimized minimal Euclidean distance between a point and a line segment (2D)."""
-    segment = end - start
-    denom = np.dot(segment, segment)
-
-    if denom < eps:
-        # Degenerate segment (start == end)
-        diff = point - start
-        return np.sqrt(np.dot(diff, diff))
-
-    t = np.dot(point - start, segment) / denom
-    # Clamp t without calling another function
-    t = np.clip(t, 0.0, 1.0)
-    projection = start + float(t) * segment
-    diff = point - projection
-    return np.sqrt(np.dot(diff, diff))
-
-
-def _orientation(a: np.ndarray, b: np.ndarray, c: np.ndarray) -> float:
-    return float((b[0] - a[0]) * (c[1] - a[1]) - (b[1] - a[1]) * (c[0] - a[0]))
-
-
-def _on_segment(a: np.ndarray, b: np.ndarray, c: np.ndarray) -> bool:
-    return (
-        min(a[0], c[0]) - EPSILON <= b[0] <= max(a[0], c[0]) + EPSILON
-        and min(a[1], c[1]) - EPSILON <= b[1] <= max(a[1], c[1]) + EPSILON
+    return kernels.point_segment_distance(
+        float(point[0]), float(point[1]), float(start[0]), float(start[1]), float(end[0]), float(end[1]), eps
     )
 
 
 def segments_intersect(p1: np.ndarray, q1: np.ndarray, p2: np.ndarray, q2: np.ndarray) -> bool:
     """Return True if the two closed segments intersect."""
-
-    o1 = _orientation(p1, q1, p2)
-    o2 = _orientation(p1, q1, q2)
-    o3 = _orientation(p2, q2, p1)
-    o4 = _orientation(p2, q2, q1)
-
-    if (o1 > 0 and o2 < 0 or o1 < 0 and o2 > 0) and (o3 > 0 and o4 < 0 or o3 < 0 and o4 > 0):
-        return True
-
-    if abs(o1) <= EPSILON and _on_segment(p1, p2, q1):
-        return True
-    if abs(o2) <= EPSILON and _on_segment(p1, q2, q1):
-        return True
-    if abs(o3) <= EPSILON and _on_segment(p2, p1, q2):
-        return True
-    if abs(o4) <= EPSILON and _on_segment(p2, q1, q2):
-        return True
-
-    return False
+    return kernels.segments_intersect(
+        float(p1[0]),
+        float(p1[1]),
+        float(q1[0]),
+        float(q1[1]),
+        float(p2[0]),
+        float(p2[1]),
+        float(q2[0]),
+        float(q2[1]),
+        EPSILON,
+    )
 
 
 def segment_to_segment_distance(
@@ -78,14 +51,16 @@ def segment_to_segment_distance(
     b_start: np.ndarray,
     b_end: np.ndarray,
 ) -> float:
-    if segments_intersect(a_start, a_end, b_start, b_end):
-        return 0.0
-
-    return min(
-        point_segment_distance(a_start, b_start, b_end),
-        point_segment_distance(a_end, b_start, b_end),
-        point_segment_distance(b_start, a_start, a_end),
-        point_segment_distance(b_end, a_start, a_end),
+    return kernels.segment_to_segment_distance(
+        float(a_start[0]),
+        float(a_start[1]),
+        float(a_end[0]),
+        float(a_end[1]),
+        float(b_start[0]),
+        float(b_start[1]),
+        float(b_end[0]),
+        float(b_end[1]),
+        EPSILON,
     )
 
 
@@ -161,24 +136,14 @@ class AxisAlignedRectangle:
         return float(target[0]), float(target[1])
 
     def distance_to_segment(self, start: np.ndarray, end: np.ndarray) -> float:
-        if self.contains_array(start) or self.contains_array(end):
-            return 0.0
-
-        distances = [
-            self.distance_to_boundary_array(start),
-            self.distance_to_boundary_array(end),
-        ]
-
-        for edge_start, edge_end in self._edges():
-            distances.append(segment_to_segment_distance(start, end, edge_start, edge_end))
-
-        return min(distances)
-
-    def _edges(self) -> Iterable[Tuple[np.ndarray, np.ndarray]]:
-        corners = list(self.corners())
-        return (
-            (corners[0], corners[1]),
-            (corners[1], corners[2]),
-            (corners[2], corners[3]),
-            (corners[3], corners[0]),
+        return kernels.rect_segment_distance(
+            float(self.min_x),
+            float(self.max_x),
+            float(self.min_y),
+            float(self.max_y),
+            float(start[0]),
+            float(start[1]),
+            float(end[0]),
+            float(end[1]),
+            EPSILON,
         )
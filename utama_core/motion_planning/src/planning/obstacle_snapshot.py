@@ -0,0 +1,217 @@
+"""Per-tick obstacle snapshot shared by the motion planners.
+
+Every planner used to rebuild its own list of obstacle robots for every robot on every tick and then test candidate
+segments against them one object at a time. ``ObstacleSnapshot.for_game`` instead packs the robot positions,
+velocities and any temporary ``ObstacleRegion`` rectangles of one game frame into contiguous arrays once, and all
+planners (for all robots of that side) query the same snapshot until the frame changes.
+
+Queries go through a uniform grid broadphase: each robot is binned into a cell and each rectangle records the range
+of cells it covers, so a query only runs the exact distance computation on obstacles whose cells overlap the query
+box. The exact distances are then computed for all remaining candidates in one batched call into
+``global_utils.geometry_kernels``.
+"""
+
+from __future__ import annotations
+
+from typing import Iterable, Optional
+
+import numpy as np
+
+from utama_core.entities.data.vector import VectorArray
+from utama_core.entities.game import Game
+from utama_core.global_utils.geometry_kernels import (
+    points_to_segment_distance,
+    rects_to_segments_distance,
+)
+from utama_core.motion_planning.src.planning.obstacles import ObstacleRegion
+
+# Roughly the clearance the planners work with; a query box usually spans only a handful of cells.
+DEFAULT_CELL_SIZE = 0.5
+
+_EMPTY_INDICES = np.empty(0, dtype=np.intp)
+
+
+class UniformGrid:
+    """Uniform grid over points and axis-aligned boxes, queried with an axis-aligned box.
+
+    Rather than hashing objects into per-cell buckets, each object stores the (inclusive) range of cell indices it
+    covers. A query compares integer ranges for all objects at once, which for the tens of objects on an SSL field
+    is cheaper than walking bucket lists in Python while still rejecting everything outside the query's cells.
+    """
+
+    def __init__(self, cell_size: float = DEFAULT_CELL_SIZE):
+        if cell_size <= 0:
+            raise ValueError("cell_size must be positive.")
+        self.cell_size = cell_size
+        self._inv = 1.0 / cell_size
+        self._cell_min = np.empty((0, 2), dtype=np.int64)
+        self._cell_max = np.empty((0, 2), dtype=np.int64)
+
+    def build(self, box_min: np.ndarray, box_max: np.ndarray) -> "UniformGrid":
+        """Bins ``n`` objects given their (n, 2) bounding-box corners; points have ``box_min == box_max``."""
+        self._cell_min = self._cells(box_min)
+        self._cell_max = self._cells(box_max)
+        return self
+
+    def query(self, box_min: np.ndarray, box_max: np.ndarray) -> np.ndarray:
+        """Indices of objects whose cells overlap the cells of the query box."""
+        if self._cell_min.shape[0] == 0:
+            return _EMPTY_INDICES
+        q_min = self._cells(box_min)
+        q_max = self._cells(box_max)
+        overlap = np.all((self._cell_max >= q_min) & (self._cell_min <= q_max), axis=1)
+        return np.flatnonzero(overlap)
+
+    def _cells(self, points: np.ndarray) -> np.ndarray:
+        return np.floor(np.asarray(points, dtype=float) * self._inv).astype(np.int64)
+
+
+class ObstacleSnapshot:
+    """Robot and region obstacles of one game frame in contiguous arrays.
+
+    Attributes:
+        robot_ids: (n,) ids of the robots, friendly first then enemy.
+        is_friendly: (n,) True for friendly robots.
+        positions: (n, 2) robot positions in metres.
+        velocities: (n, 2) robot velocities in m/s.
+        rects: (m, 4) ``min_x, max_x, min_y, max_y`` of the temporary obstacle regions.
+    """
+
+    def __init__(
+        self,
+        robot_ids: np.ndarray,
+        is_friendly: np.ndarray,
+        positions: np.ndarray,
+        velocities: np.ndarray,
+        rects: Optional[np.ndarray] = None,
+        cell_size: float = DEFAULT_CELL_SIZE,
+    ):
+        self.robot_ids = robot_ids
+        self.is_friendly = is_friendly
+        self.positions = positions
+        self.velocities = velocities
+        self.rects = np.empty((0, 4)) if rects is None else rects
+        self._robot_grid = UniformGrid(cell_size).build(positions, positions)
+        self._rect_grid = UniformGrid(cell_size).build(self.rects[:, [0, 2]], self.rects[:, [1, 3]])
+
+    @classmethod
+    def from_game(
+        cls,
+        game: Game,
+        temporary_obstacles: Iterable[ObstacleRegion] = (),
+        cell_size: float = DEFAULT_CELL_SIZE,
+    ) -> "ObstacleSnapshot":
+        robots = list(game.friendly_robots.values()) + list(game.enemy_robots.values())
+        n = len(robots)
+        positions = VectorArray.from_objects(robots, "p").data
+        velocities = VectorArray.from_objects(robots, "v").data
+        robot_ids = np.fromiter((r.id for r in robots), dtype=np.int64, count=n)
+        is_friendly = np.arange(n) < len(game.friendly_robots)
+
+        rects = [(o.rect.min_x, o.rect.max_x, o.rect.min_y, o.rect.max_y) for o in temporary_obstacles]
+        rect_array = np.array(rects, dtype=float).reshape(-1, 4)
+        return cls(robot_ids, is_friendly, positions, velocities, rect_array, cell_size)
+
+    @classmethod
+    def for_game(cls, game: Game) -> "ObstacleSnapshot":
+        """The robot-only snapshot for ``game``'s current frame, built once per frame and shared by all callers."""
+        frame = game.current
+        snapshot = getattr(frame, "obstacle_snapshot", None)
+        if snapshot is None:
+            snapshot = cls.from_game(game)
+            # The frame is frozen; the snapshot is derived from it and lives and dies with it. Two threads racing
+            # here build equal snapshots and one simply wins.
+            object.__setattr__(frame, "obstacle_snapshot", snapshot)
+        return snapshot
+
+    def with_regions(self, temporary_obstacles: Iterable[ObstacleRegion]) -> "ObstacleSnapshot":
+        """A snapshot sharing these robot arrays with the given regions added; returns self if there are none."""
+        rects = [(o.rect.min_x, o.rect.max_x, o.rect.min_y, o.rect.max_y) for o in temporary_obstacles]
+        if not rects:
+            return self
+        rect_array = np.vstack([self.rects, np.array(rects, dtype=float)])
+        return ObstacleSnapshot(
+            self.robot_ids, self.is_friendly, self.positions, self.velocities, rect_array, self._robot_grid.cell_size
+        )
+
+    @property
+    def n_robots(self) -> int:
+        return self.positions.shape[0]
+
+    def others(self, friendly_robot_id: Optional[int]) -> np.ndarray:
+        """Indices of every robot except the friendly robot ``friendly_robot_id``."""
+        keep = ~(self.is_friendly & (self.robot_ids == friendly_robot_id))
+        return np.flatnonzero(keep)
+
+    def robots_near_segment(
+        self,
+        start: np.ndarray,
+        end: np.ndarray,
+        radius: float,
+        exclude_friendly_id: Optional[int] = None,
+    ) -> np.ndarray:
+        """Broadphase: indices of robots that may lie within ``radius`` of the segment (a point if start == end)."""
+        start = np.asarray(start, dtype=float)
+        end = np.asarray(end, dtype=float)
+        idx = self._robot_grid.query(np.minimum(start, end) - radius, np.maximum(start, end) + radius)
+        if exclude_friendly_id is not None and idx.size:
+            idx = idx[~(self.is_friendly[idx] & (self.robot_ids[idx] == exclude_friendly_id))]
+        return idx
+
+    def robot_distances_to_segment(self, start: np.ndarray, end: np.ndarray, idx: np.ndarray) -> np.ndarray:
+        """Exact distances from the robots ``idx`` to the segment start-end."""
+        return points_to_segment_distance(self.positions[idx], np.asarray(start, float), np.asarray(end, float))
+
+    def min_robot_distance(
+        self,
+        start: np.ndarray,
+        end: Optional[np.ndarray] = None,
+        radius: float = np.inf,
+        exclude_friendly_id: Optional[int] = None,
+    ) -> float:
+        """Distance from the point / segment to the nearest robot, or inf if none is within ``radius``."""
+        end = start if end is None else end
+        if np.isfinite(radius):
+            idx = self.robots_near_segment(start, end, radius, exclude_friendly_id)
+        else:
+            idx = self.others(exclude_friendly_id)
+        if idx.size == 0:
+            return float("inf")
+        distances = self.robot_distances_to_segment(start, end, idx)
+        nearest = float(distances.min())
+        return nearest if nearest <= radius else float("inf")
+
+    def rects_near_segment(self, start: np.ndarray, end: np.ndarray, radius: float) -> np.ndarray:
+        """Broadphase: indices of rectangles that may lie within ``radius`` of the segment."""
+        start = np.asarray(start, dtype=float)
+        end = np.asarray(end, dtype=float)
+        return self._rect_grid.query(np.minimum(start, end) - radius, np.maximum(start, end) + radius)
+
+    def segment_hits_rect(self, start: np.ndarray, end: np.ndarray, clearance: float) -> bool:
+        """True if the segment comes within ``clearance`` of any rectangle."""
+        idx = self.rects_near_segment(start, end, clearance)
+        if idx.size == 0:
+            return False
+        return bool(np.any(rects_to_segment_distance(self.rects[idx], start, end) < clearance))
+
+    def segments_hit_rects(self, starts: np.ndarray, ends: np.ndarray, clearance: float) -> np.ndarray:
+        """(k,) True for each of the (k, 2) segments that comes within ``clearance`` of any rectangle."""
+        hits = np.zeros(starts.shape[0], dtype=bool)
+        if self.rects.shape[0] == 0:
+            return hits
+        idx = self._rect_grid.query(
+            np.minimum(starts, ends).min(axis=0) - clearance, np.maximum(starts, ends).max(axis=0) + clearance
+        )
+        if idx.size:
+            hits = np.any(rects_to_segments_distance(self.rects[idx], starts, ends) < clearance, axis=1)
+        return hits
+
+
+def rects_to_segment_distance(rects: np.ndarray, start: np.ndarray, end: np.ndarray) -> np.ndarray:
+    """Distances from each of the (m, 4) ``min_x, max_x, min_y, max_y`` rectangles to the segment start-end.
+
+    Zero when the segment touches or crosses the rectangle, matching ``AxisAlignedRectangle.distance_to_segment``.
+    """
+    starts = np.asarray(start, dtype=float)[None]
+    ends = np.asarray(end, dtype=float)[None]
+    return rects_to_segments_distance(rects, starts, ends)[0]
@@ -1,7 +1,10 @@
 import logging
+import math
 import random
+import time
+from dataclasses import dataclass
 from math import dist, pi
-from typing import Generator, List, Optional, Tuple, Union
+from typing import Dict, Generator, List, Optional, Tuple, Union
 
 import numpy as np
 
@@ -11,6 +14,13 @@ from utama_core.motion_planning.src.planning.geometry import (
     AxisAlignedRectangle,
     point_segment_distance,
 )
+from utama_core.motion_planning.src.planning.geometry import (
+    segment_to_segment_distance as _segment_to_segment_distance,
+)
+from utama_core.motion_planning.src.planning.obstacle_snapshot import (
+    ObstacleSnapshot,
+    points_to_segment_distance,
+)
 from utama_core.motion_planning.src.planning.obstacles import (
     ObstacleRegion,
     to_rectangles,
@@ -62,68 +72,12 @@ def segment_length(p1: np.ndarray, p2: np.ndarray) -> float:
 
 def point_to_segment_distance(point: np.ndarray, seg_start: np.ndarray, seg_end: np.ndarray) -> float:
     """Compute the shortest distance between a point and a line segment."""
-    seg_vec = seg_end - seg_start
-    t = np.clip(np.dot(point - seg_start, seg_vec) / np.dot(seg_vec, seg_vec), 0, 1)
-    proj = seg_start + t * seg_vec
-    return np.linalg.norm(point - proj)
+    return point_segment_distance(point, seg_start, seg_end)
 
 
 def segment_to_segment_distance(a1: np.ndarray, a2: np.ndarray, b1: np.ndarray, b2: np.ndarray) -> float:
     """Shortest distance between two line segments in 2D."""
-
-    u = a2 - a1
-    v = b2 - b1
-    w = a1 - b1
-    a = np.dot(u, u)
-    b = np.dot(u, v)
-    c = np.dot(v, v)
-    d = np.dot(u, w)
-    e = np.dot(v, w)
-    D = a * c - b * b
-    sc, sN, sD = D, D, D
-    tc, tN, tD = D, D, D
-    SMALL_NUM = 1e-9
-
-    if D < SMALL_NUM:
-        sN = 0.0
-        sD = 1.0
-        tN = e
-        tD = c
-    else:
-        sN = b * e - c * d
-        tN = a * e - b * d
-        if sN < 0.0:
-            sN = 0.0
-            tN = e
-            tD = c
-        elif sN > sD:
-            sN = sD
-            tN = e + b
-            tD = c
-
-    if tN < 0.0:
-        tN = 0.0
-        if -d < 0.0:
-            sN = 0.0
-        elif -d > a:
-            sN = sD
-        else:
-            sN = -d
-            sD = a
-    elif tN > tD:
-        tN = tD
-        if (-d + b) < 0.0:
-            sN = 0
-        elif (-d + b) > a:
-            sN = sD
-        else:
-            sN = -d + b
-            sD = a
-
-    sc = 0.0 if abs(sN) < SMALL_NUM else sN / sD
-    tc = 0.0 if abs(tN) < SMALL_NUM else tN / tD
-    dP = w + (sc * u) - (tc * v)
-    return np.linalg.norm(dP)
+    return _segment_to_segment_distance(a1, a2, b1, b2)
 
 
 def rotate_vector(vec: np.ndarray, angle_deg: float) -> np.ndarray:
@@ -161,20 +115,14 @@ class RRTPlanner:
         self.waypoints = []
         self.par = dict()
 
-    def _get_obstacles(self, robot_id: int) -> List[np.ndarray]:
-        robots = (
-            self._game.friendly_robots[:robot_id] + self._game.friendly_robots[robot_id + 1 :] + self._game.enemy_robots
-        )
-        return [np.array([r.x, r.y]) for r in robots]
+    def _get_obstacles(self, robot_id: int) -> np.ndarray:
+        snapshot = ObstacleSnapshot.for_game(self._game)
+        return snapshot.positions[snapshot.others(robot_id)]
 
     def _closest_obstacle(self, robot_id: int, seg_start: np.ndarray, seg_end: Optional[np.ndarray] = None) -> float:
         """Return minimum distance to any robot obstacle."""
-        obs = self._get_obstacles(robot_id)
-        if not obs:
-            return float("inf")
-        if seg_end is None:
-            return min(distance(o, seg_start) for o in obs)
-        return min(point_to_segment_distance(o, seg_start, seg_end) for o in obs)
+        snapshot = ObstacleSnapshot.for_game(self._game)
+        return snapshot.min_robot_distance(seg_start, seg_end, exclude_friendly_id=robot_id)
 
     def path_to(
         self,
@@ -242,6 +190,253 @@ class RRTPlanner:
         return path
 
 
+class _NodeGrid:
+    """Incremental uniform-grid index over tree nodes for nearest and radius queries."""
+
+    def __init__(self, cell_size: float):
+        self.cell_size = cell_size
+        self._cells: Dict[Tuple[int, int], List[int]] = {}
+
+    def _cell(self, point: np.ndarray) -> Tuple[int, int]:
+        return int(math.floor(point[0] / self.cell_size)), int(math.floor(point[1] / self.cell_size))
+
+    def add(self, index: int, point: np.ndarray):
+        self._cells.setdefault(self._cell(point), []).append(index)
+
+    def near(self, point: np.ndarray, radius: float, positions: np.ndarray) -> np.ndarray:
+        """Indices of nodes within ``radius`` of ``point``."""
+        cx, cy = self._cell(point)
+        reach = int(math.ceil(radius / self.cell_size))
+        candidates = [
+            i
+            for dx in range(-reach, reach + 1)
+            for dy in range(-reach, reach + 1)
+            for i in self._cells.get((cx + dx, cy + dy), ())
+        ]
+        if not candidates:
+            return np.empty(0, dtype=np.intp)
+        idx = np.array(candidates, dtype=np.intp)
+        offsets = positions[idx] - point
+        return idx[np.einsum("ij,ij->i", offsets, offsets) <= radius * radius]
+
+    def nearest(self, point: np.ndarray, positions: np.ndarray) -> int:
+        """Index of the node nearest ``point``, searching rings of cells outwards. The grid must not be empty."""
+        cx, cy = self._cell(point)
+        best, best_d_sq = -1, math.inf
+        ring = 0
+        while True:
+            for dx in range(-ring, ring + 1):
+                for dy in range(-ring, ring + 1):
+                    if max(abs(dx), abs(dy)) != ring:
+                        continue
+                    for i in self._cells.get((cx + dx, cy + dy), ()):
+                        d_sq = float(np.sum((positions[i] - point) ** 2))
+                        if d_sq < best_d_sq:
+                            best, best_d_sq = i, d_sq
+            # Every unvisited cell is at least `ring` whole cells away.
+            if best >= 0 and best_d_sq <= (ring * self.cell_size) ** 2:
+                return best
+            ring += 1
+
+
+@dataclass
+class _RRTTree:
+    positions: np.ndarray  # (capacity, 2); rows [0, size) are used
+    parents: np.ndarray  # (capacity,) parent index, -1 for the root
+    costs: np.ndarray  # (capacity,) path length from the root
+    grid: _NodeGrid
+    size: int = 0
+
+    @classmethod
+    def rooted_at(cls, root: np.ndarray, cell_size: float, capacity: int = 256) -> "_RRTTree":
+        tree = cls(np.empty((capacity, 2)), np.empty(capacity, dtype=np.intp), np.empty(capacity), _NodeGrid(cell_size))
+        tree.add(root, -1, 0.0)
+        return tree
+
+    def add(self, point: np.ndarray, parent: int, cost: float) -> int:
+        if self.size == self.positions.shape[0]:
+            capacity = 2 * self.size
+            self.positions = np.resize(self.positions, (capacity, 2))
+            self.parents = np.resize(self.parents, capacity)
+            self.costs = np.resize(self.costs, capacity)
+        i = self.size
+        self.positions[i] = point
+        self.parents[i] = parent
+        self.costs[i] = cost
+        self.grid.add(i, point)
+        self.size += 1
+        return i
+
+    def path_to_root(self, index: int) -> List[Tuple[float, float]]:
+        path = []
+        while index >= 0:
+            path.append(point_to_tuple(self.positions[index]))
+            index = self.parents[index]
+        path.reverse()
+        return path
+
+
+@dataclass
+class _WarmStart:
+    goal: np.ndarray
+    path: List[Tuple[float, float]]  # best path of the previous call, start to goal
+    nodes: np.ndarray  # (n, 2) node positions of the previous tree
+
+
+@dataclass
+class _BestGoal:
+    parent: int = -1  # tree node connected to the goal
+    cost: float = math.inf
+
+
+class AnytimeRRTStarPlanner(RRTPlanner):
+    """Time-budgeted RRT* that returns the best path found when its budget runs out.
+
+    Nearest-neighbour and rewiring queries go through an incremental uniform grid over the tree nodes. Each
+    robot's previous path and tree nodes are kept, and when the goal has moved less than WARM_START_TOLERANCE
+    they seed the next call's tree (re-rooted at the robot's new position, with every reused edge re-checked), so
+    a query that barely changed usually has a solution within its first few iterations.
+
+    Costs of a rewired node's descendants are not propagated; they only ever overestimate, so later
+    choose-parent decisions stay valid but may be slightly conservative.
+    """
+
+    GOAL_SAMPLE_RATE = 0.2
+    REWIRE_RADIUS = 3 * RRTPlanner.STEP_SIZE
+    WARM_START_TOLERANCE = 0.1
+    GRID_CELL_SIZE = RRTPlanner.STEP_SIZE * 2
+
+    def __init__(self, game: Game, seed: Optional[int] = None):
+        super().__init__(game)
+        self._rng = random.Random(seed)
+        self._warm: Dict[int, _WarmStart] = {}
+        self.last_iterations = 0
+        self.last_warm_started = False
+
+    def reset(self, robot_id: Optional[int] = None):
+        """Drop the warm-start state of ``robot_id``, or of every robot."""
+        if robot_id is None:
+            self._warm.clear()
+        else:
+            self._warm.pop(robot_id, None)
+
+    def _edge_free(self, robot_id: int, a: np.ndarray, b: np.ndarray) -> bool:
+        snapshot = ObstacleSnapshot.for_game(self._game)
+        radius = self.SAFE_OBSTACLES_RADIUS
+        return snapshot.min_robot_distance(a, b, radius=radius, exclude_friendly_id=robot_id) > radius
+
+    def path_to(
+        self,
+        friendly_robot_id: int,
+        target: Tuple[float, float],
+        max_iterations: int = 3000,
+        budget_ms: float = 5.0,
+        game: Optional[Game] = None,
+    ) -> Optional[List[Tuple[float, float]]]:
+        """Plans from the robot to ``target`` within ``budget_ms`` of wall-clock time.
+
+        Args:
+            friendly_robot_id (int): Robot to plan for.
+            target (Tuple[float, float]): Goal position.
+            max_iterations (int): Upper bound on sampling iterations, independent of the budget.
+            budget_ms (float): Wall-clock budget in milliseconds.
+            game (Game, optional): Current game state; replaces the one given at construction.
+
+        Returns:
+            Optional[List[Tuple[float, float]]]: Best path found so far (start to goal), or None if the goal was
+            not reached within the budget.
+        """
+        deadline = time.perf_counter() + budget_ms / 1000.0
+        if game is not None:
+            self._game = game
+        robot = self._game.friendly_robots[friendly_robot_id]
+        start = np.array([robot.p.x, robot.p.y], dtype=float)
+        goal = np.array(target, dtype=float)
+        self.last_iterations = 0
+        self.last_warm_started = False
+
+        if self._closest_obstacle(friendly_robot_id, goal) < ROBOT_DIAMETER / 2:
+            return [tuple(start)]
+        if distance(start, goal) < ROBOT_DIAMETER / 2:
+            return [tuple(goal)]
+        if self._closest_obstacle(friendly_robot_id, start, goal) > 3 * self.SAFE_OBSTACLES_RADIUS:
+            return [tuple(goal)]
+
+        tree = _RRTTree.rooted_at(start, self.GRID_CELL_SIZE)
+        best = _BestGoal()
+        direct = distance(start, goal)
+        good_enough = min(self.GOOD_ENOUGH_REL * direct, direct + self.GOOD_ENOUGH_ABS)
+
+        warm = self._warm.get(friendly_robot_id)
+        if warm is not None and distance(warm.goal, goal) <= self.WARM_START_TOLERANCE:
+            self.last_warm_started = True
+            # Previous best path first so a solution is usually available straight away, then the rest of the tree.
+            seeds = [np.array(p) for p in warm.path[1:-1]] + list(warm.nodes)
+            for seed in seeds:
+                if time.perf_counter() >= deadline:
+                    break
+                self._insert(friendly_robot_id, tree, seed, goal, best)
+
+        bounds = self._game.field.field_bounds
+        min_x, max_x = sorted((bounds.top_left[0], bounds.bottom_right[0]))
+        min_y, max_y = sorted((bounds.top_left[1], bounds.bottom_right[1]))
+
+        for _ in range(max_iterations):
+            if best.cost <= good_enough or time.perf_counter() >= deadline:
+                break
+            self.last_iterations += 1
+            if self._rng.random() < self.GOAL_SAMPLE_RATE:
+                sample = goal
+            else:
+                sample = np.array([self._rng.uniform(min_x, max_x), self._rng.uniform(min_y, max_y)])
+
+            nearest = tree.grid.nearest(sample, tree.positions)
+            direction = sample - tree.positions[nearest]
+            length = np.linalg.norm(direction)
+            if length == 0:
+                continue
+            new_point = tree.positions[nearest] + direction * min(1.0, self.STEP_SIZE / length)
+            self._insert(friendly_robot_id, tree, new_point, goal, best)
+
+        self._warm[friendly_robot_id] = _WarmStart(
+            goal=goal,
+            path=tree.path_to_root(best.parent) + [tuple(goal)] if best.parent >= 0 else [],
+            nodes=tree.positions[: tree.size].copy(),
+        )
+        if best.parent < 0:
+            return None
+        return tree.path_to_root(best.parent) + [point_to_tuple(goal)]
+
+    def _insert(self, robot_id: int, tree: _RRTTree, point: np.ndarray, goal: np.ndarray, best: _BestGoal):
+        """RRT* extension: pick the cheapest collision-free parent near ``point``, add it, rewire neighbours."""
+        near = tree.grid.near(point, self.REWIRE_RADIUS, tree.positions)
+        if near.size == 0:
+            return
+        via = tree.costs[near] + np.linalg.norm(tree.positions[near] - point, axis=1)
+        parent = -1
+        for k in np.argsort(via):
+            if self._edge_free(robot_id, tree.positions[near[k]], point):
+                parent = int(near[k])
+                cost = float(via[k])
+                break
+        if parent < 0:
+            return
+
+        new = tree.add(point, parent, cost)
+        for j in near:
+            if j == parent:
+                continue
+            rewired = cost + distance(point, tree.positions[j])
+            if rewired < tree.costs[j] and self._edge_free(robot_id, point, tree.positions[j]):
+                tree.parents[j] = new
+                tree.costs[j] = rewired
+
+        to_goal = distance(point, goal)
+        if to_goal < self.STOPPING_DISTANCE and cost + to_goal < best.cost and self._edge_free(robot_id, point, goal):
+            best.parent = new
+            best.cost = cost + to_goal
+
+
 class BisectorPlanner:
     OBSTACLE_CLEARANCE = ROBOT_DIAMETER
     CLOSE_LIMIT = 0.5
@@ -252,11 +447,9 @@ class BisectorPlanner:
         self._friendly_colour = friendly_colour
         self._env = env
 
-    def _get_obstacles(self, robot_id: int) -> List[np.ndarray]:
-        robots = (
-            self._game.friendly_robots[:robot_id] + self._game.friendly_robots[robot_id + 1 :] + self._game.enemy_robots
-        )
-        return [np.array([r.x, r.y]) for r in robots]
+    def _get_obstacles(self, robot_id: int) -> np.ndarray:
+        snapshot = ObstacleSnapshot.for_game(self._game)
+        return snapshot.positions[snapshot.others(robot_id)]
 
     def perpendicular_bisector(self, start: np.ndarray, end: np.ndarray) -> np.ndarray:
         mid = (start + end) / 2
@@ -303,11 +496,9 @@ class BisectorPlanner:
                 seg1_start, seg1_end = our_pos, p1
                 seg2_start, seg2_end = p1, target
 
-                if all(
-                    point_to_segment_distance(o, seg1_start, seg1_end) > self.OBSTACLE_CLEARANCE for o in obstacles
-                ) and all(
-                    point_to_segment_distance(o, seg2_start, seg2_end) > self.OBSTACLE_CLEARANCE for o in obstacles
-                ):
+                seg1_clear = points_to_segment_distance(obstacles, seg1_start, seg1_end) > self.OBSTACLE_CLEARANCE
+                seg2_clear = points_to_segment_distance(obstacles, seg2_start, seg2_end) > self.OBSTACLE_CLEARANCE
+                if np.all(seg1_clear) and np.all(seg2_clear):
                     if not intersects_any_polygon(
                         seg1_start, seg1_end, temporary_obstacles
                     ) and not intersects_any_polygon(seg2_start, seg2_end, temporary_obstacles):
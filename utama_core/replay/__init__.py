@@ -1 +1,2 @@
+from utama_core.replay.entities import OverflowPolicy, ReplayFormat
 from utama_core.replay.replay_writer import ReplayWriterConfig
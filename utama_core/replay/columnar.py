@@ -0,0 +1,398 @@
+"""Chunked columnar replay format.
+
+A columnar replay file is a small JSON header followed by a flat array of fixed-size
+frame records (see ``FRAME_DTYPE``). Because every record has the same size the file
+can be memory-mapped directly as a NumPy record array: frame ``i`` lives at a known byte
+offset, the ``ts`` column doubles as the frame index for timestamp seeks, and a single
+robot's trajectory is just a strided view into the mapped file.
+
+Layout::
+
+    MAGIC (4 bytes) | version (uint16) | header_len (uint32) | JSON header | padding | records...
+
+The header is padded so that the first record starts on a ``HEADER_ALIGNMENT`` boundary.
+"""
+
+import json
+import mmap
+import struct
+from pathlib import Path
+from typing import Dict, Optional, Tuple, Union
+
+import numpy as np
+
+from utama_core.config.physical_constants import ROBOT_ID_SLOTS
+from utama_core.entities.data.referee import RefereeData
+from utama_core.entities.data.vector import Vector2D, Vector3D
+from utama_core.entities.game.ball import Ball
+from utama_core.entities.game.game_frame import GameFrame
+from utama_core.entities.game.robot import Robot
+from utama_core.entities.game.team_info import TeamInfo
+from utama_core.entities.referee.referee_command import RefereeCommand
+from utama_core.entities.referee.stage import Stage
+from utama_core.replay.entities import ReplayMetadata
+
+COLUMNAR_SUFFIX = ".utr"
+MAGIC = b"UTRP"
+FORMAT_VERSION = 1
+HEADER_ALIGNMENT = 64
+_PREAMBLE = struct.Struct("<4sHI")
+
+# One slot per SSL robot pattern id, indexed directly by robot id.
+ROBOT_SLOTS = ROBOT_ID_SLOTS
+
+ROBOT_DTYPE = np.dtype(
+    [
+        ("present", "?"),
+        ("has_ball", "?"),
+        ("p", "<f8", (2,)),
+        ("v", "<f8", (2,)),
+        ("a", "<f8", (2,)),
+        ("orientation", "<f8"),
+    ]
+)
+
+BALL_DTYPE = np.dtype(
+    [
+        ("present", "?"),
+        ("p", "<f8", (3,)),
+        ("v", "<f8", (3,)),
+        ("a", "<f8", (3,)),
+    ]
+)
+
+TEAM_DTYPE = np.dtype(
+    [
+        ("score", "<i4"),
+        ("goalkeeper", "<i4"),
+        ("red_cards", "<i4"),
+        ("yellow_cards", "<i4"),
+        ("timeouts", "<i4"),
+        ("timeout_time", "<i8"),
+    ]
+)
+
+# Optional referee fields are encoded with sentinels: -1 for absent commands / sides,
+# and a separate flag for the designated position and action time.
+REFEREE_DTYPE = np.dtype(
+    [
+        ("present", "?"),
+        ("time_sent", "<f8"),
+        ("time_received", "<f8"),
+        ("command", "<i2"),
+        ("command_timestamp", "<f8"),
+        ("stage", "<i2"),
+        ("stage_time_left", "<f8"),
+        ("blue_team", TEAM_DTYPE),
+        ("yellow_team", TEAM_DTYPE),
+        ("has_designated_position", "?"),
+        ("designated_position", "<f8", (2,)),
+        ("blue_team_on_positive_half", "<i1"),
+        ("next_command", "<i2"),
+        ("has_action_time_remaining", "?"),
+        ("action_time_remaining", "<i8"),
+    ]
+)
+
+FRAME_DTYPE = np.dtype(
+    [
+        ("ts", "<f8"),
+        ("my_team_is_yellow", "?"),
+        ("my_team_is_right", "?"),
+        ("friendly", ROBOT_DTYPE, (ROBOT_SLOTS,)),
+        ("enemy", ROBOT_DTYPE, (ROBOT_SLOTS,)),
+        ("ball", BALL_DTYPE),
+        ("referee", REFEREE_DTYPE),
+    ]
+)
+
+
+def _encode_header(metadata: ReplayMetadata) -> bytes:
+    header = json.dumps(
+        {
+            "my_team_is_yellow": metadata.my_team_is_yellow,
+            "exp_friendly": metadata.exp_friendly,
+            "exp_enemy": metadata.exp_enemy,
+            "robot_slots": ROBOT_SLOTS,
+            "frame_dtype": FRAME_DTYPE.descr,
+        }
+    ).encode("utf-8")
+    unpadded = _PREAMBLE.size + len(header)
+    padding = (-unpadded) % HEADER_ALIGNMENT
+    header += b" " * padding
+    return _PREAMBLE.pack(MAGIC, FORMAT_VERSION, len(header)) + header
+
+
+def write_header(file, metadata: ReplayMetadata) -> None:
+    """Write the columnar file header for ``metadata`` to an open binary file."""
+    file.write(_encode_header(metadata))
+
+
+def read_header(path: Union[str, Path]) -> Tuple[ReplayMetadata, int]:
+    """Read the header of a columnar replay file.
+
+    Returns:
+        The replay metadata and the byte offset of the first frame record.
+
+    Raises:
+        ValueError: If the file is not a columnar replay or uses an unsupported version.
+    """
+    with open(path, "rb") as f:
+        preamble = f.read(_PREAMBLE.size)
+        if len(preamble) < _PREAMBLE.size:
+            raise ValueError(f"{path} is too short to be a columnar replay file.")
+        magic, version, header_len = _PREAMBLE.unpack(preamble)
+        if magic != MAGIC:
+            raise ValueError(f"{path} is not a columnar replay file.")
+        if version != FORMAT_VERSION:
+            raise ValueError(f"Unsupported columnar replay version {version} (expected {FORMAT_VERSION}).")
+        header = json.loads(f.read(header_len).decode("utf-8"))
+    if header.get("robot_slots") != ROBOT_SLOTS:
+        raise ValueError(f"Replay uses {header.get('robot_slots')} robot slots; this reader supports {ROBOT_SLOTS}.")
+
+    metadata = ReplayMetadata(
+        my_team_is_yellow=header["my_team_is_yellow"],
+        exp_friendly=header["exp_friendly"],
+        exp_enemy=header["exp_enemy"],
+    )
+    return metadata, _PREAMBLE.size + header_len
+
+
+def is_columnar_replay(path: Union[str, Path]) -> bool:
+    with open(path, "rb") as f:
+        return f.read(len(MAGIC)) == MAGIC
+
+
+### Encoding ###
+
+
+def _encode_robots(slots: np.ndarray, robots: Dict[int, Robot]) -> None:
+    # Index field-first so that every assignment goes through an ndarray view of the record.
+    slots["present"] = False
+    for robot_id, robot in robots.items():
+        if not 0 <= robot_id < ROBOT_SLOTS:
+            raise ValueError(f"Robot id {robot_id} does not fit in {ROBOT_SLOTS} replay slots.")
+        slots["present"][robot_id] = True
+        slots["has_ball"][robot_id] = robot.has_ball
+        slots["p"][robot_id] = (robot.p.x, robot.p.y)
+        slots["v"][robot_id] = (robot.v.x, robot.v.y) if robot.v is not None else (0.0, 0.0)
+        slots["a"][robot_id] = (robot.a.x, robot.a.y) if robot.a is not None else (0.0, 0.0)
+        slots["orientation"][robot_id] = robot.orientation
+
+
+def _encode_vector3(vector: Optional[Vector3D]) -> Tuple[float, float, float]:
+    return (vector.x, vector.y, vector.z) if vector is not None else (0.0, 0.0, 0.0)
+
+
+def _encode_team(record: np.ndarray, team: TeamInfo) -> None:
+    record["score"] = team.score
+    record["goalkeeper"] = team.goalkeeper
+    record["red_cards"] = team.red_cards
+    record["yellow_cards"] = team.yellow_cards
+    record["timeouts"] = team.timeouts
+    record["timeout_time"] = team.timeout_time
+
+
+def _encode_referee(record: np.ndarray, referee: Optional[RefereeData]) -> None:
+    if referee is None:
+        record["present"] = False
+        return
+    record["present"] = True
+    record["time_sent"] = referee.time_sent
+    record["time_received"] = referee.time_received
+    record["command"] = referee.referee_command.value
+    record["command_timestamp"] = referee.referee_command_timestamp
+    record["stage"] = referee.stage.value
+    record["stage_time_left"] = referee.stage_time_left
+    _encode_team(record["blue_team"], referee.blue_team)
+    _encode_team(record["yellow_team"], referee.yellow_team)
+    record["has_designated_position"] = referee.designated_position is not None
+    record["designated_position"] = referee.designated_position or (0.0, 0.0)
+    if referee.blue_team_on_positive_half is None:
+        record["blue_team_on_positive_half"] = -1
+    else:
+        record["blue_team_on_positive_half"] = int(referee.blue_team_on_positive_half)
+    record["next_command"] = referee.next_command.value if referee.next_command is not None else -1
+    record["has_action_time_remaining"] = referee.current_action_time_remaining is not None
+    record["action_time_remaining"] = referee.current_action_time_remaining or 0
+
+
+def encode_frame(record: np.ndarray, frame: GameFrame) -> None:
+    """Encode ``frame`` in place into a single ``FRAME_DTYPE`` record.
+
+    ``record`` must be a 0-d view into the destination buffer (e.g. ``buffer[i, ...]``).
+    Referee fields that cannot be stored in fixed-width columns (team names, game events,
+    status messages) are dropped.
+    """
+    record["ts"] = frame.ts
+    record["my_team_is_yellow"] = frame.my_team_is_yellow
+    record["my_team_is_right"] = frame.my_team_is_right
+    _encode_robots(record["friendly"], frame.friendly_robots)
+    _encode_robots(record["enemy"], frame.enemy_robots)
+
+    ball = record["ball"]
+    ball["present"] = frame.ball is not None
+    if frame.ball is not None:
+        ball["p"] = _encode_vector3(frame.ball.p)
+        ball["v"] = _encode_vector3(frame.ball.v)
+        ball["a"] = _encode_vector3(frame.ball.a)
+
+    _encode_referee(record["referee"], frame.referee)
+
+
+### Decoding ###
+
+
+def _decode_robots(slots: np.ndarray, is_friendly: bool) -> Dict[int, Robot]:
+    robots = {}
+    for robot_id in np.flatnonzero(slots["present"]):
+        slot = slots[robot_id]
+        robots[int(robot_id)] = Robot(
+            id=int(robot_id),
+            is_friendly=is_friendly,
+            has_ball=bool(slot["has_ball"]),
+            p=Vector2D(*slot["p"]),
+            v=Vector2D(*slot["v"]),
+            a=Vector2D(*slot["a"]),
+            orientation=float(slot["orientation"]),
+        )
+    return robots
+
+
+def _decode_team(record: np.ndarray) -> TeamInfo:
+    return TeamInfo(
+        name="",
+        score=int(record["score"]),
+        goalkeeper=int(record["goalkeeper"]),
+        red_cards=int(record["red_cards"]),
+        yellow_cards=int(record["yellow_cards"]),
+        timeouts=int(record["timeouts"]),
+        timeout_time=int(record["timeout_time"]),
+    )
+
+
+def _decode_referee(record: np.ndarray) -> Optional[RefereeData]:
+    if not record["present"]:
+        return None
+    on_positive_half = int(record["blue_team_on_positive_half"])
+    next_command = int(record["next_command"])
+    return RefereeData(
+        source_identifier=None,
+        time_sent=float(record["time_sent"]),
+        time_received=float(record["time_received"]),
+        referee_command=RefereeCommand.from_id(int(record["command"])),
+        referee_command_timestamp=float(record["command_timestamp"]),
+        stage=Stage.from_id(int(record["stage"])),
+        stage_time_left=float(record["stage_time_left"]),
+        blue_team=_decode_team(record["blue_team"]),
+        yellow_team=_decode_team(record["yellow_team"]),
+        designated_position=(
+            tuple(float(c) for c in record["designated_position"]) if record["has_designated_position"] else None
+        ),
+        blue_team_on_positive_half=bool(on_positive_half) if on_positive_half >= 0 else None,
+        next_command=RefereeCommand.from_id(next_command) if next_command >= 0 else None,
+        current_action_time_remaining=(
+            int(record["action_time_remaining"]) if record["has_action_time_remaining"] else None
+        ),
+    )
+
+
+def decode_frame(record: np.ndarray) -> GameFrame:
+    """Rebuild a ``GameFrame`` from a single ``FRAME_DTYPE`` record."""
+    ball_record = record["ball"]
+    ball = (
+        Ball(
+            p=Vector3D(*ball_record["p"]),
+            v=Vector3D(*ball_record["v"]),
+            a=Vector3D(*ball_record["a"]),
+        )
+        if ball_record["present"]
+        else None
+    )
+    return GameFrame(
+        ts=float(record["ts"]),
+        my_team_is_yellow=bool(record["my_team_is_yellow"]),
+        my_team_is_right=bool(record["my_team_is_right"]),
+        friendly_robots=_decode_robots(record["friendly"], is_friendly=True),
+        enemy_robots=_decode_robots(record["enemy"], is_friendly=False),
+        ball=ball,
+        referee=_decode_referee(record["referee"]),
+    )
+
+
+class ColumnarReplayReader:
+    """Memory-mapped reader for columnar replay files.
+
+    Frames are only decoded into ``GameFrame`` objects on request; column accessors such as
+    ``timestamps`` and ``robot_trajectory`` return views straight into the mapped file.
+
+    Args:
+        path (Union[str, Path]): Path to a ``.utr`` replay file.
+    """
+
+    def __init__(self, path: Union[str, Path]):
+        self.path = Path(path)
+        self.metadata, offset = read_header(self.path)
+        n_frames = (self.path.stat().st_size - offset) // FRAME_DTYPE.itemsize
+        self._file = None
+        self._mmap: Optional[mmap.mmap] = None
+        # A trailing partial record (e.g. after a crash mid-write) is ignored.
+        if n_frames > 0:
+            self._file = open(self.path, "rb")
+            self._mmap = mmap.mmap(self._file.fileno(), 0, access=mmap.ACCESS_READ)
+            self.frames = np.frombuffer(self._mmap, dtype=FRAME_DTYPE, count=n_frames, offset=offset)
+        else:
+            self.frames = np.empty(0, dtype=FRAME_DTYPE)
+
+    def __len__(self) -> int:
+        return self.frames.shape[0]
+
+    def __getitem__(self, index: int) -> GameFrame:
+        return decode_frame(self.frames[index])
+
+    def __iter__(self):
+        for i in range(len(self)):
+            yield self[i]
+
+    @property
+    def timestamps(self) -> np.ndarray:
+        return self.frames["ts"]
+
+    def index_at(self, ts: float) -> int:
+        """Index of the last frame recorded at or before ``ts`` (0 if ``ts`` precedes the replay)."""
+        return max(0, int(np.searchsorted(self.timestamps, ts, side="right")) - 1)
+
+    def frame_at(self, ts: float) -> GameFrame:
+        return self[self.index_at(ts)]
+
+    def robot_trajectory(self, robot_id: int, is_friendly: bool = True) -> Tuple[np.ndarray, np.ndarray, np.ndarray]:
+        """Position history of a single robot.
+
+        Returns:
+            ``(timestamps, positions, present)`` where ``positions`` has shape ``(n_frames, 2)``
+            and ``present`` marks the frames in which the robot was seen.
+        """
+        slots = self.frames["friendly" if is_friendly else "enemy"][:, robot_id]
+        return self.timestamps, slots["p"], slots["present"]
+
+    def ball_trajectory(self) -> Tuple[np.ndarray, np.ndarray, np.ndarray]:
+        """Position history of the ball as ``(timestamps, positions, present)``."""
+        ball = self.frames["ball"]
+        return self.timestamps, ball["p"], ball["present"]
+
+    def close(self):
+        """Release the mapping and the file.
+
+        Column views handed out earlier (``timestamps``, ``robot_trajectory`` ...) keep the mapping alive; it is
+        then unmapped once the last of them is freed.
+        """
+        self.frames = np.empty(0, dtype=FRAME_DTYPE)
+        if self._mmap is not None:
+            try:
+                self._mmap.close()
+            except BufferError:
+                pass  # still exported to a caller's view
+            self._mmap = None
+        if self._file is not None:
+            self._file.close()
+            self._file = None
@@ -1,4 +1,27 @@
 from dataclasses import dataclass
+from enum import Enum, auto
+
+
+class ReplayFormat(Enum):
+    """On-disk replay formats.
+
+    COLUMNAR: Fixed-dtype numpy records written in chunks, memory-mappable (``.utr``).
+    PICKLE: Legacy stream of pickled ``GameFrame`` objects (``.pkl``).
+    """
+
+    COLUMNAR = ".utr"
+    PICKLE = ".pkl"
+
+
+class OverflowPolicy(Enum):
+    """What an asynchronous replay writer does when its frame queue is full.
+
+    DROP: Discard the new frame and count it as dropped; never blocks the caller.
+    BLOCK: Wait for the writer thread to make room; counted as a late frame.
+    """
+
+    DROP = auto()
+    BLOCK = auto()
 
 
 @dataclass(kw_only=True)
@@ -1,18 +1,23 @@
 import argparse
 import logging
 import pickle
+import shutil
+import subprocess
 import warnings
-from typing import Generator, Union
+from pathlib import Path
+from typing import Generator, List, Optional, Sequence, Tuple, Union
 
+import numpy as np
 import pygame
 
-from utama_core.config.settings import REPLAY_BASE_PATH
+from utama_core.config.settings import RENDER_BASE_PATH, REPLAY_BASE_PATH
 from utama_core.entities.game import Ball as GameBall
 from utama_core.entities.game import Game, GameFrame
 from utama_core.entities.game import Robot as GameRobot
 from utama_core.global_utils.mapping_utils import map_friendly_enemy_to_colors
 from utama_core.global_utils.math_utils import rad_to_deg
-from utama_core.replay.entities import ReplayMetadata
+from utama_core.replay.columnar import ColumnarReplayReader, is_columnar_replay
+from utama_core.replay.entities import ReplayFormat, ReplayMetadata
 from utama_core.rsoccer_simulator.src.Entities import Ball as RSoccerBall
 from utama_core.rsoccer_simulator.src.Entities import Frame as RSoccerFrame
 from utama_core.rsoccer_simulator.src.Entities import FrameSSL
@@ -61,7 +66,7 @@ class ReplayStandardSSL(SSLStandardEnv):
 
 
 def _load_replay(path) -> Generator[Union[ReplayMetadata, GameFrame], None, None]:
-    """Generator that yields metadata and game frames from a replay file."""
+    """Generator that yields metadata and game frames from a legacy pickle replay file."""
     with open(path, "rb") as f:
         # read metadata (first object)
         metadata = pickle.load(f)
@@ -78,17 +83,40 @@ def _load_replay(path) -> Generator[Union[ReplayMetadata, GameFrame], None, None
                 break
 
 
-def play_replay(file_name: str, play_by_play: bool = False):
-    replay_path = REPLAY_BASE_PATH / f"{file_name}.pkl"
+def _resolve_replay_path(file_name: str) -> Path:
+    """Find the replay file for ``file_name``, preferring the columnar format."""
+    for replay_format in ReplayFormat:
+        candidate = REPLAY_BASE_PATH / f"{file_name}{replay_format.value}"
+        if candidate.exists():
+            return candidate
+    raise FileNotFoundError(f"No replay named {file_name} found in {REPLAY_BASE_PATH}.")
 
-    # Load all frames into memory
-    frames = list(_load_replay(replay_path))
+
+def open_replay(path) -> Tuple[ReplayMetadata, Sequence[GameFrame]]:
+    """Open a replay file of either format.
+
+    Columnar replays are memory-mapped and frames are decoded on access; legacy pickle
+    replays are read fully into memory.
+    """
+    if is_columnar_replay(path):
+        reader = ColumnarReplayReader(path)
+        return reader.metadata, reader
+
+    frames: List = list(_load_replay(path))
     if not frames:
+        raise ValueError(f"Replay file {path} is empty.")
+    return frames[0], frames[1:]
+
+
+def play_replay(file_name: str, play_by_play: bool = False, start_time: float = 0.0):
+    replay_path = _resolve_replay_path(file_name)
+
+    try:
+        metadata, game_frames = open_replay(replay_path)
+    except ValueError:
         print("Replay file is empty!")
         return
 
-    metadata = frames[0]
-    game_frames = frames[1:]  # skip metadata
     n_yellow, n_blue = map_friendly_enemy_to_colors(
         metadata.my_team_is_yellow,
         metadata.exp_friendly,
@@ -97,6 +125,12 @@ def play_replay(file_name: str, play_by_play: bool = False):
     replay_env = ReplayStandardSSL(n_robots_yellow=n_yellow, n_robots_blue=n_blue)
 
     frame_index = 0
+    if start_time > 0:
+        if isinstance(game_frames, ColumnarReplayReader):
+            if len(game_frames):
+                frame_index = game_frames.index_at(game_frames.timestamps[0] + start_time)
+        else:
+            warnings.warn("Seeking by time is only supported for columnar replays; starting from the beginning.")
 
     while frame_index < len(game_frames):
         frame = game_frames[frame_index]
@@ -136,8 +170,79 @@ def play_replay(file_name: str, play_by_play: bool = False):
             frame_index += 1
 
 
+def _video_frame_indices(timestamps: Sequence[float], fps: float, start_time: float = 0.0) -> np.ndarray:
+    """Index of the replay frame on screen at each video frame, so the video plays in real time at ``fps``."""
+    timestamps = np.asarray(timestamps, dtype=float)
+    if not timestamps.size:
+        return np.empty(0, dtype=int)
+    times = np.arange(timestamps[0] + start_time, timestamps[-1] + 1e-9, 1.0 / fps)
+    return np.maximum(np.searchsorted(timestamps, times, side="right") - 1, 0)
+
+
+def render_replay_video(file_name: str, fps: float = 60.0, start_time: float = 0.0) -> Optional[Path]:
+    """Render a replay offscreen into ``RENDER_BASE_PATH``, resampled to ``fps`` by frame timestamp.
+
+    Writes ``<file_name>.mp4`` when ffmpeg is on the PATH, otherwise a ``<file_name>/`` directory of numbered PNGs.
+
+    Returns:
+        Optional[Path]: The video file or frame directory, or None if the replay has no frames.
+    """
+    replay_path = _resolve_replay_path(file_name)
+    metadata, game_frames = open_replay(replay_path)
+    if isinstance(game_frames, ColumnarReplayReader):
+        timestamps = game_frames.timestamps
+    else:
+        game_frames = [frame for frame in game_frames if isinstance(frame, GameFrame)]
+        timestamps = [frame.ts for frame in game_frames]
+    indices = _video_frame_indices(timestamps, fps, start_time)
+    if not indices.size:
+        logger.warning("Replay %s has no frames to render.", file_name)
+        return None
+
+    n_yellow, n_blue = map_friendly_enemy_to_colors(
+        metadata.my_team_is_yellow,
+        metadata.exp_friendly,
+        metadata.exp_enemy,
+    )
+    replay_env = ReplayStandardSSL(n_robots_yellow=n_yellow, n_robots_blue=n_blue, render_mode="rgb_array")
+    RENDER_BASE_PATH.mkdir(parents=True, exist_ok=True)
+
+    ffmpeg = shutil.which("ffmpeg")
+    if ffmpeg:
+        output = RENDER_BASE_PATH / f"{file_name}.mp4"
+        width, height = replay_env.window_size
+        raw_input = ["-f", "rawvideo", "-pix_fmt", "rgb24", "-s", f"{width}x{height}", "-r", str(fps), "-i", "-"]
+        cmd = [ffmpeg, "-y", "-loglevel", "error", *raw_input, "-pix_fmt", "yuv420p", str(output)]
+        encoder = subprocess.Popen(cmd, stdin=subprocess.PIPE)
+    else:
+        output = RENDER_BASE_PATH / file_name
+        output.mkdir(exist_ok=True)
+        encoder = None
+        logger.info("ffmpeg not found; writing PNG frames instead of a video.")
+
+    try:
+        frame = previous_index = None
+        for n, index in enumerate(indices):
+            if index != previous_index:
+                replay_env.frame = replay_env._set_frame(game_frames[index])
+                frame = replay_env.render()
+                previous_index = index
+            if encoder is not None:
+                encoder.stdin.write(frame.tobytes())
+            else:
+                pygame.image.save(replay_env.window_surface, str(output / f"{n:06d}.png"))
+    finally:
+        if encoder is not None:
+            encoder.stdin.close()
+            encoder.wait()
+        replay_env.close()
+
+    logger.info("Rendered %d frames of %s to %s", len(indices), file_name, output)
+    return output
+
+
 def get_latest_replay_name() -> str:
-    files = list(REPLAY_BASE_PATH.glob("*.pkl"))
+    files = [f for replay_format in ReplayFormat for f in REPLAY_BASE_PATH.glob(f"*{replay_format.value}")]
     if not files:
         raise FileNotFoundError("No replay files found in the replay directory.")
     latest_file = max(files, key=lambda f: f.stat().st_mtime)
@@ -158,6 +263,25 @@ def main():
         action="store_true",
         help="Render the replay one frame at a time for step-by-step playback.",
     )
+    parser.add_argument(
+        "-t",
+        "--start-time",
+        type=float,
+        default=0.0,
+        help="Seconds into the replay to start playback from (columnar replays only).",
+    )
+    parser.add_argument(
+        "-v",
+        "--video",
+        action="store_true",
+        help="Render the replay to a video in the renders folder instead of playing it.",
+    )
+    parser.add_argument(
+        "--fps",
+        type=float,
+        default=60.0,
+        help="Frame rate of the rendered video.",
+    )
 
     args = parser.parse_args()
 
@@ -167,7 +291,10 @@ def main():
         replay_file = get_latest_replay_name()
         logger.info(f"No replay file specified. Using the latest replay: {replay_file}")
 
-    play_replay(replay_file, play_by_play=args.play_by_play)
+    if args.video:
+        render_replay_video(replay_file, fps=args.fps, start_time=args.start_time)
+    else:
+        play_replay(replay_file, play_by_play=args.play_by_play, start_time=args.start_time)
 
 
 if __name__ == "__main__":
@@ -1,13 +1,20 @@
 import logging
 import pickle
+import threading
+import time
 import warnings
+from collections import deque
 from dataclasses import dataclass
 from itertools import count
+from pathlib import Path
 from typing import IO, Optional
 
-from utama_core.config.settings import REPLAY_BASE_PATH
+import numpy as np
+
+from utama_core.config.settings import REPLAY_BASE_PATH, TIMESTEP
 from utama_core.entities.game import GameFrame
-from utama_core.replay.entities import ReplayMetadata
+from utama_core.replay.columnar import FRAME_DTYPE, encode_frame, write_header
+from utama_core.replay.entities import OverflowPolicy, ReplayFormat, ReplayMetadata
 
 
 @dataclass(kw_only=True)
@@ -19,11 +26,26 @@ class ReplayWriterConfig:
         is_my_perspective (bool, optional): Whether to record the replay from
             the user's perspective or opponent's. Defaults to True.
         overwrite_existing (bool, optional): Whether to overwrite existing replay with same name. Defaults to False.
+        format (ReplayFormat, optional): On-disk format. Defaults to ReplayFormat.COLUMNAR.
+        chunk_size (int, optional): COLUMNAR only: number of frames buffered in memory before
+            they are written to disk in a single call. Defaults to 120 (2 s at 60 Hz).
+        async_writer (bool, optional): Hand frames to a background writer thread through a bounded
+            queue instead of writing on the calling (control) thread. Defaults to False.
+        queue_size (int, optional): async only: maximum number of frames waiting to be written. Defaults to 256.
+        overflow_policy (OverflowPolicy, optional): async only: behaviour when the queue is full.
+            Defaults to OverflowPolicy.DROP so recording never stalls the control loop.
+        flush_interval (float, optional): async only: seconds between flushes to disk. Defaults to 1.0.
     """
 
     replay_name: str
     is_my_perspective: bool = True
     overwrite_existing: bool = False
+    format: ReplayFormat = ReplayFormat.COLUMNAR
+    chunk_size: int = 120
+    async_writer: bool = False
+    queue_size: int = 256
+    overflow_policy: OverflowPolicy = OverflowPolicy.DROP
+    flush_interval: float = 1.0
 
 
 class ReplayWriter:
@@ -36,6 +58,15 @@ class ReplayWriter:
     ):
         self.logger = logging.getLogger(__name__)
         self.replay_configs = replay_configs
+        if replay_configs.chunk_size < 1:
+            raise ValueError(f"chunk_size must be at least 1, got {replay_configs.chunk_size}.")
+
+        # COLUMNAR: frames are encoded into this preallocated chunk and written once it fills.
+        self._chunk: Optional[np.ndarray] = None
+        self._chunk_len = 0
+        if replay_configs.format == ReplayFormat.COLUMNAR:
+            self._chunk = np.zeros(replay_configs.chunk_size, dtype=FRAME_DTYPE)
+
         self.file: Optional[IO] = self.create_file(
             replay_configs=replay_configs,
             replay_metadata=ReplayMetadata(
@@ -45,8 +76,11 @@ class ReplayWriter:
             ),
         )
 
+    def _replay_path(self, name: str) -> Path:
+        return REPLAY_BASE_PATH / f"{name}{self.replay_configs.format.value}"
+
     def create_file(self, replay_configs: ReplayWriterConfig, replay_metadata: ReplayMetadata):
-        replay_path = REPLAY_BASE_PATH / f"{replay_configs.replay_name}.pkl"
+        replay_path = self._replay_path(replay_configs.replay_name)
 
         replay_path.parent.mkdir(parents=True, exist_ok=True)
 
@@ -56,7 +90,7 @@ class ReplayWriter:
 
             else:
                 for i in count(1):
-                    candidate = REPLAY_BASE_PATH / f"{replay_configs.replay_name}_{i}.pkl"
+                    candidate = self._replay_path(f"{replay_configs.replay_name}_{i}")
                     if not candidate.exists():
                         replay_path = candidate
                         warnings.warn(f"Replay file already exists. Saving as {replay_path.name}")
@@ -64,7 +98,10 @@ class ReplayWriter:
 
         file = open(replay_path, "ab")
         try:
-            pickle.dump(replay_metadata, file)
+            if replay_configs.format == ReplayFormat.COLUMNAR:
+                write_header(file, replay_metadata)
+            else:
+                pickle.dump(replay_metadata, file)
             file.flush()
         except Exception as e:
             self.logger.error(f"Failed to write replay metadata to file {replay_path}: {e}")
@@ -73,17 +110,161 @@ class ReplayWriter:
         return file
 
     def write_frame(self, frame: GameFrame):
-        """Write a single game frame to the replay file."""
+        """Write a single game frame to the replay file.
+
+        In COLUMNAR format the frame is only buffered; it reaches disk when the current
+        chunk fills up or the writer is closed.
+        """
         if not self.file:
             self.logger.error("Replay file is not initialized.")
             return
-        pickle.dump(frame, self.file)
+        self._encode_frame(frame)
+        if self._chunk is None:
+            self.file.flush()
+
+    def _encode_frame(self, frame: GameFrame):
+        """Append ``frame`` to the file (PICKLE) or the current chunk (COLUMNAR) without flushing."""
+        if self._chunk is None:
+            pickle.dump(frame, self.file)
+            return
+
+        encode_frame(self._chunk[self._chunk_len, ...], frame)
+        self._chunk_len += 1
+        if self._chunk_len == self._chunk.shape[0]:
+            self._write_chunk()
+
+    def _write_chunk(self):
+        if self._chunk_len == 0:
+            return
+        self.file.write(self._chunk[: self._chunk_len].tobytes())
+        self._chunk_len = 0
+
+    def _flush(self):
+        """Push everything buffered so far (including a partial chunk) to disk."""
+        if self._chunk is not None:
+            self._write_chunk()
         self.file.flush()
 
     def close(self):
         """Close the replay file."""
         if self.file:
+            if self._chunk is not None:
+                self._write_chunk()
             self.file.close()
             self.file = None
         else:
             self.logger.error("Replay file is not initialized.")
+
+
+class AsyncReplayWriter(ReplayWriter):
+    """ReplayWriter that moves all disk I/O onto a background thread.
+
+    ``write_frame`` only appends the (immutable) frame to a bounded single-producer /
+    single-consumer queue; the writer thread drains it in batches and flushes every
+    ``flush_interval`` seconds. The queue is a ``deque`` whose ``append``/``popleft`` are
+    atomic, so the producer never takes a lock unless it has to wait under
+    ``OverflowPolicy.BLOCK``.
+
+    Attributes:
+        dropped_frames (int): Frames discarded because the queue was full (DROP policy).
+        late_frames (int): Frames for which ``write_frame`` had to wait for space (BLOCK policy).
+        max_block_time (float): Longest time in seconds a single ``write_frame`` call has waited.
+        thread_exception (BaseException, optional): Why the writer thread stopped, if it failed.
+    """
+
+    def __init__(
+        self,
+        replay_configs: ReplayWriterConfig,
+        my_team_is_yellow: bool,
+        exp_friendly: int,
+        exp_enemy: int,
+    ):
+        super().__init__(replay_configs, my_team_is_yellow, exp_friendly, exp_enemy)
+        if replay_configs.queue_size < 1:
+            raise ValueError(f"queue_size must be at least 1, got {replay_configs.queue_size}.")
+
+        self.dropped_frames = 0
+        self.late_frames = 0
+        self.max_block_time = 0.0
+
+        self._queue: deque[GameFrame] = deque()
+        self._capacity = replay_configs.queue_size
+        self._not_empty = threading.Event()
+        self._not_full = threading.Event()
+        self._not_full.set()
+        self._closing = False
+        self.thread_exception: Optional[BaseException] = None
+        self._reported_stopped = False
+
+        self._thread = threading.Thread(target=self._run, name="ReplayWriter", daemon=True)
+        if self.file:
+            self._thread.start()
+
+    def write_frame(self, frame: GameFrame):
+        """Queue a frame for the writer thread. Never touches the file on the calling thread."""
+        if not self.file or not self._thread.is_alive():
+            if not self._reported_stopped:
+                # Reported once; this is called every frame.
+                self._reported_stopped = True
+                reason = repr(self.thread_exception) if self.thread_exception else "no replay file is open"
+                self.logger.error("Replay writer thread is not running (%s); frames are not recorded.", reason)
+            return
+
+        if len(self._queue) >= self._capacity:
+            if self.replay_configs.overflow_policy == OverflowPolicy.DROP:
+                self.dropped_frames += 1
+                return
+            self._wait_for_space()
+
+        self._queue.append(frame)
+        self._not_empty.set()
+
+    def _wait_for_space(self):
+        start = time.perf_counter()
+        while len(self._queue) >= self._capacity and self._thread.is_alive():
+            self._not_full.clear()
+            # Re-check after clearing so a pop between the test and clear() is not missed.
+            if len(self._queue) < self._capacity:
+                break
+            self._not_full.wait(timeout=TIMESTEP)
+        blocked = time.perf_counter() - start
+        self.late_frames += 1
+        self.max_block_time = max(self.max_block_time, blocked)
+
+    def _run(self):
+        last_flush = time.monotonic()
+        flush_interval = self.replay_configs.flush_interval
+        try:
+            while True:
+                self._not_empty.wait(timeout=flush_interval)
+                self._not_empty.clear()
+
+                while self._queue:
+                    self._encode_frame(self._queue.popleft())
+                    self._not_full.set()
+
+                now = time.monotonic()
+                if now - last_flush >= flush_interval:
+                    self._flush()
+                    last_flush = now
+
+                if self._closing and not self._queue:
+                    break
+        except Exception as e:
+            self.thread_exception = e
+            self.logger.exception("Replay writer thread failed; further frames will not be recorded.")
+        finally:
+            self._not_full.set()
+
+    def close(self):
+        """Drain the queue, stop the writer thread and close the replay file."""
+        if self._thread.is_alive():
+            self._closing = True
+            self._not_empty.set()
+            self._thread.join()
+        if self.dropped_frames or self.late_frames:
+            warnings.warn(
+                f"Replay writer dropped {self.dropped_frames} frames and blocked on {self.late_frames} "
+                f"(max {self.max_block_time * 1000:.1f} ms)."
+            )
+        super().close()
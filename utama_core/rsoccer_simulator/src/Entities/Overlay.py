@@ -0,0 +1,12 @@
+from collections import namedtuple
+from enum import Enum
+
+
+class OverlayType(Enum):
+    POINT = 0
+    LINE = 1
+    POLYGON = 2
+
+
+# points are in screen coordinates, see SSLBaseEnv._pos_transform
+OverlayObject = namedtuple("OverlayObject", ["type", "color", "points", "width"])
@@ -1,4 +1,5 @@
 from utama_core.rsoccer_simulator.src.Entities.Ball import Ball
 from utama_core.rsoccer_simulator.src.Entities.Field import Field
 from utama_core.rsoccer_simulator.src.Entities.Frame import Frame, FrameSSL, FrameVSS
+from utama_core.rsoccer_simulator.src.Entities.Overlay import OverlayObject, OverlayType
 from utama_core.rsoccer_simulator.src.Entities.Robot import Robot
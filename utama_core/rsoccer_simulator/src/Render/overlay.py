@@ -1,20 +1,9 @@
-from collections import namedtuple
-from enum import Enum
-
 import pygame
 
+from utama_core.rsoccer_simulator.src.Entities.Overlay import OverlayObject, OverlayType
 from utama_core.rsoccer_simulator.src.Render.utils import COLORS
 
 
-class OverlayType(Enum):
-    POINT = 0
-    LINE = 1
-    POLYGON = 2
-
-
-OverlayObject = namedtuple("OverlayObject", ["type", "color", "points", "width"])
-
-
 class RenderOverlay:
     def __init__(self, overlay_data: list[OverlayObject], scale) -> None:
         self.overlay_data = overlay_data
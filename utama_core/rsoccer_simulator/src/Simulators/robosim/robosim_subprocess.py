@@ -1,9 +1,18 @@
 """This script runs inside Python 3.10 (rc-robosim environment).
 
-It receives JSON commands via stdin and returns simulator state via stdout.
+It receives commands via stdin and returns simulator state via stdout, using one of two transports:
+
+- json: one JSON object per line in each direction.
+- shm: command, state and reset arrays live in a shared-memory block created by the parent
+  (see robosim_wrapper.py). The pipe only carries one-byte opcodes and one-byte replies, so a step
+  costs a memcpy instead of a JSON encode/decode of every robot's state. Field params (requested once)
+  are returned as a length-prefixed JSON payload.
+
+It cannot import utama_core, so the shm layout is passed on the command line and mirrored in the wrapper.
 """
 
 import json
+import struct
 import sys
 
 import numpy as np
@@ -60,6 +69,98 @@ class SubprocessRSim:
         return self.sim.get_field_params()
 
 
+# shm transport opcodes (parent -> child) and replies (child -> parent)
+OP_STEP = b"s"
+OP_GET_STATE = b"g"
+OP_RESET = b"r"
+OP_FIELD_PARAMS = b"f"
+REPLY_OK = b"k"
+REPLY_ERROR = b"e"
+LENGTH = struct.Struct("<I")
+
+
+def array_shapes(n_blue, n_yellow, command_cols, state_len):
+    """Shapes of the float64 arrays in the shared-memory block, in order; mirrored by the wrapper."""
+    return [(n_blue + n_yellow, command_cols), (state_len,), (4,), (n_blue, 3), (n_yellow, 3)]
+
+
+class SharedArrays:
+    """Views over the parent's shared-memory block: commands, state, then reset ball / blue / yellow."""
+
+    def __init__(self, shm_name, n_blue, n_yellow, command_cols, state_len):
+        from multiprocessing import resource_tracker, shared_memory
+
+        self.shm = shared_memory.SharedMemory(name=shm_name)
+        # The parent owns (and unlinks) the block; stop this process's tracker from unlinking it on exit.
+        resource_tracker.unregister(self.shm._name, "shared_memory")
+
+        offset = 0
+        views = []
+        for shape in array_shapes(n_blue, n_yellow, command_cols, state_len):
+            views.append(np.ndarray(shape, dtype=np.float64, buffer=self.shm.buf, offset=offset))
+            offset += int(np.prod(shape)) * 8
+        self.commands, self.state, self.reset_ball, self.reset_blue, self.reset_yellow = views
+
+    def close(self):
+        del self.commands, self.state, self.reset_ball, self.reset_blue, self.reset_yellow
+        self.shm.close()
+
+
+def serve_json(sim):
+    for line in sys.stdin:
+        if not line.strip():
+            continue
+        try:
+            cmd = json.loads(line)
+            if "commands" in cmd:
+                state = sim.step(cmd["commands"])
+                print(json.dumps({"state": state}))
+            elif "reset" in cmd:
+                r = cmd["reset"]
+                sim.reset(r["ball_pos"], r["blue_robots_pos"], r["yellow_robots_pos"])
+                print(json.dumps({"ack": True}))
+            elif "get_field_params" in cmd:
+                fp = sim.get_field_params()
+                print(json.dumps({"field_params": fp}))
+            elif "get_state" in cmd:
+                state = sim.get_state()
+                print(json.dumps({"state": state}))
+            else:
+                print(json.dumps({"error": "unknown command"}))
+        except Exception as e:
+            print(json.dumps({"error": str(e)}))
+        sys.stdout.flush()
+
+
+def serve_shm(sim, arrays, stdin=None, stdout=None):
+    """Answers opcodes from ``stdin`` (default: this process's stdin) until it is closed."""
+    stdin = stdin if stdin is not None else sys.stdin.buffer
+    stdout = stdout if stdout is not None else sys.stdout.buffer
+    while True:
+        op = stdin.read(1)
+        if not op:
+            return  # parent closed the pipe
+        try:
+            payload = b""
+            if op == OP_STEP:
+                sim.sim.step(arrays.commands)
+                arrays.state[:] = sim.sim.get_state()
+            elif op == OP_GET_STATE:
+                arrays.state[:] = sim.sim.get_state()
+            elif op == OP_RESET:
+                sim.sim.reset(arrays.reset_ball, arrays.reset_blue, arrays.reset_yellow)
+            elif op == OP_FIELD_PARAMS:
+                body = json.dumps(sim.get_field_params()).encode()
+                payload = LENGTH.pack(len(body)) + body
+            else:
+                raise ValueError(f"unknown opcode {op!r}")
+            stdout.write(REPLY_OK + payload)
+        except Exception as e:
+            body = str(e).encode()
+            stdout.write(REPLY_ERROR + LENGTH.pack(len(body)) + body)
+        stdout.flush()
+
+
 def main():
     import argparse
 
@@ -69,34 +170,23 @@ def main():
     parser.add_argument("--n_yellow", type=int, required=True)
     parser.add_argument("--field_type", type=int, required=True)
     parser.add_argument("--time_step_ms", type=int, required=True)
+    parser.add_argument("--transport", choices=["json", "shm"], default="json")
+    parser.add_argument("--shm_name")
+    parser.add_argument("--command_cols", type=int)
+    parser.add_argument("--state_len", type=int)
     args = parser.parse_args()
 
     sim = SubprocessRSim(args.sim_type, args.n_blue, args.n_yellow, args.field_type, args.time_step_ms)
 
     try:
-        for line in sys.stdin:
-            if not line.strip():
-                continue
+        if args.transport == "shm":
+            arrays = SharedArrays(args.shm_name, args.n_blue, args.n_yellow, args.command_cols, args.state_len)
             try:
-                cmd = json.loads(line)
-                if "commands" in cmd:
-                    state = sim.step(cmd["commands"])
-                    print(json.dumps({"state": state}))
-                elif "reset" in cmd:
-                    r = cmd["reset"]
-                    sim.reset(r["ball_pos"], r["blue_robots_pos"], r["yellow_robots_pos"])
-                    print(json.dumps({"ack": True}))
-                elif "get_field_params" in cmd:
-                    fp = sim.get_field_params()
-                    print(json.dumps({"field_params": fp}))
-                elif "get_state" in cmd:
-                    state = sim.get_state()
-                    print(json.dumps({"state": state}))
-                else:
-                    print(json.dumps({"error": "unknown command"}))
-            except Exception as e:
-                print(json.dumps({"error": str(e)}))
-            sys.stdout.flush()
+                serve_shm(sim, arrays)
+            finally:
+                arrays.close()
+        else:
+            serve_json(sim)
     except KeyboardInterrupt:
         sys.exit(0)
 
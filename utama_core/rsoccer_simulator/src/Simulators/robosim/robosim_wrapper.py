@@ -1,16 +1,50 @@
 import json
 import logging
 import os
+import struct
 import subprocess
+from multiprocessing import shared_memory
 from pathlib import Path
 
 import numpy as np
 
 logger = logging.getLogger(__name__)
 
+# Must match robosim_subprocess.py (which cannot import this module).
+OP_STEP = b"s"
+OP_GET_STATE = b"g"
+OP_RESET = b"r"
+OP_FIELD_PARAMS = b"f"
+REPLY_OK = b"k"
+REPLY_ERROR = b"e"
+LENGTH = struct.Struct("<I")
+
+# Per-sim-type (command columns per robot, state values per robot); mirrors RSim*.send_commands and Frame*.parse.
+_ARRAY_LAYOUT = {"SSL": (8, 11), "VSS": (2, 6)}
+_BALL_STATE_LEN = 5
+
+
+def _array_shapes(n_blue, n_yellow, command_cols, state_len):
+    """Shapes of the float64 arrays in the shared-memory block, in order; must match robosim_subprocess."""
+    return [(n_blue + n_yellow, command_cols), (state_len,), (4,), (n_blue, 3), (n_yellow, 3)]
+
 
 class RSimSubprocessWrapper:
-    def __init__(self, sim_type, n_blue, n_yellow, field_type, time_step_ms):
+    """Runs rc-robosim in its own pixi environment and steps it over a pipe.
+
+    Args:
+        transport (str): "shm" (default) keeps the command, state and reset arrays in a shared-memory
+            block so each call only exchanges a one-byte opcode over the pipe. "json" sends one JSON line
+            per call in each direction.
+    """
+
+    def __init__(self, sim_type, n_blue, n_yellow, field_type, time_step_ms, transport: str = "shm"):
+        if transport not in ("shm", "json"):
+            raise ValueError(f"Unknown robosim transport {transport!r}; expected 'shm' or 'json'.")
+        self.transport = transport
+        self._shm = None
+        self.proc = None
+
         script_path = (Path(__file__).parent / "robosim_subprocess.py").resolve()
         env = os.environ.copy()
         cmake_policy_flag = "-DCMAKE_POLICY_VERSION_MINIMUM=3.5"
@@ -25,34 +59,96 @@ class RSimSubprocessWrapper:
         env["CMAKE_PREFIX_PATH"] = f"{prefix}:{env.get('CMAKE_PREFIX_PATH', '')}".strip(":")
         env["CMAKE_LIBRARY_PATH"] = f"{lib_dir}:{env.get('CMAKE_LIBRARY_PATH', '')}".strip(":")
         env["CMAKE_INCLUDE_PATH"] = f"{include_dir}:{env.get('CMAKE_INCLUDE_PATH', '')}".strip(":")
-        self.proc = subprocess.Popen(
-            [
-                "pixi",
-                "run",
-                "--environment",
-                "robosim",
-                "--",
-                "python",
-                str(script_path),
-                "--sim_type",
-                sim_type,
-                "--n_blue",
-                str(n_blue),
-                "--n_yellow",
-                str(n_yellow),
-                "--field_type",
-                str(field_type),
-                "--time_step_ms",
-                str(time_step_ms),
-            ],
-            stdin=subprocess.PIPE,
-            stdout=subprocess.PIPE,
-            text=True,
-            bufsize=1,
-            env=env,
-        )
+        args = [
+            "pixi",
+            "run",
+            "--environment",
+            "robosim",
+            "--",
+            "python",
+            str(script_path),
+            "--sim_type",
+            sim_type,
+            "--n_blue",
+            str(n_blue),
+            "--n_yellow",
+            str(n_yellow),
+            "--field_type",
+            str(field_type),
+            "--time_step_ms",
+            str(time_step_ms),
+            "--transport",
+            transport,
+        ]
+
+        if transport == "shm":
+            command_cols, robot_state_len = _ARRAY_LAYOUT[sim_type]
+            state_len = _BALL_STATE_LEN + robot_state_len * (n_blue + n_yellow)
+            self._create_shared_arrays(n_blue, n_yellow, command_cols, state_len)
+            args += [
+                "--shm_name",
+                self._shm.name,
+                "--command_cols",
+                str(command_cols),
+                "--state_len",
+                str(state_len),
+            ]
+            self.proc = subprocess.Popen(args, stdin=subprocess.PIPE, stdout=subprocess.PIPE, bufsize=0, env=env)
+        else:
+            self.proc = subprocess.Popen(
+                args,
+                stdin=subprocess.PIPE,
+                stdout=subprocess.PIPE,
+                text=True,
+                bufsize=1,
+                env=env,
+            )
+
+    def _create_shared_arrays(self, n_blue, n_yellow, command_cols, state_len):
+        """Layout: commands, state, reset ball, reset blue, reset yellow; all float64, back to back."""
+        shapes = _array_shapes(n_blue, n_yellow, command_cols, state_len)
+        size = sum(int(np.prod(shape)) for shape in shapes) * 8
+        self._shm = shared_memory.SharedMemory(create=True, size=max(size, 1))
+        offset = 0
+        views = []
+        for shape in shapes:
+            views.append(np.ndarray(shape, dtype=np.float64, buffer=self._shm.buf, offset=offset))
+            offset += int(np.prod(shape)) * 8
+        self._commands, self._state, self._reset_ball, self._reset_blue, self._reset_yellow = views
+
+    def _request(self, op: bytes) -> bytes:
+        """Sends an shm opcode and waits for the reply. Returns the payload of a field-params reply."""
+        self.proc.stdin.write(op)
+        reply = self.proc.stdout.read(1)
+        if reply == REPLY_OK:
+            if op == OP_FIELD_PARAMS:
+                return self._read_payload()
+            return b""
+        if reply == REPLY_ERROR:
+            raise RuntimeError(f"RSim subprocess error: {self._read_payload().decode(errors='replace')}")
+        raise RuntimeError(f"RSim subprocess exited or sent an unexpected reply {reply!r}.")
+
+    def _read_payload(self) -> bytes:
+        (length,) = LENGTH.unpack(self._read_exact(LENGTH.size))
+        return self._read_exact(length)
+
+    def _read_exact(self, n: int) -> bytes:
+        # The unbuffered pipe may return short reads.
+        chunks = []
+        while n > 0:
+            chunk = self.proc.stdout.read(n)
+            if not chunk:
+                raise RuntimeError("RSim subprocess closed its output mid-reply.")
+            chunks.append(chunk)
+            n -= len(chunk)
+        return b"".join(chunks)
 
     def step(self, commands: np.ndarray):
+        if self.transport == "shm":
+            self._commands[:] = commands
+            self._request(OP_STEP)
+            return self._state.copy()
+
         # Serialize commands as JSON and send to subprocess
         data = json.dumps({"commands": commands.tolist()})
         self.proc.stdin.write(data + "\n")
@@ -64,6 +160,13 @@ class RSimSubprocessWrapper:
         return np.array(state)
 
     def reset(self, ball_pos, blue_robots_pos, yellow_robots_pos):
+        if self.transport == "shm":
+            self._reset_ball[:] = ball_pos
+            self._reset_blue[:] = np.asarray(blue_robots_pos).reshape(self._reset_blue.shape)
+            self._reset_yellow[:] = np.asarray(yellow_robots_pos).reshape(self._reset_yellow.shape)
+            self._request(OP_RESET)
+            return
+
         data = json.dumps(
             {
                 "reset": {
@@ -79,6 +182,9 @@ class RSimSubprocessWrapper:
         self.proc.stdout.readline()
 
     def get_field_params(self):
+        if self.transport == "shm":
+            return json.loads(self._request(OP_FIELD_PARAMS))
+
         data = json.dumps({"get_field_params": True})
         self.proc.stdin.write(data + "\n")
         self.proc.stdin.flush()
@@ -86,6 +192,10 @@ class RSimSubprocessWrapper:
         return resp["field_params"]
 
     def get_state(self):
+        if self.transport == "shm":
+            self._request(OP_GET_STATE)
+            return self._state.copy()
+
         data = json.dumps({"get_state": True})
         self.proc.stdin.write(data + "\n")
         self.proc.stdin.flush()
@@ -103,4 +213,10 @@ class RSimSubprocessWrapper:
             logger.error(f"Error while terminating RSim subprocess: {e}")
             traceback.print_exc()
         finally:
+            if self._shm is not None:
+                # Release the numpy views before closing the mapping they point into.
+                del self._commands, self._state, self._reset_ball, self._reset_blue, self._reset_yellow
+                self._shm.close()
+                self._shm.unlink()
+                self._shm = None
             logger.info("RsimSubprocessWrapper cleanup finished.")
@@ -88,6 +88,7 @@ class SSLStandardEnv(SSLBaseEnv):
         ball_starting_position: Optional[Tuple[float, float]] = None,
         gaussian_noise: RsimGaussianNoise = RsimGaussianNoise(),
         vanishing: float = 0,
+        async_render: bool = False,
     ):
         render_field_overrides = None
         if full_field_dims is not None:
@@ -108,6 +109,7 @@ class SSLStandardEnv(SSLBaseEnv):
             time_step=time_step,
             render_mode=render_mode,
             render_field_overrides=render_field_overrides,
+            async_render=async_render,
         )
 
         # NOTE: observation_space and action_space removed - not needed for non-RL use
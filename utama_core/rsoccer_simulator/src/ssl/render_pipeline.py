@@ -0,0 +1,151 @@
+"""Off-thread rendering for SSLBaseEnv's human render mode.
+
+Each sim step the environment snapshots what it would draw, the frame plus the queued overlay primitives, into a
+RenderSnapshot, a few tuples in screen coordinates. A RenderWorker draws snapshots on its own thread. When drawing falls
+behind the sim, only the newest snapshot is kept and stale ones are dropped, so debug drawing no longer changes the
+timing of the loop being debugged.
+
+The worker draws into off-screen surfaces only. The window, the event pump and ``display.update`` stay on the thread
+that created the environment, since some platforms (macOS in particular) only allow the display on the main thread:
+a DoubleBuffer hands each finished frame back, and the env shows it on its next ``render()`` call.
+
+This module does not import pygame; the worker only calls the callables it is given.
+"""
+
+import logging
+import threading
+from typing import Callable, Generic, NamedTuple, Optional, Tuple, TypeVar
+
+from utama_core.rsoccer_simulator.src.Entities import OverlayObject
+
+logger = logging.getLogger(__name__)
+
+# (x, y, theta in degrees, id), x and y in screen coordinates
+RobotPose = Tuple[int, int, float, int]
+
+Buffer = TypeVar("Buffer")
+
+
+class RenderSnapshot(NamedTuple):
+    """Everything SSLBaseEnv draws for one frame, in screen coordinates."""
+
+    ball: Tuple[int, int]
+    robots_blue: Tuple[RobotPose, ...]
+    robots_yellow: Tuple[RobotPose, ...]
+    overlay: Tuple[OverlayObject, ...]
+
+
+class LatestSnapshotSlot:
+    """Single-slot hand-off between the sim and the render thread that keeps only the newest snapshot."""
+
+    def __init__(self):
+        self._cond = threading.Condition()
+        self._snapshot: Optional[RenderSnapshot] = None
+        self._closed = False
+        self.submitted = 0
+        self.dropped = 0  # snapshots replaced before the render thread took them
+
+    def put(self, snapshot: RenderSnapshot) -> None:
+        with self._cond:
+            if self._snapshot is not None:
+                self.dropped += 1
+            self._snapshot = snapshot
+            self.submitted += 1
+            self._cond.notify()
+
+    def take(self, timeout: Optional[float] = None) -> Optional[RenderSnapshot]:
+        """Wait for the next snapshot; returns None once closed (or on timeout)."""
+        with self._cond:
+            self._cond.wait_for(lambda: self._snapshot is not None or self._closed, timeout)
+            snapshot, self._snapshot = self._snapshot, None
+            return None if self._closed else snapshot
+
+    def close(self) -> None:
+        with self._cond:
+            self._closed = True
+            self._cond.notify_all()
+
+
+class DoubleBuffer(Generic[Buffer]):
+    """Two frame buffers: the render thread draws into ``back`` and swaps, another thread shows the front.
+
+    ``show`` and ``swap`` exclude each other, so the render thread never draws into a buffer that is being shown.
+    """
+
+    def __init__(self, factory: Callable[[], Buffer]):
+        self.back: Buffer = factory()
+        self._front: Buffer = factory()
+        self._lock = threading.Lock()
+        self._fresh = False
+
+    def swap(self) -> None:
+        """Publish the frame drawn into ``back``; ``back`` is then the previous front."""
+        with self._lock:
+            self.back, self._front = self._front, self.back
+            self._fresh = True
+
+    def show(self, show: Callable[[Buffer], None]) -> bool:
+        """Call ``show`` with the newest published frame, if it has not been shown yet. Returns whether it was."""
+        with self._lock:
+            if not self._fresh:
+                return False
+            show(self._front)
+            self._fresh = False
+            return True
+
+
+class RenderWorker:
+    """Draws snapshots on a daemon thread.
+
+    Args:
+        present (Callable[[RenderSnapshot], None]): Draws one snapshot, including any frame-rate cap. It must not
+            touch the display; see DoubleBuffer.
+        setup (Callable[[], None], optional): Run once on the render thread before the first snapshot.
+        teardown (Callable[[], None], optional): Run on the render thread when it stops.
+    """
+
+    def __init__(
+        self,
+        present: Callable[[RenderSnapshot], None],
+        setup: Optional[Callable[[], None]] = None,
+        teardown: Optional[Callable[[], None]] = None,
+    ):
+        self._present = present
+        self._setup = setup
+        self._teardown = teardown
+        self._slot = LatestSnapshotSlot()
+        self.rendered = 0
+        self.thread_exception: Optional[BaseException] = None
+        self._thread = threading.Thread(target=self._run, name="rsim-render", daemon=True)
+        self._thread.start()
+
+    @property
+    def dropped(self) -> int:
+        return self._slot.dropped
+
+    def submit(self, snapshot: RenderSnapshot) -> None:
+        """Queue a snapshot for drawing, replacing any the render thread has not picked up yet. Never blocks."""
+        if self.thread_exception is None:
+            self._slot.put(snapshot)
+
+    def close(self, timeout: float = 1.0) -> None:
+        self._slot.close()
+        self._thread.join(timeout)
+
+    def _run(self) -> None:
+        try:
+            if self._setup is not None:
+                self._setup()
+            while True:
+                snapshot = self._slot.take()
+                if snapshot is None:
+                    break
+                self._present(snapshot)
+                self.rendered += 1
+        except Exception as e:
+            # A drawing error should not take the sim down with it; stop rendering and keep the exception.
+            self.thread_exception = e
+            logger.exception("Render thread stopped:")
+        finally:
+            if self._teardown is not None:
+                self._teardown()
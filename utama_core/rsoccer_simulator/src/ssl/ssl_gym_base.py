@@ -7,22 +7,25 @@
 from typing import List, Optional
 
 import numpy as np
-import pygame
 
 from utama_core.global_utils.math_utils import rad_to_deg
-from utama_core.rsoccer_simulator.src.Entities import Ball, Field, Frame, Robot
-from utama_core.rsoccer_simulator.src.Render import (
-    COLORS,
-    RenderBall,
-    RenderSSLRobot,
-    SSLRenderField,
-)
-from utama_core.rsoccer_simulator.src.Render.overlay import (
+from utama_core.rsoccer_simulator.src.Entities import (
+    Ball,
+    Field,
+    Frame,
     OverlayObject,
     OverlayType,
-    RenderOverlay,
+    Robot,
 )
 from utama_core.rsoccer_simulator.src.Simulators.rsim import RSimSSL
+from utama_core.rsoccer_simulator.src.ssl.render_pipeline import (
+    DoubleBuffer,
+    RenderSnapshot,
+    RenderWorker,
+)
+
+# pygame and the Render package (which imports pygame) are only imported once something is rendered, so
+# headless environments, e.g. in batch runs, never pay for loading them.
 
 
 class SSLBaseEnv:
@@ -43,6 +46,7 @@ class SSLBaseEnv:
         time_step: float,
         render_mode=None,
         render_field_overrides: Optional[dict[str, float]] = None,
+        async_render: bool = False,
     ):
         # Initialize Simulator
         self.render_mode = render_mode
@@ -74,10 +78,27 @@ class SSLBaseEnv:
         self.overlay: list[OverlayObject] = []
 
         # Render
-        self.field_renderer = SSLRenderField(**render_field_overrides) if render_field_overrides else SSLRenderField()
+        self._render_field_overrides = render_field_overrides or {}
+        self._field_renderer = None
         self.window_surface = None
-        self.window_size = self.field_renderer.window_size
         self.clock = None
+        # In human mode, draw on a render thread that only ever shows the newest frame instead of inside step().
+        self.async_render = async_render
+        self._render_worker: Optional[RenderWorker] = None
+        self._frame_buffers: Optional[DoubleBuffer] = None
+
+    @property
+    def field_renderer(self):
+        """SSLRenderField for this field, built on first use."""
+        if self._field_renderer is None:
+            from utama_core.rsoccer_simulator.src.Render import SSLRenderField
+
+            self._field_renderer = SSLRenderField(**self._render_field_overrides)
+        return self._field_renderer
+
+    @property
+    def window_size(self) -> tuple[int, int]:
+        return self.field_renderer.window_size
 
     def step(self, action):
         self.steps += 1
@@ -116,6 +137,10 @@ class SSLBaseEnv:
     def render(self) -> None:
         """Renders the game depending on ball's and players' positions.
 
+        With ``async_render`` in human mode, this snapshots the frame and overlays and hands them to the render
+        thread, which draws off-screen, so it neither draws nor waits for the display frame rate. It then pumps the
+        window's events and shows the newest frame the render thread finished; the window stays on this thread.
+
         Parameters
         ----------
         None
@@ -124,30 +149,86 @@ class SSLBaseEnv:
         -------
         None
         """
+        import pygame
+
+        if self.render_mode == "human" and self.async_render:
+            snapshot = self.render_snapshot()  # also builds the field renderer before the render thread reads it
+            if self._render_worker is None:
+                self._open_window()
+                self._frame_buffers = DoubleBuffer(lambda: pygame.Surface(self.window_size))
+                self._render_worker = RenderWorker(self._draw_offscreen)
+            self._render_worker.submit(snapshot)
+            self.overlay = []  # clear overlay after render
+            pygame.event.pump()
+            if self._frame_buffers.show(lambda frame: self.window_surface.blit(frame, (0, 0))):
+                pygame.display.update()
+            return
 
         if self.window_surface is None:
-            pygame.init()
-
-            if self.render_mode == "human":
-                pygame.display.init()
-                pygame.display.set_caption("SSL Environment")
-                self.window_surface = pygame.display.set_mode(self.window_size)
-            elif self.render_mode == "rgb_array":
-                self.window_surface = pygame.Surface(self.window_size)
+            self._open_window()
 
         assert self.window_surface is not None, "Something went wrong with pygame. This should never happen."
 
-        if self.clock is None:
-            self.clock = pygame.time.Clock()
-        self._render()
         if self.render_mode == "human":
-            pygame.event.pump()
-            pygame.display.update()
-            self.clock.tick(self.metadata["render_fps"])
+            self._present(self.render_snapshot())
+            self.overlay = []  # clear overlay after render
         elif self.render_mode == "rgb_array":
+            self._render()
             return np.transpose(np.array(pygame.surfarray.pixels3d(self.window_surface)), axes=(1, 0, 2))
 
+    def render_snapshot(self) -> RenderSnapshot:
+        """The current frame and queued overlays in screen coordinates, detached from the env's own state."""
+
+        def poses(robots) -> tuple:
+            return tuple((*self._pos_transform(r.x, r.y), r.theta, r.id) for r in robots.values())
+
+        return RenderSnapshot(
+            ball=self._pos_transform(self.frame.ball.x, self.frame.ball.y),
+            robots_blue=poses(self.frame.robots_blue),
+            robots_yellow=poses(self.frame.robots_yellow),
+            overlay=tuple(self.overlay),
+        )
+
+    def _open_window(self) -> None:
+        import pygame
+
+        pygame.init()
+
+        if self.render_mode == "human":
+            pygame.display.init()
+            pygame.display.set_caption("SSL Environment")
+            self.window_surface = pygame.display.set_mode(self.window_size)
+        elif self.render_mode == "rgb_array":
+            self.window_surface = pygame.Surface(self.window_size)
+        self.clock = pygame.time.Clock()
+
+    def _present(self, snapshot: RenderSnapshot) -> None:
+        """Draw a snapshot to the window and cap the display frame rate."""
+        import pygame
+
+        self._draw_snapshot(snapshot)
+        pygame.event.pump()
+        pygame.display.update()
+        self.clock.tick(self.metadata["render_fps"])
+
+    def _draw_offscreen(self, snapshot: RenderSnapshot) -> None:
+        """Render thread: draw a snapshot into the back buffer, publish it and cap the drawing frame rate."""
+        self._draw_snapshot(snapshot, self._frame_buffers.back)
+        self._frame_buffers.swap()
+        self.clock.tick(self.metadata["render_fps"])
+
+    def _close_window(self) -> None:
+        import pygame
+
+        pygame.display.quit()
+        self.window_surface = None
+
     def close(self):
+        if self._render_worker is not None:
+            self._render_worker.close()
+            self._render_worker = None
+            self._frame_buffers = None
+            self._close_window()
         self.rsim.stop()
 
     ### CUSTOM FUNCTIONS WE ADDED ###
@@ -205,6 +286,8 @@ class SSLBaseEnv:
         width : float, optional
             The radius of the point. Default is 1. Cannot be less than 1.
         """
+        if self.render_mode is None:
+            return  # overlays are only cleared by rendering, so headless envs would accumulate them
         width = width if width >= 1 else 1
         point_data = OverlayObject(
             type=OverlayType.POINT,
@@ -226,6 +309,8 @@ class SSLBaseEnv:
         width : float, optional
             The width of the line. Default is 1. Cannot be less than 1.
         """
+        if self.render_mode is None:
+            return  # overlays are only cleared by rendering, so headless envs would accumulate them
         width = width if width >= 1 else 1
         transformed_points = []
         for point in points:
@@ -245,6 +330,8 @@ class SSLBaseEnv:
         width : float, optional
             The width of the line. Default is 1. Cannot be less than 1.
         """
+        if self.render_mode is None:
+            return  # overlays are only cleared by rendering, so headless envs would accumulate them
         width = width if width >= 1 else 1
         transformed_points = []
         for point in points:
@@ -260,46 +347,29 @@ class SSLBaseEnv:
     ### END OF CUSTOM FUNCTIONS ###
 
     def _render(self):
-        ball = RenderBall(
-            *self._pos_transform(self.frame.ball.x, self.frame.ball.y),
-            self.field_renderer.scale,
+        self._draw_snapshot(self.render_snapshot())
+        self.overlay = []  # clear overlay after render
+
+    def _draw_snapshot(self, snapshot: RenderSnapshot, surface=None):
+        from utama_core.rsoccer_simulator.src.Render import (
+            COLORS,
+            RenderBall,
+            RenderOverlay,
+            RenderSSLRobot,
         )
 
-        self.field_renderer.draw(self.window_surface)
+        surface = self.window_surface if surface is None else surface
+        scale = self.field_renderer.scale
+        self.field_renderer.draw(surface)
 
         # added this for drawing overlays
-        if self.overlay:
-            overlay = RenderOverlay(self.overlay, self.field_renderer.scale)
-            overlay.draw(self.window_surface)
-
-        for blue_rb in self.frame.robots_blue.values():
-            robot = blue_rb
-            x, y = self._pos_transform(robot.x, robot.y)
-            rbt = RenderSSLRobot(
-                x,
-                y,
-                robot.theta,
-                self.field_renderer.scale,
-                robot.id,
-                COLORS["BLUE"],
-            )
-            rbt.draw(self.window_surface)
-
-        for yellow_rb in self.frame.robots_yellow.values():
-            robot = yellow_rb
-            x, y = self._pos_transform(robot.x, robot.y)
-            rbt = RenderSSLRobot(
-                x,
-                y,
-                robot.theta,
-                self.field_renderer.scale,
-                robot.id,
-                COLORS["YELLOW"],
-            )
-            rbt.draw(self.window_surface)
-        ball.draw(self.window_surface)
+        if snapshot.overlay:
+            RenderOverlay(snapshot.overlay, scale).draw(surface)
 
-        self.overlay = []  # clear overlay after render
+        for robots, color in ((snapshot.robots_blue, COLORS["BLUE"]), (snapshot.robots_yellow, COLORS["YELLOW"])):
+            for x, y, theta, robot_id in robots:
+                RenderSSLRobot(x, y, theta, scale, robot_id, color).draw(surface)
+        RenderBall(*snapshot.ball, scale).draw(surface)
 
     def _pos_transform(self, pos_x, pos_y):
         return (
@@ -1,3 +1,5 @@
+from utama_core.run.batch_runner import BatchScenario, run_batch
 from utama_core.run.game_gater import GameGater
 from utama_core.run.referee_source import OfficialReferee, RefereeSource
+from utama_core.run.scheduler import LoopScheduler, SchedulerMode
 from utama_core.run.strategy_runner import StrategyRunner
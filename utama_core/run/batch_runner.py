@@ -0,0 +1,161 @@
+"""Runs many headless RSim scenarios in parallel, one StrategyRunner per worker process.
+
+Each scenario builds its own StrategyRunner (and therefore its own SSLStandardEnv, strategy and test manager) inside
+a worker, runs it through ``run_test`` with rendering off, and reports whether it passed. RSim is a single-threaded
+C++ simulator per environment and the control loop is Python, so processes rather than threads are what give a
+near-linear speedup across cores.
+
+Scenario factories are sent to the workers by pickling, so they must be module-level functions (or
+``functools.partial`` objects wrapping one), not lambdas or closures::
+
+    def charge_scenario(n_robots: int):
+        runner = StrategyRunner(strategy=..., mode="rsim", exp_friendly=n_robots, ...)
+        return runner, ChargeTestManager()
+
+    scenarios = [BatchScenario(f"charge_{n}", partial(charge_scenario, n), episode_timeout=20.0) for n in (1, 3, 6)]
+    result = run_batch(scenarios)
+    print(result.summary())
+"""
+
+import logging
+import multiprocessing
+import os
+import time
+import traceback
+from concurrent.futures import ProcessPoolExecutor, as_completed
+from dataclasses import dataclass
+from typing import TYPE_CHECKING, Callable, List, Optional, Sequence, Tuple
+
+from utama_core.config.enums import Mode
+
+if TYPE_CHECKING:
+    from utama_core.run.strategy_runner import StrategyRunner
+    from utama_core.tests.common.abstract_test_manager import AbstractTestManager
+
+logger = logging.getLogger(__name__)
+
+
+@dataclass(frozen=True)
+class BatchScenario:
+    """One independent RSim experiment.
+
+    Args:
+        name (str): Unique name of the scenario, used in the results.
+        build (Callable): Picklable factory returning ``(StrategyRunner, AbstractTestManager)``. It is called in the
+            worker process, so the environment and strategies are never pickled.
+        episode_timeout (float): Passed to ``StrategyRunner.run_test``.
+    """
+
+    name: str
+    build: Callable[[], Tuple["StrategyRunner", "AbstractTestManager"]]
+    episode_timeout: float = 10.0
+
+
+@dataclass(frozen=True)
+class ScenarioResult:
+    name: str
+    passed: bool
+    wall_time: float  # seconds, including building the runner
+    sim_steps: int  # RSim steps taken across all episodes
+    error: Optional[str] = None  # formatted traceback if the scenario raised
+
+
+@dataclass(frozen=True)
+class BatchResult:
+    results: List[ScenarioResult]  # in the order the scenarios were given
+    wall_time: float  # seconds for the whole batch
+    workers: int
+
+    @property
+    def passed(self) -> List[ScenarioResult]:
+        return [r for r in self.results if r.passed]
+
+    @property
+    def failed(self) -> List[ScenarioResult]:
+        return [r for r in self.results if not r.passed]
+
+    @property
+    def all_passed(self) -> bool:
+        return not self.failed
+
+    @property
+    def speedup(self) -> float:
+        """Summed per-scenario wall time over batch wall time."""
+        if self.wall_time <= 0:
+            return 0.0
+        return sum(r.wall_time for r in self.results) / self.wall_time
+
+    def summary(self) -> str:
+        lines = [
+            f"{len(self.passed)}/{len(self.results)} scenarios passed in {self.wall_time:.1f}s "
+            f"on {self.workers} worker(s) ({self.speedup:.1f}x over serial)"
+        ]
+        for r in self.results:
+            status = "PASS" if r.passed else ("ERROR" if r.error else "FAIL")
+            lines.append(f"  {status:<5} {r.name:<32} {r.wall_time:7.2f}s {r.sim_steps:7d} steps")
+        for r in self.failed:
+            if r.error:
+                lines.append(f"\n{r.name}:\n{r.error}")
+        return "\n".join(lines)
+
+
+def run_scenario(scenario: BatchScenario) -> ScenarioResult:
+    """Builds and runs one scenario headlessly in the current process. Never raises."""
+    start = time.perf_counter()
+    runner = None
+    try:
+        runner, test_manager = scenario.build()
+        if runner.mode != Mode.RSIM:
+            raise ValueError(f"Batch scenarios must run in rsim mode, got {runner.mode}.")
+        runner.rsim_env.render_mode = None
+        passed = runner.run_test(test_manager, episode_timeout=scenario.episode_timeout, rsim_headless=True)
+        error = None
+    except Exception:
+        passed = False
+        error = traceback.format_exc()
+    steps = runner.rsim_env.steps if runner is not None and getattr(runner, "rsim_env", None) else 0
+    return ScenarioResult(scenario.name, bool(passed), time.perf_counter() - start, steps, error)
+
+
+def run_batch(
+    scenarios: Sequence[BatchScenario],
+    max_workers: Optional[int] = None,
+    mp_context: str = "spawn",
+) -> BatchResult:
+    """Runs every scenario in a pool of worker processes and aggregates the results.
+
+    Args:
+        scenarios (Sequence[BatchScenario]): Scenarios to run; names must be unique.
+        max_workers (int, optional): Number of worker processes. Defaults to the CPU count. With 1, scenarios run
+            serially in this process, which is easier to debug.
+        mp_context (str): Multiprocessing start method. "spawn" is the default since forking a process that already
+            holds threads (vision receivers, replay writers, rich) is unsafe.
+
+    Returns:
+        BatchResult: Per-scenario results in input order, plus batch wall time.
+    """
+    names = [s.name for s in scenarios]
+    if len(set(names)) != len(names):
+        raise ValueError("Batch scenario names must be unique.")
+
+    workers = max(1, min(max_workers or os.cpu_count() or 1, len(scenarios)))
+    start = time.perf_counter()
+
+    if workers == 1:
+        results = [run_scenario(s) for s in scenarios]
+        return BatchResult(results, time.perf_counter() - start, workers)
+
+    by_name = {}
+    with ProcessPoolExecutor(max_workers=workers, mp_context=multiprocessing.get_context(mp_context)) as pool:
+        futures = {pool.submit(run_scenario, s): s for s in scenarios}
+        for future in as_completed(futures):
+            scenario = futures[future]
+            try:
+                result = future.result()
+            except Exception:
+                # The worker itself died (e.g. a segfault in RSim) or the scenario could not be pickled.
+                result = ScenarioResult(scenario.name, False, 0.0, 0, traceback.format_exc())
+            logger.info("%s: %s in %.2fs", result.name, "passed" if result.passed else "failed", result.wall_time)
+            by_name[result.name] = result
+
+    return BatchResult([by_name[name] for name in names], time.perf_counter() - start, workers)
@@ -1,10 +1,13 @@
 import time
-from typing import Deque, List, Optional, Tuple
+from typing import TYPE_CHECKING, Deque, List, Optional, Sequence, Tuple, Union
 
+from utama_core.data_processing.receivers import LatestFrameSlot
 from utama_core.data_processing.refiners import PositionRefiner
 from utama_core.entities.data.raw_vision import RawVisionData
 from utama_core.entities.game.game_frame import GameFrame
-from utama_core.rsoccer_simulator.src.ssl.ssl_gym_base import SSLBaseEnv
+
+if TYPE_CHECKING:
+    from utama_core.rsoccer_simulator.src.ssl.ssl_gym_base import SSLBaseEnv
 
 
 class GameGater:
@@ -15,10 +18,10 @@ class GameGater:
         exp_friendly: int,
         exp_enemy: int,
         exp_ball: bool,
-        vision_buffers: List[Deque[RawVisionData]],
+        vision_buffers: Sequence[Union[Deque[RawVisionData], LatestFrameSlot]],
         position_refiner: PositionRefiner,
         is_pvp: bool,
-        rsim_env: SSLBaseEnv = None,
+        rsim_env: "SSLBaseEnv" = None,
         wait_before_warn: float = 3.0,
     ) -> Tuple[GameFrame, Optional[GameFrame]]:
         """
@@ -0,0 +1,146 @@
+import threading
+import time
+from dataclasses import dataclass
+from enum import Enum
+from typing import Optional
+
+from utama_core.config.settings import TIMESTEP
+from utama_core.global_utils.latency import StageHistogram
+
+
+class SchedulerMode(Enum):
+    """How StrategyRunner paces the control loop outside RSim."""
+
+    SLEEP = "sleep"  # sleep for whatever is left of TIMESTEP after each tick
+    DEADLINE = "deadline"  # absolute deadlines every TIMESTEP, hybrid sleep + spin
+    VISION = "vision"  # tick as soon as a fresh vision frame arrives, TIMESTEP at the latest
+
+
+@dataclass(frozen=True)
+class SchedulerStats:
+    ticks: int
+    overruns: int  # ticks whose processing ran past their deadline
+    missed_deadlines: int  # deadlines skipped entirely because of overruns
+    interval_p50: float  # tick start to tick start, seconds
+    interval_p99: float
+    jitter_p50: float  # how late a tick started relative to its deadline, seconds
+    jitter_p99: float
+    jitter_max: float
+
+
+class LoopScheduler:
+    """Paces the control loop and reports overruns and jitter.
+
+    Call ``wait(tick_start)`` at the end of every tick, where ``tick_start`` is the ``time.perf_counter()``
+    value taken when the tick began. It returns when the next tick should start.
+
+    In DEADLINE mode deadlines are absolute (``t0 + k * period``), so a slow tick does not push back every
+    later tick; if a tick overruns by more than one period, the missed deadlines are skipped rather than
+    run back to back. The last ``spin_window`` seconds before a deadline are busy-waited, since
+    ``time.sleep`` typically overshoots by around a millisecond.
+
+    In VISION mode the tick starts as soon as ``fresh_vision`` is set (by LatestFrameSlot), but no sooner
+    than ``min_interval`` after the previous tick and no later than ``period`` after it.
+
+    Args:
+        mode (SchedulerMode): Pacing mode.
+        period (float): Target tick period in seconds.
+        spin_window (float): Busy-wait this long before a deadline instead of sleeping.
+        fresh_vision (threading.Event, optional): Set when a new vision frame arrives. Required for VISION mode.
+        min_interval (float, optional): Minimum spacing of vision-triggered ticks. Defaults to half the period,
+            which stops several unsynchronised cameras from each triggering their own tick.
+        window (int): Number of recent ticks used for the interval and jitter percentiles.
+    """
+
+    def __init__(
+        self,
+        mode: SchedulerMode = SchedulerMode.SLEEP,
+        period: float = TIMESTEP,
+        spin_window: float = 0.0008,
+        fresh_vision: Optional[threading.Event] = None,
+        min_interval: Optional[float] = None,
+        window: int = 600,
+    ):
+        if mode == SchedulerMode.VISION and fresh_vision is None:
+            raise ValueError("SchedulerMode.VISION needs a fresh_vision event to wait on.")
+        self.mode = mode
+        self.period = period
+        self.spin_window = spin_window
+        self.fresh_vision = fresh_vision
+        self.min_interval = period / 2 if min_interval is None else min_interval
+
+        self.ticks = 0
+        self.overruns = 0
+        self.missed_deadlines = 0
+        self.last_tick_overran = False
+        self._deadline: Optional[float] = None
+        self._last_start: Optional[float] = None
+        self._interval = StageHistogram(window)
+        self._jitter = StageHistogram(window)
+
+    def reset(self):
+        """Forget the current deadline, e.g. after a pause between test episodes."""
+        self._deadline = None
+        self._last_start = None
+        self.last_tick_overran = False
+
+    def wait(self, tick_start: float) -> None:
+        """Blocks until the next tick should start."""
+        if self._last_start is not None:
+            self._interval.add(tick_start - self._last_start)
+        self._last_start = tick_start
+        self.ticks += 1
+
+        if self.mode == SchedulerMode.SLEEP:
+            elapsed = time.perf_counter() - tick_start
+            self.last_tick_overran = elapsed > self.period
+            self.overruns += self.last_tick_overran
+            time.sleep(max(0, self.period - elapsed))
+            return
+
+        if self._deadline is None:
+            self._deadline = tick_start + self.period
+
+        now = time.perf_counter()
+        self.last_tick_overran = now > self._deadline
+        if self.last_tick_overran:
+            self.overruns += 1
+            # Skip every deadline that has already passed instead of bursting to catch up.
+            missed = int((now - self._deadline) // self.period)
+            self.missed_deadlines += missed
+            self._deadline += (missed + 1) * self.period
+
+        if self.mode == SchedulerMode.VISION:
+            self._sleep_until(tick_start + self.min_interval)
+            remaining = self._deadline - time.perf_counter()
+            if remaining > 0:
+                self.fresh_vision.wait(remaining)
+            self.fresh_vision.clear()
+            # Re-phase on the frame that woke us: the next fallback deadline is one period from now.
+            self._deadline = time.perf_counter() + self.period
+            return
+
+        self._sleep_until(self._deadline)
+        self._jitter.add(time.perf_counter() - self._deadline)
+        self._deadline += self.period
+
+    def _sleep_until(self, target: float) -> None:
+        remaining = target - time.perf_counter()
+        if remaining > self.spin_window:
+            time.sleep(remaining - self.spin_window)
+        while time.perf_counter() < target:
+            pass
+
+    def stats(self) -> SchedulerStats:
+        interval_p50, interval_p99, _ = self._interval.percentiles()
+        jitter_p50, jitter_p99, _ = self._jitter.percentiles()
+        return SchedulerStats(
+            ticks=self.ticks,
+            overruns=self.overruns,
+            missed_deadlines=self.missed_deadlines,
+            interval_p50=interval_p50,
+            interval_p99=interval_p99,
+            jitter_p50=jitter_p50,
+            jitter_p99=jitter_p99,
+            jitter_max=self._jitter.max,
+        )
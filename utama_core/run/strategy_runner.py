@@ -6,10 +6,7 @@ import time
 import warnings
 from collections import deque
 from dataclasses import dataclass, field
-from typing import TYPE_CHECKING, List, Optional, Tuple
-
-from rich.live import Live
-from rich.text import Text
+from typing import TYPE_CHECKING, Dict, List, Optional, Tuple, Union
 
 from utama_core.config.enums import Mode, mode_str_to_enum
 from utama_core.config.field_params import STANDARD_FIELD_DIMS, FieldDimensions
@@ -19,21 +16,26 @@ from utama_core.config.settings import (
     FPS_PRINT_INTERVAL,
     MAX_CAMERAS,
     MAX_GAME_HISTORY,
-    TIMESTEP,
 )
 from utama_core.custom_referee import CustomReferee
-from utama_core.data_processing.receivers import RefereeMessageReceiver, VisionReceiver
+from utama_core.data_processing.receivers import (
+    LatestFrameSlot,
+    RefereeMessageReceiver,
+    VisionReceiver,
+)
 from utama_core.data_processing.refiners import (
+    FrameWorkspace,
     PositionRefiner,
     RefereeRefiner,
     RobotInfoRefiner,
     VelocityRefiner,
 )
 from utama_core.entities.data.command import RobotCommand
-from utama_core.entities.data.raw_vision import RawVisionData
+from utama_core.entities.data.raw_vision import RawVisionArrays, RawVisionData
 from utama_core.entities.game import Game, GameFrame, GameHistory
 from utama_core.entities.game.field import Field, FieldBounds
 from utama_core.entities.referee.referee_command import RefereeCommand
+from utama_core.global_utils import latency
 from utama_core.global_utils.mapping_utils import (
     map_friendly_enemy_to_colors,
     map_left_right_to_colors,
@@ -41,28 +43,26 @@ from utama_core.global_utils.mapping_utils import (
 from utama_core.global_utils.math_utils import assert_valid_bounding_box
 from utama_core.motion_planning.src.common.control_schemes import get_control_scheme
 from utama_core.motion_planning.src.common.motion_controller import MotionController
-from utama_core.replay.replay_writer import ReplayWriter, ReplayWriterConfig
-from utama_core.rsoccer_simulator.src.ssl.envs import SSLStandardEnv
+from utama_core.replay.replay_writer import (
+    AsyncReplayWriter,
+    ReplayWriter,
+    ReplayWriterConfig,
+)
 from utama_core.rsoccer_simulator.src.Utils.gaussian_noise import RsimGaussianNoise
 from utama_core.run import GameGater
 from utama_core.run.referee_source import OfficialReferee, RefereeSource
+from utama_core.run.scheduler import LoopScheduler, SchedulerMode
 from utama_core.strategy.common.abstract_strategy import AbstractStrategy
-from utama_core.team_controller.src.controllers import (
-    AbstractSimController,
-    GRSimController,
-    GRSimRobotController,
-    RealRobotController,
-    RSimController,
-    RSimPVPManager,
-    RSimRobotController,
-)
-from utama_core.tests.common.abstract_test_manager import (
-    AbstractTestManager,
-    TestingStatus,
-)
 
+# The simulator, the terminal status panel, the controllers and the test manager are imported where they are first
+# used, so a runner only loads the subsystems of its own mode (no pygame for gRSim/Real, no serial stack for sims).
 if TYPE_CHECKING:
+    from rich.text import Text
+
     from utama_core.entities.data.referee import RefereeData
+    from utama_core.rsoccer_simulator.src.ssl.envs import SSLStandardEnv
+    from utama_core.team_controller.src.controllers import AbstractSimController
+    from utama_core.tests.common.abstract_test_manager import AbstractTestManager
 
 _GEOMETRY_MATCH_TOLERANCE_M = 0.001  # mm-precision integers from vision → 1 mm tolerance
 
@@ -86,6 +86,7 @@ class SideRuntime:
         velocity_refiner (VelocityRefiner): Velocity refiner for this side.
         robot_info_refiner (RobotInfoRefiner): Robot info refiner for this side.
         motion_controller (type[MotionController]): Motion controller factory for this side.
+        frame_workspace (FrameWorkspace): Reused by the refiners when refining in place; created on the first tick.
     """
 
     strategy: AbstractStrategy
@@ -97,6 +98,7 @@ class SideRuntime:
     game: Optional[Game] = field(init=False, default=None)
     game_history: Optional[GameHistory] = field(init=False, default=None)
     current_game_frame: Optional[GameFrame] = field(init=False, default=None)
+    frame_workspace: Optional[FrameWorkspace] = field(init=False, default=None)
 
 
 class StrategyRunner:
@@ -125,16 +127,36 @@ class StrategyRunner:
             and optional status text. Defaults to False.
         print_real_fps (bool, optional): Deprecated alias for `show_live_status`.
         profiler_name (Optional[str], optional): Enables and sets profiler name. Defaults to None which disables profiler.
+        track_latency (bool, optional): Time each pipeline stage (vision decode, refiners, strategy tick, motion,
+            send) and show p50/p99/max per stage in the live status panel. Defaults to False.
+        latency_export_path (Optional[str], optional): If set (implies track_latency), write one CSV row per tick
+            keyed by vision t_capture to this path when the runner closes. Defaults to None.
+        profile_behaviours (bool, optional): Also time each behaviour-tree node, reported as a "bt.<node name>"
+            latency stage (implies track_latency). Defaults to False.
+        scheduler_mode (SchedulerMode, optional): How the loop is paced in gRSim/Real. SLEEP sleeps for the rest of
+            TIMESTEP after each tick; DEADLINE runs on absolute deadlines; VISION ticks when a fresh vision frame
+            arrives. Overruns and jitter are shown in the live status panel. Defaults to SchedulerMode.SLEEP.
         rsim_noise (RsimGaussianNoise, optional): When running in rsim, add Gaussian noise to balls and robots with the
             given standard deviation. The 3 parameters are for x (in m), y (in m), and orientation (in degrees) respectively.
             Defaults to 0 for each.
         rsim_vanishing (float, optional): When running in rsim, cause robots and ball to vanish with the given probability.
             Defaults to 0.
+        rsim_async_render (bool, optional): When running in rsim, draw the window on a render thread that shows only the
+            newest frame, so rendering and debug overlays do not slow down or pace the control loop. Defaults to False.
         filtering (bool, optional): Turn on Kalman filtering. Defaults to false.
+        velocity_fit_window (int, optional): Estimate every object's velocity and acceleration in one batched
+            polynomial fit over its positions in the last this many frames, using their actual timestamps. Defaults
+            to None, which differences against the previous frame (see VelocityRefiner).
+        refine_in_place (bool, optional): Have the refiners write into one reusable, array-backed FrameWorkspace per
+            side and build the GameFrame once per tick, instead of each refiner copying the frame and its robots.
+            Defaults to False.
         referee (RefereeSource, optional): Referee source.  Pass a ``CustomReferee``
             instance to use the in-process referee, ``OfficialReferee()`` to consume
             commands from the SSL game-controller over the network, or ``None``
             (default) to run without any referee input.
+        prewarm (bool, optional): Before kickoff, compile the geometry kernels, build the refiners' workspaces and the
+            ball predictor, and plan once for every robot, so the first ticks do not pay these one-off costs. Startup
+            timings, including the time to the first command, are kept in ``startup_times``. Defaults to False.
     """
 
     def __init__(
@@ -155,12 +177,24 @@ class StrategyRunner:
         show_live_status: bool = False,  # Turn this on for simulator debugging
         print_real_fps: Optional[bool] = None,
         profiler_name: Optional[str] = None,
+        track_latency: bool = False,
+        latency_export_path: Optional[str] = None,
+        profile_behaviours: bool = False,
+        scheduler_mode: SchedulerMode = SchedulerMode.SLEEP,
         rsim_noise: RsimGaussianNoise = RsimGaussianNoise(),
         rsim_vanishing: float = 0,
+        rsim_async_render: bool = False,
         filtering: bool = False,
+        velocity_fit_window: Optional[int] = None,
+        refine_in_place: bool = False,
         referee: RefereeSource = None,
         formation_type: Optional[FormationType] = None,
+        prewarm: bool = False,
     ):
+        self._launched_at = time.perf_counter()
+        # Seconds since construction began: "game_valid" (first valid frame), "prewarm" (its duration)
+        # and "first_command" (end of the first tick)
+        self.startup_times: Dict[str, float] = {}
         self.logger = logging.getLogger(__name__)
 
         self._prev_custom_ref_command: Optional[RefereeCommand] = None
@@ -173,18 +207,23 @@ class StrategyRunner:
         self.exp_ball = exp_ball
         self.formation_type = formation_type
         self.full_field_dims = full_field_dims
+        self.refine_in_place = refine_in_place
+        self.velocity_fit_window = velocity_fit_window
+        self.rsim_async_render = rsim_async_render
         self.field_bounds = field_bounds if field_bounds else full_field_dims.full_field_bounds
         self.referee: RefereeSource = self._validate_referee(self.mode, referee)
 
         self._stop_event = threading.Event()
         self._vision_receiver: Optional[VisionReceiver] = None
+        self._fresh_vision = threading.Event()  # set by the vision slots on every new frame
+        self.scheduler = LoopScheduler(scheduler_mode, fresh_vision=self._fresh_vision)
 
         if isinstance(self.referee, CustomReferee):
             from utama_core.custom_referee.geometry import RefereeGeometry
 
             self.referee.override_geometry(RefereeGeometry.from_field_dims(self.full_field_dims))
 
-        self.vision_buffers, self.ref_buffer = self._setup_vision_and_referee()
+        self.vision_buffers, self.ref_buffer = self._setup_vision_and_referee(self._fresh_vision)
 
         assert_valid_bounding_box(
             self.field_bounds,
@@ -223,9 +262,13 @@ class StrategyRunner:
         if isinstance(self.referee, CustomReferee):
             initial_command = RefereeCommand.HALT if self.mode == Mode.REAL else RefereeCommand.FORCE_START
             self.referee.seed_clock(self.my.current_game_frame.ts, initial_command)
+        self.my.strategy.profile_nodes = profile_behaviours
         self.my.strategy.setup_behaviour_tree(is_opp_strat=False)
         if self.opp:
+            self.opp.strategy.profile_nodes = profile_behaviours
             self.opp.strategy.setup_behaviour_tree(is_opp_strat=True)
+        if prewarm:
+            self._prewarm()
 
         self.toggle_opp_first = False  # used to alternate the order of opp and friendly in run
 
@@ -238,18 +281,22 @@ class StrategyRunner:
             show_live_status = print_real_fps
 
         # Replay Writer
-        self.replay_writer = (
-            ReplayWriter(replay_writer_config, my_team_is_yellow, exp_friendly, exp_enemy)
-            if replay_writer_config
-            else None
-        )
+        self.replay_writer: Optional[ReplayWriter] = None
+        if replay_writer_config:
+            writer_cls = AsyncReplayWriter if replay_writer_config.async_writer else ReplayWriter
+            self.replay_writer = writer_cls(replay_writer_config, my_team_is_yellow, exp_friendly, exp_enemy)
 
         # Live terminal status panel
         self.num_frames_elapsed = 0
         self.elapsed_time = 0.0
         self.show_live_status = show_live_status
         self.print_real_fps = show_live_status
+        self._status_text: Optional[type["Text"]] = None
         if show_live_status:
+            from rich.live import Live
+            from rich.text import Text
+
+            self._status_text = Text
             self._fps_live = Live(auto_refresh=False)
             self._fps_live.start()  # manually control it so it never overrides prints
         else:
@@ -259,6 +306,12 @@ class StrategyRunner:
         self.profiler_name = profiler_name
         self.profiler = cProfile.Profile() if profiler_name else None
 
+        # Latency instrumentation (process-wide, so receivers, skills and controllers can record spans)
+        self.latency_export_path = latency_export_path
+        self.latency = latency.get_tracker()
+        self.latency.enabled = track_latency or latency_export_path is not None or profile_behaviours
+        self.latency.reset()
+
     def _handle_sigint(self, sig, frame):
         self._stop_event.set()
         signal.default_int_handler(sig, frame)
@@ -398,7 +451,7 @@ class StrategyRunner:
         self,
         rsim_noise: RsimGaussianNoise,
         rsim_vanishing: float,
-    ) -> Tuple[Optional[SSLStandardEnv], Optional[AbstractSimController]]:
+    ) -> Tuple[Optional["SSLStandardEnv"], Optional["AbstractSimController"]]:
         """Mode RSIM: Loads the RSim environment with the expected number of robots and corresponding sim controller.
         Mode GRSIM: Loads corresponding sim controller and teleports robots in GRSim to ensure the expected number of
         robots is met.
@@ -432,6 +485,9 @@ class StrategyRunner:
         )
 
         if self.mode == Mode.RSIM:
+            from utama_core.rsoccer_simulator.src.ssl.envs import SSLStandardEnv
+            from utama_core.team_controller.src.controllers import RSimController
+
             n_yellow, n_blue = map_friendly_enemy_to_colors(self.my_team_is_yellow, self.exp_friendly, self.exp_enemy)
             rsim_env = SSLStandardEnv(
                 n_robots_yellow=n_yellow,
@@ -443,6 +499,7 @@ class StrategyRunner:
                 ball_starting_position=self.field_bounds.center,
                 gaussian_noise=rsim_noise,
                 vanishing=rsim_vanishing,
+                async_render=self.rsim_async_render,
             )
 
             if self.opp:
@@ -453,6 +510,8 @@ class StrategyRunner:
 
         # GRSIM Mode
         else:
+            from utama_core.team_controller.src.controllers import GRSimController
+
             # can consider baking all of these directly into sim controller
             sim_controller = GRSimController(self.field_bounds, self.exp_ball)
             n_yellow, n_blue = map_friendly_enemy_to_colors(self.my_team_is_yellow, self.exp_friendly, self.exp_enemy)
@@ -483,9 +542,15 @@ class StrategyRunner:
 
             return None, sim_controller
 
-    def _setup_vision_and_referee(self) -> Tuple[deque, deque]:
-        """Setup vision and referee buffers, starting network receivers for gRSim/Real."""
-        vision_buffers = [deque(maxlen=1) for _ in range(MAX_CAMERAS)]
+    def _setup_vision_and_referee(
+        self, fresh_vision: Optional[threading.Event] = None
+    ) -> Tuple[List[LatestFrameSlot], deque]:
+        """Setup vision and referee buffers, starting network receivers for gRSim/Real.
+
+        Each camera gets a LatestFrameSlot, so the receiver decodes straight into preallocated arrays and only
+        the newest frame per camera is kept. ``fresh_vision`` is set whenever any camera publishes a frame.
+        """
+        vision_buffers = [LatestFrameSlot(notify=fresh_vision) for _ in range(MAX_CAMERAS)]
         ref_buffer = deque(maxlen=1)
         if self.mode != Mode.RSIM:
             on_geometry = self._make_geometry_validation_callback()
@@ -599,6 +664,11 @@ class StrategyRunner:
         Load the robot controllers and motion controllers for both friendly and opponent strategies.
         """
         if self.mode == Mode.RSIM:
+            from utama_core.team_controller.src.controllers import (
+                RSimPVPManager,
+                RSimRobotController,
+            )
+
             pvp_manager = None
             if self.opp:
                 pvp_manager = RSimPVPManager(self.rsim_env)
@@ -623,6 +693,8 @@ class StrategyRunner:
                     pvp_manager.load_controllers(opp_robot_controller, my_robot_controller)
 
         elif self.mode == Mode.GRSIM:
+            from utama_core.team_controller.src.controllers import GRSimRobotController
+
             my_robot_controller = GRSimRobotController(
                 is_team_yellow=self.my_team_is_yellow, n_friendly=self.exp_friendly
             )
@@ -632,6 +704,8 @@ class StrategyRunner:
                 )
 
         elif self.mode == Mode.REAL:
+            from utama_core.team_controller.src.controllers import RealRobotController
+
             my_robot_controller = RealRobotController(
                 is_team_yellow=self.my_team_is_yellow, n_friendly=self.exp_friendly
             )
@@ -670,7 +744,7 @@ class StrategyRunner:
             filtering=filtering,
             exp_ball=exp_ball,
         )
-        velocity_refiner = VelocityRefiner()
+        velocity_refiner = VelocityRefiner(fit_window=self.velocity_fit_window)
         robot_info_refiner = RobotInfoRefiner()
 
         return position_refiner, velocity_refiner, robot_info_refiner
@@ -692,6 +766,7 @@ class StrategyRunner:
             is_pvp=self.opp is not None,
             rsim_env=self.rsim_env,
         )
+        self.startup_times.setdefault("game_valid", time.perf_counter() - self._launched_at)
 
         self.my.position_refiner.start_filtering()
         if self.opp:
@@ -712,6 +787,32 @@ class StrategyRunner:
         if self.opp:
             self.opp.strategy.load_game(self.opp.game)
 
+    def _prewarm(self):
+        """Pay the one-off costs of the first tick before kickoff.
+
+        Compiles the geometry kernels, builds each side's FrameWorkspace (when refining in place), ball predictor and
+        field boundary distance grid, and plans once for every friendly robot towards its current pose, so planners and
+        controllers have built their per-robot state. That state is reset afterwards so the warm-up plan does not
+        leak into play.
+        """
+        from utama_core.global_utils import geometry_kernels
+
+        start = time.perf_counter()
+        geometry_kernels.warm_up()
+        for side in (self.my, self.opp):
+            if side is None:
+                continue
+            if self.refine_in_place and side.frame_workspace is None:
+                side.frame_workspace = FrameWorkspace(side.current_game_frame)
+            side.game.ball_trajectory  # builds the ball predictor
+            side.game.field.geometry.precompute()
+            motion_controller = side.strategy.blackboard.motion_controller
+            for robot_id, robot in side.game.friendly_robots.items():
+                motion_controller.calculate(side.game, robot_id, robot.p, robot.orientation)
+                motion_controller.reset(robot_id)
+        self.startup_times["prewarm"] = time.perf_counter() - start
+        self.logger.info("Prewarm took %.3fs", self.startup_times["prewarm"])
+
     # Reset the game state and robot info in buffer
     def _reset_game(self):
         """Reload game state by waiting for valid frames and reinitializing Game objects.
@@ -740,13 +841,16 @@ class StrategyRunner:
         opp_cmds = build_commands(self.opp) if self.opp and self.opp.game is not None else None
 
         for _ in range(repeat):
+            # flush so that every repeat is transmitted rather than superseded by the next one
             if my_cmds:
                 self.my.strategy.robot_controller.add_robot_commands(my_cmds)
                 self.my.strategy.robot_controller.send_robot_commands()
+                self.my.strategy.robot_controller.flush()
 
             if opp_cmds:
                 self.opp.strategy.robot_controller.add_robot_commands(opp_cmds)
                 self.opp.strategy.robot_controller.send_robot_commands()
+                self.opp.strategy.robot_controller.flush()
 
     def close(self, stop_command_repeat: int = 20):
         """
@@ -761,12 +865,19 @@ class StrategyRunner:
                 self._stop_robots(repeat=stop_command_repeat)
             except Exception:
                 self.logger.exception("Was unable to stop robots cleanly.")
+            for side in (self.my, self.opp):
+                controller = getattr(side.strategy, "robot_controller", None) if side else None
+                if controller is not None:
+                    controller.close()
         if self.profiler:
             self.profiler.disable()
             if self.profiler.getstats():
                 self.profiler.dump_stats(f"{self.profiler_name}.prof")
         if self.replay_writer:
             self.replay_writer.close()
+        if self.latency_export_path and self.latency.ticks:
+            self.latency.export(self.latency_export_path)
+            self.logger.info("Latency trace written to %s", self.latency_export_path)
         if self.rsim_env:
             self.rsim_env.close()
         if self._fps_live:
@@ -774,7 +885,7 @@ class StrategyRunner:
 
     def run_test(
         self,
-        test_manager: AbstractTestManager,
+        test_manager: "AbstractTestManager",
         episode_timeout: float = 10.0,
         rsim_headless: bool = False,
     ) -> bool:
@@ -784,6 +895,8 @@ class StrategyRunner:
             episode_timeout (float): The timeout for each episode in seconds.
             rsim_headless (bool): Whether to run RSim in headless mode. Defaults to False.
         """
+        from utama_core.tests.common.abstract_test_manager import TestingStatus
+
         signal.signal(signal.SIGINT, self._handle_sigint)
 
         passed = True
@@ -805,6 +918,7 @@ class StrategyRunner:
                     time.sleep(0.1)
 
                 self._reset_game()
+                self.scheduler.reset()
                 episode_start_time = time.time()
 
                 if self.profiler:
@@ -928,6 +1042,14 @@ class StrategyRunner:
                 self._last_referee_data = self.ref_buffer.popleft()
             referee_data = self._last_referee_data
 
+        if self.latency.enabled:
+            self._begin_latency_tick(vision_frames)
+
+        overran = self.scheduler.last_tick_overran
+        self.my.strategy.set_degraded(overran)
+        if self.opp:
+            self.opp.strategy.set_degraded(overran)
+
         # alternate between opp and friendly playing
         if self.toggle_opp_first:
             if self.opp:
@@ -938,12 +1060,13 @@ class StrategyRunner:
             if self.opp:
                 self._step_game(vision_frames, referee_data, True)
         self.toggle_opp_first = not self.toggle_opp_first
+        self.latency.end_tick()
+        if "first_command" not in self.startup_times:
+            self._record_first_command()
 
         # --- rate limiting ---
         if self.mode != Mode.RSIM:
-            processing_time = time.perf_counter() - frame_start
-            wait_time = max(0, TIMESTEP - processing_time)
-            time.sleep(wait_time)
+            self.scheduler.wait(frame_start)
 
         # --- end of frame ---
         if self.show_live_status:
@@ -960,7 +1083,8 @@ class StrategyRunner:
                 stage_secs = ref.stage_time_left
                 stage_min = int(stage_secs // 60)
                 stage_sec = int(stage_secs % 60)
-                display = Text()
+
+                display = self._status_text()
                 display.append(f"FPS: {fps:.1f}", style="bold cyan")
                 display.append("  |  ")
                 display.append(ref.last_command.name, style="bold yellow")
@@ -989,12 +1113,53 @@ class StrategyRunner:
                 if ref.last_status_message:
                     display.append(f"  |  {ref.last_status_message}", style="dim")
 
+                if self.mode != Mode.RSIM:
+                    self._append_scheduler_summary(display)
+                if self.latency.enabled:
+                    self._append_latency_summary(display)
+
                 self._fps_live.update(display)
                 self._fps_live.refresh()
 
                 self.elapsed_time = 0.0
                 self.num_frames_elapsed = 0
 
+    def _begin_latency_tick(self, vision_frames: List[Optional[Union[RawVisionData, RawVisionArrays]]]) -> None:
+        """Open a latency tick keyed to the newest vision frame consumed this tick."""
+        frames = [frame for frame in vision_frames if frame is not None]
+        if not frames:
+            self.latency.begin_tick()
+            return
+        newest = max(frames, key=lambda frame: frame.ts)
+        self.latency.begin_tick(newest.ts, getattr(newest, "received_at", None))
+
+    def _record_first_command(self) -> None:
+        """Record and report how long it took from construction to the end of the first tick."""
+        first_command = self.startup_times["first_command"] = time.perf_counter() - self._launched_at
+        game_valid = self.startup_times.get("game_valid", 0.0)
+        self.logger.info("Time to first command: %.3fs (valid game after %.3fs)", first_command, game_valid)
+        if self._fps_live:
+            self._fps_live.console.print(f"Time to first command: {first_command:.3f}s")
+
+    def _append_scheduler_summary(self, display: "Text") -> None:
+        """Append the loop scheduler's overrun and jitter statistics."""
+        stats = self.scheduler.stats()
+        display.append(f"\nLoop ({self.scheduler.mode.value}): ", style="bold")
+        display.append(f"overruns {stats.overruns}/{stats.ticks}", style="red" if stats.overruns else None)
+        display.append(f"  missed {stats.missed_deadlines}")
+        display.append(f"  interval p50 {stats.interval_p50 * 1e3:.2f}ms p99 {stats.interval_p99 * 1e3:.2f}ms")
+        if self.scheduler.mode == SchedulerMode.DEADLINE:
+            display.append(
+                f"  jitter p50 {stats.jitter_p50 * 1e3:.3f}ms p99 {stats.jitter_p99 * 1e3:.3f}ms"
+                f" max {stats.jitter_max * 1e3:.3f}ms"
+            )
+
+    def _append_latency_summary(self, display: "Text") -> None:
+        """Append one line per stage with p50 / p99 / max in milliseconds."""
+        for stage, (p50, p99, worst) in sorted(self.latency.summary().items()):
+            display.append(f"\n{stage:<16}", style="bold")
+            display.append(f" p50 {p50 * 1e3:7.2f}ms  p99 {p99 * 1e3:7.2f}ms  max {worst * 1e3:7.2f}ms")
+
     def _draw_rsim_field_bounds_overlay(self) -> None:
         """Draw active field bounds overlay in RSIM human render mode."""
         if self.mode != Mode.RSIM or not self.rsim_env:
@@ -1015,9 +1180,35 @@ class StrategyRunner:
         ]
         self.rsim_env.draw_polygon(bounds_polygon, color="PINK", width=2)
 
+    def _refine_in_place(
+        self,
+        side: SideRuntime,
+        vision_frames: List[Optional[Union[RawVisionData, RawVisionArrays]]],
+        responses,
+        referee_data,
+    ) -> GameFrame:
+        """Runs the refiners on the side's FrameWorkspace and returns this tick's GameFrame."""
+        workspace = side.frame_workspace
+        if workspace is None:
+            workspace = side.frame_workspace = FrameWorkspace(side.current_game_frame)
+        elif workspace.last_frame is not side.current_game_frame:
+            # The game was (re)loaded outside the pipeline, e.g. by _reset_game.
+            workspace.load(side.current_game_frame)
+
+        with self.latency.span("refine.position"):
+            side.position_refiner.refine_into(workspace, vision_frames)
+        with self.latency.span("refine.velocity"):
+            side.velocity_refiner.refine_into(side.game_history, workspace)
+        with self.latency.span("refine.robot_info"):
+            side.robot_info_refiner.refine_into(workspace, responses)
+        with self.latency.span("refine.referee"):
+            self.referee_refiner.refine_into(workspace, referee_data)
+        with self.latency.span("refine.snapshot"):
+            return workspace.snapshot()
+
     def _step_game(
         self,
-        vision_frames: List[RawVisionData],
+        vision_frames: List[Optional[Union[RawVisionData, RawVisionArrays]]],
         referee_data,
         running_opp: bool,
     ):
@@ -1034,10 +1225,17 @@ class StrategyRunner:
         responses = side.strategy.robot_controller.get_robots_responses()
 
         # Update game frame with refined information
-        new_game_frame = side.position_refiner.refine(side.current_game_frame, vision_frames)
-        new_game_frame = side.velocity_refiner.refine(side.game_history, new_game_frame)  # , robot_frame.imu_data)
-        new_game_frame = side.robot_info_refiner.refine(new_game_frame, responses)
-        new_game_frame = self.referee_refiner.refine(new_game_frame, referee_data)
+        if self.refine_in_place:
+            new_game_frame = self._refine_in_place(side, vision_frames, responses, referee_data)
+        else:
+            with self.latency.span("refine.position"):
+                new_game_frame = side.position_refiner.refine(side.current_game_frame, vision_frames)
+            with self.latency.span("refine.velocity"):
+                new_game_frame = side.velocity_refiner.refine(side.game_history, new_game_frame)
+            with self.latency.span("refine.robot_info"):
+                new_game_frame = side.robot_info_refiner.refine(new_game_frame, responses)
+            with self.latency.span("refine.referee"):
+                new_game_frame = self.referee_refiner.refine(new_game_frame, referee_data)
 
         # Store updated game frame
         side.current_game_frame = new_game_frame
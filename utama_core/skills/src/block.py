@@ -1,17 +1,19 @@
 import math
+from typing import Optional
 
 from utama_core.entities.data.command import RobotCommand
+from utama_core.entities.data.object import TeamType
 from utama_core.entities.data.vector import Vector2D
 from utama_core.entities.game.game import Game
 from utama_core.motion_planning.src.common.motion_controller import MotionController
-from utama_core.skills.src.utils.move_utils import move
+from utama_core.skills.src.utils.move_utils import empty_command, move
 
 
 def block_attacker(
     game: Game,
     motion_controller: MotionController,
     friendly_robot_id: int,
-    enemy_robot_id: int,
+    enemy_robot_id: Optional[int],
     attacker_has_ball: bool,
     block_ratio: float = 0.1,
     max_ball_follow_dist: float = 1.0,
@@ -20,9 +22,15 @@ def block_attacker(
     Intelligent defense strategy:
     1) If the attacker has the ball, block on the attacker-goal line.
     2) Otherwise, stay closer to the ball while still considering the attacker's possible shot.
+    If enemy_robot_id is None, the enemy closest to the ball is blocked.
     :return: The command dict for the defender robot
     """
     defender = game.friendly_robots[friendly_robot_id]
+    if enemy_robot_id is None:
+        enemy_key, _ = game.proximity_lookup.closest_to_ball(TeamType.ENEMY)
+        if enemy_key is None:
+            return empty_command(False)
+        enemy_robot_id = enemy_key.id
     attacker = game.enemy_robots[enemy_robot_id]
     ball = game.ball
 
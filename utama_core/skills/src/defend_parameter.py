@@ -1,5 +1,5 @@
 import math
-from typing import Optional
+from typing import TYPE_CHECKING, Optional
 
 import numpy as np
 
@@ -7,15 +7,17 @@ from utama_core.data_processing.predictors.position import predict_ball_pos_at_x
 from utama_core.entities.data.vector import Vector2D
 from utama_core.entities.game import Game
 from utama_core.motion_planning.src.common.motion_controller import MotionController
-from utama_core.rsoccer_simulator.src.ssl.envs.standard_ssl import SSLStandardEnv
 from utama_core.skills.src.go_to_point import go_to_point
 
+if TYPE_CHECKING:
+    from utama_core.rsoccer_simulator.src.ssl.envs.standard_ssl import SSLStandardEnv
+
 
 def defend_parameter(
     game: Game,
     motion_controller: MotionController,
     robot_id: int,
-    env: Optional[SSLStandardEnv] = None,
+    env: Optional["SSLStandardEnv"] = None,
 ):
     defenseing_friendly = game.friendly_robots[robot_id]
     vel = game.ball.v.to_2d()
@@ -70,20 +72,21 @@ def defend_parameter(
 
         return x3, y3, x4, y4
 
-    ball_y_at_baseline = predict_ball_pos_at_x(game, 4.5 if game.my_team_is_right else -4.5)
+    goal_x = game.field.my_goal_x
+    ball_y_at_baseline = predict_ball_pos_at_x(game, goal_x)
     ball_y_at_robo = predict_ball_pos_at_x(game, defenseing_friendly.p.x)
     if (
         vel[0] ** 2 + vel[1] ** 2 > 0.05
         and (ball_y_at_baseline is not None and ball_y_at_baseline[1] < 0.5 and ball_y_at_baseline[1] > -0.5)
         and (ball_y_at_robo is not None and abs(ball_y_at_robo[1] - defenseing_friendly.p.y) > 0.1)
     ):
-        x2, y2 = 4.5 if game.my_team_is_right else -4.5, (goal_frame + 0.2 if robot_id == 1 else goal_frame - 0.2)
+        x2, y2 = goal_x, (goal_frame + 0.2 if robot_id == 1 else goal_frame - 0.2)
         x3, y3, x4, y4 = positions_to_defend_parameter(x2, y2)
         target_pos = np.array([x4, y4])
 
     else:
         robot_rad = 0.09
-        x2, y2 = 4.5 if game.my_team_is_right else -4.5, -goal_frame
+        x2, y2 = goal_x, -goal_frame
         x3, y3, x4, y4 = positions_to_defend_parameter(x2, y2)
         vec_to_target = np.array(
             [
@@ -1,16 +1,18 @@
-from typing import Optional
+from typing import TYPE_CHECKING, Optional
 
 import numpy as np
 
 from utama_core.config.physical_constants import BALL_RADIUS, ROBOT_RADIUS
-from utama_core.data_processing.predictors.position import predict_ball_pos_at_x
+from utama_core.data_processing.predictors.position import predict_ball_arrival_at_x
 from utama_core.entities.data.vector import Vector2D
 from utama_core.entities.game import Game
 from utama_core.motion_planning.src.common.motion_controller import MotionController
-from utama_core.rsoccer_simulator.src.ssl.envs.standard_ssl import SSLStandardEnv
 from utama_core.skills.src.go_to_point import go_to_point
 from utama_core.skills.src.utils.move_utils import face_ball, move
 
+if TYPE_CHECKING:
+    from utama_core.rsoccer_simulator.src.ssl.envs.standard_ssl import SSLStandardEnv
+
 # TODO: instead of checking number of friendly, should check roles
 
 
@@ -18,12 +20,12 @@ def goalkeep(
     game: Game,
     motion_controller: MotionController,
     robot_id: int,
-    env: Optional[SSLStandardEnv] = None,
+    env: Optional["SSLStandardEnv"] = None,
 ):
     EDGE_OFFSET = BALL_RADIUS + ROBOT_RADIUS
-    goal_x = game.field.my_goal_line[0][0]
+    goal_x = game.field.my_goal_x
     half_goal_width = game.field.half_goal_width
-    target = predict_ball_pos_at_x(game, goal_x)
+    target = predict_ball_arrival_at_x(game, goal_x)
 
     stop_y = 0.0
 
@@ -1,12 +1,25 @@
+from typing import Optional
+
 import numpy as np
 
+from utama_core.entities.data.object import ObjectKey, ObjectType, TeamType
 from utama_core.entities.game import Game
 from utama_core.motion_planning.src.common.motion_controller import MotionController
-from utama_core.skills.src.utils.move_utils import face_ball, move
+from utama_core.skills.src.utils.move_utils import empty_command, face_ball, move
+
 
+def man_mark(game: Game, motion_controller: MotionController, robot_id: int, target_id: Optional[int] = None):
+    """Shadow an enemy robot, offset perpendicular to its line to the ball.
 
-def man_mark(game: Game, motion_controller: MotionController, robot_id: int, target_id: int):
+    If target_id is None, the enemy closest to the marking robot is marked.
+    """
     robot = game.friendly_robots[robot_id]
+    if target_id is None:
+        key = ObjectKey(TeamType.FRIENDLY, ObjectType.ROBOT, robot_id)
+        target_key, _ = game.proximity_lookup.closest_to_robot(key, TeamType.ENEMY)
+        if target_key is None:
+            return empty_command(False)
+        target_id = target_key.id
     target = game.enemy_robots[target_id]
     ball_pos = (game.ball.x, game.ball.y)
     # Position with a perpendicular offset to the line between target and ball
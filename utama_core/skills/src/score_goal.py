@@ -12,7 +12,6 @@ from utama_core.global_utils.math_utils import (
     angle_between_points as _angle_between_points,
 )
 from utama_core.motion_planning.src.common.motion_controller import MotionController
-from utama_core.rsoccer_simulator.src.ssl.envs.standard_ssl import SSLStandardEnv
 from utama_core.skills.src.go_to_ball import go_to_ball
 from utama_core.skills.src.utils.move_utils import kick, turn_on_spot
 
@@ -239,6 +238,78 @@ def find_shot_quality(
     return max(0.0, shot_quality)
 
 
+def _angles_at(points: np.ndarray, goal_x: float, y_a: np.ndarray, y_b: np.ndarray) -> np.ndarray:
+    """Angle at each point between the rays to (goal_x, y_a) and (goal_x, y_b), as in angle_between_points."""
+    ux = goal_x - points[:, 0]
+    ua, ub = y_a - points[:, 1], y_b - points[:, 1]
+    mags = np.hypot(ux, ua) * np.hypot(ux, ub)
+    with np.errstate(divide="ignore", invalid="ignore"):
+        cos_theta = np.clip((ux * ux + ua * ub) / mags, -1.0, 1.0)
+    return np.where(mags == 0, 0.0, np.arccos(cos_theta))
+
+
+def find_shot_qualities(
+    points: np.ndarray,
+    enemy_positions: np.ndarray,
+    goal_x: float,
+    goal_y1: float,
+    goal_y2: float,
+) -> np.ndarray:
+    """Vectorised find_shot_quality for (k, 2) shooting points against (m, 2) enemy positions.
+
+    Casts the same tangent shadows as _ray_casting for every point/enemy pair at once, then finds each point's
+    open goal intervals from the sorted shadows and picks the one _find_best_shot would.
+    """
+    points = np.asarray(points, dtype=float).reshape(-1, 2)
+    enemies = np.asarray(enemy_positions, dtype=float).reshape(-1, 2)
+    k = points.shape[0]
+    px, py = points[:, :1], points[:, 1:]
+    ex, ey = enemies[None, :, 0], enemies[None, :, 1]
+
+    # Shadow of every enemy on the goal line, clipped to the goal; enemies behind the point cast none.
+    goal_multi = -1 if goal_x < 0 else 1
+    dist = np.hypot(ex - px, ey - py)
+    angle_to_robot = np.arctan2(ey - py, ex - px)
+    with np.errstate(divide="ignore"):
+        alpha = np.where(dist <= ROBOT_RADIUS, math.pi / 2, np.arcsin(np.clip(ROBOT_RADIUS / dist, -1.0, 1.0)))
+    y_a = py + np.tan(angle_to_robot + alpha) * (goal_x - px)
+    y_b = py + np.tan(angle_to_robot - alpha) * (goal_x - px)
+    starts = np.maximum(np.minimum(y_a, y_b), goal_y1)
+    ends = np.minimum(np.maximum(y_a, y_b), goal_y2)
+    valid = (goal_multi * ex > goal_multi * px) & (starts < ends)
+    # Invalid shadows collapse onto goal_y1, where they can neither open nor close a gap.
+    starts = np.where(valid, starts, goal_y1)
+    ends = np.where(valid, ends, goal_y1)
+
+    # Open intervals lie between the running maximum of shadow ends and the next shadow start, plus the tail.
+    order = np.argsort(starts, axis=1, kind="stable")
+    starts = np.take_along_axis(starts, order, axis=1)
+    covered_to = np.maximum.accumulate(np.take_along_axis(ends, order, axis=1), axis=1)
+    covered_to = np.concatenate([np.full((k, 1), float(goal_y1)), covered_to], axis=1)
+    gap_lo = covered_to
+    gap_hi = np.concatenate([starts, np.full((k, 1), float(goal_y2))], axis=1)
+    gap_len = gap_hi - gap_lo
+
+    at_post = np.isclose(gap_lo, goal_y1, rtol=0.0, atol=1e-6) | np.isclose(gap_hi, goal_y2, rtol=0.0, atol=1e-6)
+    clearance = np.where(gap_len > 0, np.where(at_post, gap_len, gap_len / 2), -1.0)
+    best = np.argmax(clearance, axis=1)[:, None]  # first maximum, like the strict > in _find_best_shot
+    has_gap = np.take_along_axis(clearance, best, axis=1)[:, 0] > 0
+    best_lo = np.take_along_axis(gap_lo, best, axis=1)[:, 0]
+    best_hi = np.take_along_axis(gap_hi, best, axis=1)[:, 0]
+
+    full_angle = _angles_at(points, goal_x, np.full(k, float(goal_y1)), np.full(k, float(goal_y2)))
+    open_angle = _angles_at(points, goal_x, best_lo, best_hi)
+    distance_to_goal_ratio = np.abs(points[:, 0] - goal_x) / np.abs(2 * goal_x)
+    distance_to_goal_weight = 0.4
+
+    with np.errstate(divide="ignore", invalid="ignore"):
+        quality = np.where(
+            full_angle > 0, open_angle / full_angle - distance_to_goal_weight * distance_to_goal_ratio, 0.0
+        )
+    quality = np.where(has_gap, quality, 0.0)
+    return np.maximum(quality, 0.0)
+
+
 def is_goal_blocked(game: Game, best_shot: Tuple[float, float], defenders: List[Robot]) -> bool:
     """Determines whether the goal is blocked by enemy robots (considering them as circles).
 
@@ -1,8 +1,36 @@
+"""Pass evaluation: how likely a pass is to be intercepted and how good a shot the receiver would then have.
+
+All evaluation is batched: ``find_pass_qualities`` scores any number of candidate receiver positions against all
+enemies in one set of array operations, which is what makes the field-wide ``pass_quality_heatmap`` cheap enough
+to run every tick. The per-receiver functions below are thin wrappers over it.
+"""
+
+from typing import List, Sequence, Tuple
+
 import numpy as np
 
 from utama_core.config.physical_constants import ROBOT_RADIUS
 from utama_core.entities.data.vector import Vector2D
-from utama_core.global_utils.math_utils import distance
+from utama_core.skills.src.score_goal import find_shot_qualities
+
+# Pass quality weights (these will be adjusted)
+INTERCEPTION_CHANCE_WEIGHT = 3
+GOAL_CHANCE_WEIGHT = 0.5
+DISTANCE_TO_GOAL_WEIGHT = 0.2
+MIN_PASS_DISTANCE = 0.7
+
+
+def _as_point(point) -> np.ndarray:
+    if hasattr(point, "x"):
+        return np.array((float(point.x), float(point.y)))
+    return np.asarray(point, dtype=float)[:2]
+
+
+def _as_points(points) -> np.ndarray:
+    """(n, 2) array from an array or a sequence of Vector2D / (x, y) points."""
+    if isinstance(points, np.ndarray):
+        return points.astype(float, copy=False).reshape(-1, 2)
+    return np.array([_as_point(p) for p in points], dtype=float).reshape(-1, 2)
 
 
 def ball_position(t, x0, v0, a):
@@ -12,45 +40,96 @@ def ball_position(t, x0, v0, a):
     return x0[0:2] + v0 * t + 0.5 * a * (t**2)
 
 
+def interception_chances(
+    passer,
+    receivers,
+    enemy_positions,
+    enemy_speeds,
+    ball_v0_magnitude: float,
+    ball_a_magnitude: float,
+) -> Tuple[np.ndarray, np.ndarray, np.ndarray]:
+    """Interception chance of every enemy for passes from ``passer`` to each of the k receiver positions.
+
+    Returns:
+        - chances: (k, m) chance per receiver and enemy, 0 where the enemy cannot intercept
+        - closest_points: (k, m, 2) point on each pass line closest to each enemy
+        - ball_positions: (k, m, 2) ball position when the enemy reaches that point
+    """
+    passer = _as_point(passer)
+    receivers = _as_points(receivers)
+    enemies = _as_points(enemy_positions)
+    speeds = np.broadcast_to(np.asarray(enemy_speeds, dtype=float).reshape(-1), (enemies.shape[0],))
+
+    pass_vecs = receivers - passer  # (k, 2)
+    pass_len_sq = np.einsum("ij,ij->i", pass_vecs, pass_vecs)
+    pass_len = np.sqrt(pass_len_sq)
+    with np.errstate(divide="ignore", invalid="ignore"):
+        pass_units = pass_vecs / pass_len[:, None]
+        projection = (pass_vecs @ (enemies - passer).T) / pass_len_sq[:, None]  # (k, m)
+    on_pass = (projection >= 0) & (projection <= 1)
+    closest_points = passer + projection[..., None] * pass_vecs[:, None, :]
+
+    # Time for the ball to reach the closest point: the positive root of 0.5|a|t^2 + |v0|t - d = 0.
+    ball_distance = projection * pass_len[:, None]
+    v0, a = abs(ball_v0_magnitude), abs(ball_a_magnitude)
+    with np.errstate(divide="ignore", invalid="ignore"):
+        ball_time = 2 * ball_distance / (v0 + np.sqrt(v0 * v0 + 2 * a * ball_distance))
+    ball_time = np.where(ball_time > 0, ball_time, np.inf)
+
+    to_line = closest_points - enemies[None, :, :]
+    opp_dist_to_pass = np.hypot(to_line[..., 0], to_line[..., 1]) - ROBOT_RADIUS
+    with np.errstate(divide="ignore"):
+        opp_to_pass_time = np.where(speeds > 0, opp_dist_to_pass / speeds, np.inf)
+    opp_to_pass_time = np.where(opp_dist_to_pass > 0, opp_to_pass_time, 0.0)
+
+    intercepts = on_pass & np.isfinite(opp_to_pass_time) & (opp_to_pass_time <= ball_time)
+    t = np.where(intercepts, opp_to_pass_time, 0.0)
+    travelled = ball_v0_magnitude * t + 0.5 * ball_a_magnitude * t**2
+    ball_positions = passer + np.nan_to_num(pass_units)[:, None, :] * travelled[..., None]
+    miss = ball_positions - closest_points
+    chances = np.where(intercepts, np.log1p(np.hypot(miss[..., 0], miss[..., 1])), 0.0)
+    return chances, closest_points, ball_positions
+
+
 def interception_chance(passer, receiver, opponent, robot_speed, ball_v0_magnitude, ball_a_magnitude):
-    # assert type(passer) != tuple
-    # assert type(receiver) != tuple
-    # robot_speed = np.linalg.norm(robot_velocity)
-    passer_vector = np.array([passer.x, passer.y])
-    receiver_vector = np.array([receiver.x, receiver.y])
-    opp_vector = np.array([opponent.x, opponent.y])
-    passer_to_receiver_vec = receiver_vector - passer_vector
-    pr_unit = passer_to_receiver_vec / np.linalg.norm(passer_to_receiver_vec)
-    ball_v0 = pr_unit * ball_v0_magnitude
-    ball_a = pr_unit * ball_a_magnitude
-
-    passer_to_opp_vec = opp_vector - passer_vector
-    projection = np.dot(passer_to_opp_vec, passer_to_receiver_vec) / np.dot(
-        passer_to_receiver_vec, passer_to_receiver_vec
+    chances, closest_points, ball_positions = interception_chances(
+        passer, [receiver], [opponent], robot_speed, ball_v0_magnitude, ball_a_magnitude
     )
-    if projection < 0 or projection > 1:
-        return 0, None, None
-    closest_point = passer_vector + projection * passer_to_opp_vec
-    ball_distance = np.linalg.norm(closest_point - passer_vector)
-    ball_speed = np.linalg.norm(ball_v0)
-    ball_time_roots = np.roots([0.5 * np.linalg.norm(ball_a), ball_speed, -ball_distance])
-    ball_time = np.max(ball_time_roots[ball_time_roots > 0]) if np.any(ball_time_roots > 0) else float("inf")
-
-    opp_dist_to_pass = np.linalg.norm(closest_point - opp_vector) - ROBOT_RADIUS
-    if opp_dist_to_pass > 0:
-        opp_to_pass_time = opp_dist_to_pass / robot_speed if robot_speed != 0 else float("inf")
-    else:
-        opp_to_pass_time = 0
-
-    if opp_to_pass_time <= ball_time:
-        ball_pos = ball_position(opp_to_pass_time, passer, ball_v0, ball_a)
-        opp_to_ball_dist = np.linalg.norm(ball_pos - closest_point)
-        chance = np.log(1 + opp_to_ball_dist)
-    else:
-        chance = 0
+    chance = float(chances[0, 0])
+    if chance == 0:
         return 0, None, None
+    return chance, closest_points[0, 0], ball_positions[0, 0]
 
-    return chance, closest_point, ball_pos
+
+def find_pass_qualities(
+    passer,
+    receivers,
+    enemy_positions,
+    enemy_speeds,
+    ball_v0_magnitude,
+    ball_a_magnitude,
+    goal_x,
+    goal_y1,
+    goal_y2,
+) -> np.ndarray:
+    """Pass quality for each of the k receiver positions, -inf for passes shorter than MIN_PASS_DISTANCE."""
+    passer = _as_point(passer)
+    receivers = _as_points(receivers)
+    enemies = _as_points(enemy_positions)
+
+    chances, _, _ = interception_chances(passer, receivers, enemies, enemy_speeds, ball_v0_magnitude, ball_a_magnitude)
+    total_interception_chance = chances.sum(axis=1)
+    goal_chance = find_shot_qualities(receivers, enemies, goal_x, goal_y1, goal_y2)
+    distance_to_goal_ratio = np.abs(receivers[:, 0] - goal_x) / np.abs(2 * goal_x)
+    distance_to_passer = np.hypot(receivers[:, 0] - passer[0], receivers[:, 1] - passer[1])
+
+    pass_quality = (
+        1
+        - INTERCEPTION_CHANCE_WEIGHT * total_interception_chance
+        + GOAL_CHANCE_WEIGHT * goal_chance
+        - DISTANCE_TO_GOAL_WEIGHT * distance_to_goal_ratio
+    )
+    return np.where(distance_to_passer >= MIN_PASS_DISTANCE, pass_quality, -np.inf)
 
 
 def find_pass_quality(
@@ -65,41 +144,19 @@ def find_pass_quality(
     goal_y2,
     shoot_in_left_goal,
 ):
-    from robot_control.src.utils.shooting_utils import find_shot_quality
-
-    total_interception_chance = 0
-    for enemy_pos, enemy_speed in zip(enemy_positions, enemy_speeds):
-        interception, _, _ = interception_chance(
-            passer,
-            receiver,
-            enemy_pos,
-            enemy_speed,
-            ball_v0_magnitude,
-            ball_a_magnitude,
-        )
-        total_interception_chance += interception
-    goal_chance = find_shot_quality(receiver, enemy_positions, goal_x, goal_y1, goal_y2, shoot_in_left_goal)
-
-    distance_to_goal_ratio = (np.absolute(receiver.x - goal_x)) / np.absolute(2 * goal_x)
-
-    distance_to_passer = distance((passer.x, passer.y), (receiver.x, receiver.y))
-
-    # these will be adjusted
-    interception_chance_weight = 3
-    goal_chance_weight = 0.5
-    distance_to_goal_weight = 0.2
-
-    if distance_to_passer >= 0.7:
-        pass_quality = (
-            1
-            - interception_chance_weight * total_interception_chance
-            + goal_chance_weight * goal_chance
-            - distance_to_goal_weight * distance_to_goal_ratio
-        )  # pass quality metric
-    else:
-        pass_quality = float("-inf")
-
-    return pass_quality
+    # shoot_in_left_goal is implied by the sign of goal_x; kept for existing callers.
+    qualities = find_pass_qualities(
+        passer,
+        [receiver],
+        enemy_positions,
+        enemy_speeds,
+        ball_v0_magnitude,
+        ball_a_magnitude,
+        goal_x,
+        goal_y1,
+        goal_y2,
+    )
+    return float(qualities[0])
 
 
 def find_best_pass(
@@ -114,29 +171,24 @@ def find_best_pass(
     goal_y2,
     shoot_in_left_goal,
 ):
-    best_quality = -float("inf")
-    best_receiver = None
-    pass_qualities = []
-
-    for receiver in friendly_robots:
-        pass_quality = find_pass_quality(
-            passer,
-            receiver,
-            enemy_positions,
-            enemy_speeds,
-            ball_v0_magnitude,
-            ball_a_magnitude,
-            goal_x,
-            goal_y1,
-            goal_y2,
-            shoot_in_left_goal,
-        )
-        pass_qualities.append(pass_quality)
-        if pass_quality > best_quality:
-            best_quality = pass_quality
-            best_receiver = receiver
-
-    return best_receiver, pass_qualities
+    friendly_robots = list(friendly_robots)
+    if not friendly_robots:
+        return None, []
+
+    pass_qualities = find_pass_qualities(
+        passer,
+        friendly_robots,
+        enemy_positions,
+        enemy_speeds,
+        ball_v0_magnitude,
+        ball_a_magnitude,
+        goal_x,
+        goal_y1,
+        goal_y2,
+    )
+    best = int(np.argmax(pass_qualities))
+    best_receiver = friendly_robots[best] if pass_qualities[best] > -np.inf else None
+    return best_receiver, pass_qualities.tolist()
 
 
 def find_best_receiver_position(
@@ -165,39 +217,77 @@ def find_best_receiver_position(
     x_min, x_max = field_limits[0]
     y_min, y_max = field_limits[1]
 
-    best_position = receiver_position
-    best_quality = -float("inf")
+    angles = np.linspace(0, 2 * np.pi, num_samples, endpoint=False)
+    xs = receiver_position.x + sample_radius * np.cos(angles)
+    ys = receiver_position.y + sample_radius * np.sin(angles)
+
+    # Ensure the sampled positions are within the field
+    inside = (x_min <= xs) & (xs <= x_max) & (y_min <= ys) & (ys <= y_max)
+    sampled_positions = [receiver_position] + [Vector2D(x, y) for x, y in zip(xs[inside], ys[inside])]
+
+    pass_qualities = find_pass_qualities(
+        passer,
+        sampled_positions,
+        enemy_positions,
+        enemy_speeds,
+        ball_v0_magnitude,
+        ball_a_magnitude,
+        goal_x,
+        goal_y1,
+        goal_y2,
+    )
+    best = int(np.argmax(pass_qualities))
+    best_position = sampled_positions[best] if pass_qualities[best] > -np.inf else receiver_position
 
-    sampled_positions = [receiver_position]  # Include the current position
-    pass_qualities = []  # Store pass quality for each sampled point
+    return best_position, sampled_positions, pass_qualities.tolist()
 
-    angles = np.linspace(0, 2 * np.pi, num_samples, endpoint=False)
 
-    for angle in angles:
-        new_x = receiver_position.x + sample_radius * np.cos(angle)
-        new_y = receiver_position.y + sample_radius * np.sin(angle)
-
-        # Ensure the sampled position is within the field
-        if x_min <= new_x <= x_max and y_min <= new_y <= y_max:
-            sampled_positions.append(Vector2D(new_x, new_y))
-
-    for candidate in sampled_positions:
-        pass_quality = find_pass_quality(
-            passer,
-            candidate,
-            enemy_positions,
-            enemy_speeds,
-            ball_v0_magnitude,
-            ball_a_magnitude,
-            goal_x,
-            goal_y1,
-            goal_y2,
-            shoot_in_left_goal,
-        )
-        pass_qualities.append(pass_quality)
-        # pass_quality += 100 * squared_distance(receiver_position, passer)
-        if pass_quality > best_quality:
-            best_quality = pass_quality
-            best_position = candidate
-
-    return best_position, sampled_positions, pass_qualities
+def pass_quality_heatmap(
+    passer,
+    enemy_positions,
+    enemy_speeds,
+    ball_v0_magnitude,
+    ball_a_magnitude,
+    goal_x,
+    goal_y1,
+    goal_y2,
+    field_limits: Sequence[Tuple[float, float]] = ((-4.5, 4.5), (-3.0, 3.0)),
+    resolution: float = 0.1,
+) -> Tuple[np.ndarray, np.ndarray, np.ndarray]:
+    """Pass quality over a regular grid covering ``field_limits``, for off-ball positioning.
+
+    Returns:
+        - xs: (nx,) grid x coordinates
+        - ys: (ny,) grid y coordinates
+        - qualities: (ny, nx) pass quality of a receiver at (xs[j], ys[i]); -inf too close to the passer
+    """
+    (x_min, x_max), (y_min, y_max) = field_limits
+    xs = np.arange(x_min, x_max + resolution / 2, resolution)
+    ys = np.arange(y_min, y_max + resolution / 2, resolution)
+    grid_x, grid_y = np.meshgrid(xs, ys)
+    candidates = np.column_stack([grid_x.ravel(), grid_y.ravel()])
+
+    qualities = find_pass_qualities(
+        passer,
+        candidates,
+        enemy_positions,
+        enemy_speeds,
+        ball_v0_magnitude,
+        ball_a_magnitude,
+        goal_x,
+        goal_y1,
+        goal_y2,
+    )
+    return xs, ys, qualities.reshape(grid_x.shape)
+
+
+def best_heatmap_positions(xs: np.ndarray, ys: np.ndarray, qualities: np.ndarray, k: int = 1) -> List[Vector2D]:
+    """The ``k`` highest-quality grid positions of a pass_quality_heatmap, best first."""
+    flat = qualities.ravel()
+    k = min(k, flat.size)
+    if k <= 0:
+        return []
+    top = np.argpartition(-flat, k - 1)[:k]
+    top = top[np.argsort(-flat[top], kind="stable")]
+    rows, cols = np.unravel_index(top, qualities.shape)
+    return [Vector2D(xs[c], ys[r]) for r, c in zip(rows, cols)]
@@ -1,20 +1,46 @@
-from typing import Dict, List, Optional, Tuple
+import math
+from functools import lru_cache
+from typing import TYPE_CHECKING, Dict, List, Optional, Tuple
 
 import numpy as np
 
+from utama_core.entities.data.object import TeamType
 from utama_core.entities.data.vector import Vector2D
-from utama_core.entities.game import Ball, Game, Robot
-from utama_core.rsoccer_simulator.src.ssl.envs.standard_ssl import SSLStandardEnv
+from utama_core.entities.game import Ball, Game, ProximityLookup, Robot
+
+if TYPE_CHECKING:
+    from utama_core.rsoccer_simulator.src.ssl.envs.standard_ssl import SSLStandardEnv
 
 EPS = 1e-5
 
+# Parameter range and shape of the defenders' curve (see calculate_defense_area).
+MIN_T = np.pi / 2
+MAX_T = 3 * np.pi / 2
+_CURVE_A, _CURVE_R = 1.1, 2.1
+
+
+def _curve_offset(cos_t, sin_t):
+    """Defenders' curve relative to the goal centre, with +x pointing out of the goal."""
+    a, r = _CURVE_A, _CURVE_R
+    return (
+        a * ((1 - r) * (abs(cos_t) * cos_t) + r * cos_t),
+        a * ((1 - r) * (abs(sin_t) * sin_t) + r * sin_t),
+    )
+
+
+# The curve does not depend on the field, so it is sampled once and to_defense_parametric
+# inverts it with a table search instead of evaluating it inside a ternary search.
+_CURVE_TS = np.linspace(MIN_T, MAX_T, 2049)
+_CURVE_STEP = _CURVE_TS[1] - _CURVE_TS[0]
+_CURVE_XS, _CURVE_YS = _curve_offset(np.cos(_CURVE_TS), np.sin(_CURVE_TS))
+
 
 def align_defenders(
     game: Game,
     defender_parametric_pos: float,
     attacker_position: Vector2D,
     attacker_orientation: Optional[float],
-    env: Optional[SSLStandardEnv],
+    env: Optional["SSLStandardEnv"],
 ) -> Tuple[float, float]:
     """Calculates the next point on the defense area that the robots should go to defender_position is in terms of t on
     the parametric curve."""
@@ -25,7 +51,7 @@ def align_defenders(
     defender_pos = calculate_defense_area(game, defender_parametric_pos)
 
     # logger.debug(f"DEFENDER {dx} {dy}")
-    goal_centre_x = game.field.my_goal_line[0][0]
+    goal_centre_x = game.field.my_goal_x
 
     if attacker_orientation is None or attacker_orientation == 0:
         # In case there is no ball velocity or attackers, use centre of goal
@@ -40,9 +66,7 @@ def align_defenders(
         env.draw_line([predicted_goal_position, attacker_position], width=1, color="green")
         env.draw_line([predicted_goal_position, defender_pos], width=1, color="yellow")
 
-        poly = []
-        for t in range(round(1000 * np.pi / 2), round(1000 * 3 * np.pi / 2) + 1):
-            poly.append(calculate_defense_area(game, clamp_to_parametric(t / 1000)))
+        poly = defense_curve_polygon(goal_centre_x)
         env.draw_polygon(poly, width=3)
 
     goal_to_defender = defender_pos - predicted_goal_position
@@ -77,29 +101,15 @@ def calculate_defense_area(game: Game, t: float) -> Vector2D:
 
     https://www.desmos.com/calculator/nmaf7rpmnw
     """
-    MIN_T = np.pi / 2
-    MAX_T = 3 * np.pi / 2
-
     t = max(MIN_T, min(t, MAX_T))
+    x, y = _curve_offset(math.cos(t), math.sin(t))
+    return make_relative_to_goal_centre(game.field.my_goal_x, Vector2D(x, y))
 
-    cos_t = np.cos(t)
-    sin_t = np.sin(t)
-
-    a, r = 1.1, 2.1
-    rp = Vector2D(
-        a * ((1 - r) * (abs(cos_t) * cos_t) + r * cos_t),
-        a * ((1 - r) * (abs(sin_t) * sin_t) + r * sin_t),
-    )
-
-    # This slows everything down sooo much that everything breaks (ask Fred if still confused)
-    # goal_centre_x, _ = game.field.my_goal_line[0]
 
-    if game.my_team_is_right:
-        goal_centre_x = 4.5
-    else:
-        goal_centre_x = -4.5
-
-    return make_relative_to_goal_centre(goal_centre_x, rp)
+@lru_cache(maxsize=4)
+def defense_curve_polygon(goal_centre_x: float) -> List[Vector2D]:
+    """The sampled defenders' curve around the goal at ``goal_centre_x``, for drawing."""
+    return [make_relative_to_goal_centre(goal_centre_x, Vector2D(x, y)) for x, y in zip(_CURVE_XS, _CURVE_YS)]
 
 
 def make_relative_to_goal_centre(goal_centre_x: float, p: Vector2D) -> Vector2D:
@@ -111,7 +121,7 @@ def make_relative_to_goal_centre(goal_centre_x: float, p: Vector2D) -> Vector2D:
 
 def predict_goal_y_location(game: Game, shooter_position: Vector2D, orientation: float) -> float:
     dx, dy = np.cos(orientation), np.sin(orientation)
-    gx, _ = game.field.my_goal_line[0]
+    gx = game.field.my_goal_x
     if dx == 0:
         return float("inf")
     t = (gx - shooter_position[0]) / dx
@@ -122,41 +132,32 @@ def to_defense_parametric(game: Game, p: Vector2D) -> float:
     """Given a point p on the defenders' parametric curve (as defined by calculate_defense_area), returns the parameter
     value t which would give rise to this point."""
 
-    # Ternary search the paramater, minimising the Euclidean distance between
-    # the point corresponding to the predicted t and the actual point. We
-    # could potentially use length along the curve (I think you can get this
-    # from polar coordinates? But for a semicircle ish curve this works fine)
-    lo = np.pi / 2
-    hi = 3 * np.pi / 2
-    EPS = 1e-6
-
-    while (hi - lo) > EPS:
-        mi1 = lo + (hi - lo) / 3
-        mi2 = lo + 2 * (hi - lo) / 3
-
-        pred1 = calculate_defense_area(game, mi1)
-        pred2 = calculate_defense_area(game, mi2)
-
-        dist1 = p.distance_to(pred1)
-        dist2 = p.distance_to(pred2)
-
-        if dist1 < dist2:
-            hi = mi2
-        else:
-            lo = mi1
-
-    t = lo
+    # Nearest sample of the precomputed curve, refined by fitting a parabola through the squared
+    # distances of its neighbours. Unlike the ternary search this replaces, this also finds the
+    # global minimum for points far from the curve.
+    goal_centre_x = game.field.my_goal_x
+    rel_x = p.x - goal_centre_x if goal_centre_x >= 0 else goal_centre_x - p.x
+    sq = (_CURVE_XS - rel_x) ** 2 + (_CURVE_YS - p.y) ** 2
+    i = int(np.argmin(sq))
+    t = float(_CURVE_TS[i])
+    if 0 < i < len(_CURVE_TS) - 1:
+        curvature = sq[i - 1] - 2 * sq[i] + sq[i + 1]
+        if curvature > 0:
+            t += 0.5 * _CURVE_STEP * (sq[i - 1] - sq[i + 1]) / curvature
     return clamp_to_parametric(t)
 
 
-def find_likely_enemy_shooter(enemy_robots: Dict[int, Robot], ball: Ball) -> List[Robot]:
-    unique_shooters: Dict[int, Robot] = {}
-
-    for robot_id, robot in enemy_robots.items():
-        if np.linalg.norm(robot.p - ball.p.to_2d()) < 0.2:
-            unique_shooters[robot_id] = robot
+def find_likely_enemy_shooter(
+    enemy_robots: Dict[int, Robot], ball: Ball, proximity_lookup: Optional[ProximityLookup] = None
+) -> List[Robot]:
+    """Enemy robots within 0.2m of the ball, nearest first.
 
-    return list(unique_shooters.values())
+    Pass ``game.proximity_lookup`` to reuse the frame's lookup instead of building one for this query.
+    """
+    if proximity_lookup is None:
+        proximity_lookup = ProximityLookup(None, enemy_robots, ball)
+    nearby = proximity_lookup.within_radius_of_ball(0.2, TeamType.ENEMY)
+    return [enemy_robots[key.id] for key, _ in nearby]
 
 
 def step_curve(t: float, direction: int):
@@ -6,6 +6,7 @@ from utama_core.config.physical_constants import ROBOT_RADIUS
 from utama_core.entities.data.command import RobotCommand
 from utama_core.entities.data.vector import Vector2D
 from utama_core.entities.game import Game
+from utama_core.global_utils import latency
 from utama_core.global_utils.math_utils import rotate_vector
 from utama_core.motion_planning.src.common.motion_controller import MotionController
 
@@ -24,12 +25,13 @@ def move(
 
     robot = game.friendly_robots[robot_id]
 
-    global_velocity, angular_vel = motion_controller.calculate(
-        game=game,
-        robot_id=robot_id,
-        target_pos=target_coords,
-        target_oren=target_oren,
-    )
+    with latency.span("motion"):
+        global_velocity, angular_vel = motion_controller.calculate(
+            game=game,
+            robot_id=robot_id,
+            target_pos=target_coords,
+            target_oren=target_oren,
+        )
 
     forward_vel, left_vel = rotate_vector(global_velocity.x, global_velocity.y, robot.orientation)
 
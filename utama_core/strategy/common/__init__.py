@@ -4,3 +4,4 @@ from utama_core.strategy.common.abstract_strategy import (
     SpaceRequirements,
 )
 from utama_core.strategy.common.base_blackboard import BaseBlackboard
+from utama_core.strategy.common.tick_cache import CachePolicy
@@ -4,11 +4,16 @@ import py_trees
 
 from utama_core.config.settings import BLACKBOARD_NAMESPACE_MAP
 from utama_core.strategy.common.base_blackboard import BaseBlackboard
+from utama_core.strategy.common.tick_cache import CachePolicy
 
 
 class AbstractBehaviour(py_trees.behaviour.Behaviour):
     """An abstract base class for all behaviours in the strategy."""
 
+    # Set on expensive behaviours (e.g. role assignment) to skip update() on ticks where the policy says the result
+    # cannot have changed; the blackboard outputs of the last evaluation are restored instead. See CachePolicy.
+    cache_policy: Optional[CachePolicy] = None
+
     def __init__(self, name: Optional[str] = None):
         if name is None:
             name = self.__class__.__name__
@@ -1,7 +1,9 @@
 import logging
 from abc import ABC, abstractmethod
+from contextlib import nullcontext
 from dataclasses import dataclass
-from typing import Optional, cast
+from types import MethodType
+from typing import TYPE_CHECKING, Callable, Dict, Optional, Tuple, cast
 
 import py_trees
 import pydot
@@ -12,20 +14,27 @@ from utama_core.config.settings import BLACKBOARD_NAMESPACE_MAP, RENDER_BASE_PAT
 from utama_core.entities.data.command import RobotCommand
 from utama_core.entities.game import Game
 from utama_core.entities.game.field import Field, FieldBounds
+from utama_core.global_utils import latency
 from utama_core.global_utils.math_utils import (
     assert_contains,
     assert_valid_bounding_box,
 )
 from utama_core.motion_planning.src.common.motion_controller import MotionController
-from utama_core.rsoccer_simulator.src.ssl.ssl_gym_base import SSLBaseEnv
 from utama_core.skills.src.utils.move_utils import empty_command
+from utama_core.strategy.common.abstract_behaviour import AbstractBehaviour
 from utama_core.strategy.common.base_blackboard import BaseBlackboard
+from utama_core.strategy.common.tick_cache import NodeCache
 from utama_core.team_controller.src.controllers.common.robot_controller_abstract import (
     AbstractRobotController,
 )
 
+if TYPE_CHECKING:
+    from utama_core.rsoccer_simulator.src.ssl.ssl_gym_base import SSLBaseEnv
+
 logger = logging.getLogger(__name__)
 
+_NO_SPAN = nullcontext()
+
 
 def _prune_base_blackboard_elements(graph: pydot.Dot) -> None:
     """Strip BaseBlackboard artifacts from the rendered DOT graph."""
@@ -84,6 +93,9 @@ class AbstractStrategy(ABC):
     # if True, and strat_runner exp_ball is False, strat_runner will raise an error and not run the strategy
     # if False, but ball exists, we will just rock on!
     exp_ball: bool = True
+    # whether the strategy can run a cheaper tick (e.g. skip expensive planning) after the control loop overran.
+    # if True, `degraded` (also on the blackboard) is set for the tick following an overrun.
+    supports_degraded_mode: bool = False
     #################################################
 
     def __init__(self):
@@ -105,6 +117,12 @@ class AbstractStrategy(ABC):
         ### These attributes are set by the StrategyRunner before the strategy is run. ###
         self.robot_controller: AbstractRobotController = None
         self.blackboard: BaseBlackboard = None
+        self.degraded: bool = False
+        # Time every behaviour's update as a "bt.<name>" latency stage. Must be set before setup_behaviour_tree.
+        self.profile_nodes: bool = False
+        self._tick = 0
+        self._node_caches: list[Tuple[str, NodeCache]] = []
+        self._latency_side = latency.MY_SIDE
 
     ### START OF FUNCTIONS TO BE IMPLEMENTED BY YOUR STRATEGY ###
 
@@ -204,6 +222,7 @@ class AbstractStrategy(ABC):
         Setups the blackboard based on if is_opp_strat.
         """
         self.blackboard = self._setup_blackboard(is_opp_strat)
+        self._latency_side = latency.OPP_SIDE if is_opp_strat else latency.MY_SIDE
 
     def setup_behaviour_tree(self, is_opp_strat: bool):
         """
@@ -212,8 +231,9 @@ class AbstractStrategy(ABC):
         Setups the behaviour tree based on if is_opp_strat.
         """
         self.behaviour_tree.setup(is_opp_strat=is_opp_strat)
+        self._instrument_behaviours()
 
-    def load_rsim_env(self, env: SSLBaseEnv):
+    def load_rsim_env(self, env: "SSLBaseEnv"):
         """
         Called by StrategyRunner: Load the RSim environment into the blackboard.
         """
@@ -277,28 +297,49 @@ class AbstractStrategy(ABC):
         """
         self.blackboard.set("game", game, overwrite=True)
         self.assert_field_requirements(game)
+        # results cached against the previous game must not leak into the new one
+        for _, cache in self._node_caches:
+            cache.clear()
+
+    def set_degraded(self, previous_tick_overran: bool) -> None:
+        """
+        Called by StrategyRunner before each step. Only strategies with `supports_degraded_mode` are degraded.
+        """
+        self.degraded = previous_tick_overran and self.supports_degraded_mode
+        if self.blackboard is not None:
+            self.blackboard.degraded = self.degraded
+
+    def cache_stats(self) -> Dict[str, Tuple[int, int]]:
+        """(hits, misses) of each behaviour with a cache policy, by node name."""
+        return {name: (cache.hits, cache.misses) for name, cache in self._node_caches}
 
     def step(self):
         # start_time = time.time()
+        self._tick += 1
         game = self.blackboard.game
 
         self.blackboard.cmd_map = {robot_id: None for robot_id in game.friendly_robots}
 
-        self.behaviour_tree.tick()
+        # strategy_tick includes the "motion" spans opened by skills during the tick
+        with latency.span("strategy_tick"):
+            self.behaviour_tree.tick()
 
-        for robot_id, values in self.blackboard.cmd_map.items():
-            if values is not None:
-                self.robot_controller.add_robot_commands(values, robot_id)
+            for robot_id, values in self.blackboard.cmd_map.items():
+                if values is not None:
+                    self.robot_controller.add_robot_commands(values, robot_id)
 
-            # if the robot is not assigned a command, execute the default action
-            else:
-                if robot_id not in self.blackboard.role_map:
-                    role = Role.UNASSIGNED
+                # if the robot is not assigned a command, execute the default action
                 else:
-                    role = self.blackboard.role_map[robot_id]
-                cmd = self.execute_default_action(game, role, robot_id)
-                self.robot_controller.add_robot_commands(cmd, robot_id)
-        self.robot_controller.send_robot_commands()
+                    if robot_id not in self.blackboard.role_map:
+                        role = Role.UNASSIGNED
+                    else:
+                        role = self.blackboard.role_map[robot_id]
+                    cmd = self.execute_default_action(game, role, robot_id)
+                    self.robot_controller.add_robot_commands(cmd, robot_id)
+
+        with latency.span("send"):
+            self.robot_controller.send_robot_commands()
+        latency.get_tracker().mark_sent(self._latency_side)
 
         # end_time = time.time()
         # logger.info(
@@ -307,6 +348,55 @@ class AbstractStrategy(ABC):
         #     end_time - start_time,
         # )
 
+    def _instrument_behaviours(self):
+        """Wraps the update of every behaviour that has a cache policy or, with ``profile_nodes``, is timed."""
+        self._node_caches = []
+        for node in self.behaviour_tree.root.iterate():
+            if not isinstance(node, AbstractBehaviour):
+                continue
+            cache = None
+            if node.cache_policy is not None:
+                if node.cache_policy.outputs is None:
+                    # cmd_map is rebuilt every tick, so only the entries the node wrote are replayed
+                    output_keys = [key for key in node.blackboard.write if key.rsplit("/", 1)[-1] != "cmd_map"]
+                else:
+                    namespace = node.blackboard.namespace
+                    output_keys = [
+                        py_trees.blackboard.Blackboard.absolute_name(namespace, key)
+                        for key in node.cache_policy.outputs
+                    ]
+                cache = NodeCache(node.cache_policy, output_keys)
+                self._node_caches.append((node.name, cache))
+            if cache is not None or self.profile_nodes:
+                node.update = self._instrumented_update(node, cache)
+
+    def _instrumented_update(
+        self, node: AbstractBehaviour, cache: Optional[NodeCache]
+    ) -> Callable[[], py_trees.common.Status]:
+        update = MethodType(type(node).update, node)  # the class's update, so re-instrumenting never nests
+        stage = f"bt.{node.name}"
+        profile_nodes = self.profile_nodes
+
+        def instrumented_update() -> py_trees.common.Status:
+            with latency.span(stage) if profile_nodes else _NO_SPAN:
+                if cache is None:
+                    return update()
+
+                key = cache.policy.key(self.blackboard.game.current)
+                cmd_map = node.blackboard.cmd_map
+                status = cache.lookup(self._tick, key)
+                if status is not None:
+                    cmd_map.update(cache.commands)
+                    return status
+
+                before = dict(cmd_map)
+                status = update()
+                written = {robot_id: cmd for robot_id, cmd in cmd_map.items() if cmd is not before.get(robot_id)}
+                cache.store(self._tick, key, status, written)
+                return status
+
+        return instrumented_update
+
     def _setup_blackboard(self, is_opp_strat: bool) -> BaseBlackboard:
         """Sets up the blackboard with the necessary keys for the strategy."""
 
@@ -323,6 +413,8 @@ class AbstractStrategy(ABC):
         blackboard.register_key(key="rsim_env", access=py_trees.common.Access.WRITE)
         blackboard.rsim_env = None  # set to None by default
         blackboard.register_key(key="motion_controller", access=py_trees.common.Access.WRITE)
+        blackboard.register_key(key="degraded", access=py_trees.common.Access.WRITE)
+        blackboard.degraded = False
 
         blackboard: BaseBlackboard = cast(BaseBlackboard, blackboard)
         return blackboard
@@ -1,4 +1,4 @@
-from typing import Dict, Union
+from typing import TYPE_CHECKING, Dict, Union
 
 import py_trees
 
@@ -6,9 +6,11 @@ from utama_core.config.enums import Role, Tactic
 from utama_core.entities.data.command import RobotCommand
 from utama_core.entities.game import Game
 from utama_core.motion_planning.src.common.motion_controller import MotionController
-from utama_core.rsoccer_simulator.src.ssl.ssl_gym_base import SSLBaseEnv
 from utama_core.team_controller.src.controllers import AbstractRobotController
 
+if TYPE_CHECKING:
+    from utama_core.rsoccer_simulator.src.ssl.ssl_gym_base import SSLBaseEnv
+
 
 class BaseBlackboard(py_trees.blackboard.Client):
     @classmethod
@@ -34,7 +36,7 @@ class BaseBlackboard(py_trees.blackboard.Client):
         return self.get("motion_controller")
 
     @property
-    def rsim_env(self) -> SSLBaseEnv:
+    def rsim_env(self) -> "SSLBaseEnv":
         return self.get("rsim_env")
 
     @property
@@ -48,3 +50,8 @@ class BaseBlackboard(py_trees.blackboard.Client):
     @property
     def tactic(self) -> Tactic:
         return self.get("tactic")
+
+    @property
+    def degraded(self) -> bool:
+        """True for the tick after the control loop overran, if the strategy supports degraded mode."""
+        return self.get("degraded")
@@ -0,0 +1,99 @@
+"""Tick memoisation for expensive behaviours.
+
+A behaviour that sets ``cache_policy`` is evaluated only when its policy says the result may have changed. On the
+ticks in between its ``update`` is skipped: the blackboard outputs and ``cmd_map`` entries written by the last
+evaluation are restored, and its last status is returned.
+"""
+
+from dataclasses import dataclass
+from typing import Any, Callable, Dict, Hashable, Iterable, Optional, Tuple
+
+import py_trees
+
+from utama_core.entities.game import GameFrame
+
+
+@dataclass(frozen=True)
+class CachePolicy:
+    """When a behaviour may reuse the result of its last evaluation.
+
+    Attributes:
+        every_n_ticks (int, optional): Re-evaluate at least every N strategy ticks. On its own, the behaviour runs
+            on every Nth tick; combined with inputs, it caps how long a result is reused.
+        inputs (Tuple[str, ...]): GameFrame fields, e.g. ``("ball", "friendly_robots")``. The behaviour is
+            re-evaluated when any of them compares unequal to its value at the last evaluation.
+        input_key (Callable[[GameFrame], Hashable], optional): Re-evaluate when this key of the current frame
+            changes. Use it to ignore changes that do not matter, e.g. by rounding positions.
+        outputs (Tuple[str, ...], optional): Blackboard keys restored when the result is reused. Defaults to every
+            key the behaviour registered for writing. ``cmd_map`` entries are always restored.
+    """
+
+    every_n_ticks: Optional[int] = None
+    inputs: Tuple[str, ...] = ()
+    input_key: Optional[Callable[[GameFrame], Hashable]] = None
+    outputs: Optional[Tuple[str, ...]] = None
+
+    def __post_init__(self):
+        if self.every_n_ticks is None and not self.inputs and self.input_key is None:
+            raise ValueError("CachePolicy needs every_n_ticks, inputs or input_key.")
+        if self.every_n_ticks is not None and self.every_n_ticks < 1:
+            raise ValueError(f"every_n_ticks must be at least 1, got {self.every_n_ticks}.")
+
+    def key(self, frame: GameFrame) -> Optional[Tuple]:
+        if not self.inputs and self.input_key is None:
+            return None
+        fields = tuple(getattr(frame, name) for name in self.inputs)
+        return fields, self.input_key(frame) if self.input_key is not None else None
+
+
+class NodeCache:
+    """The last evaluated result of one behaviour.
+
+    Args:
+        policy (CachePolicy): When the result may be reused.
+        output_keys (Iterable[str]): Absolute blackboard keys holding the behaviour's outputs.
+    """
+
+    def __init__(self, policy: CachePolicy, output_keys: Iterable[str]):
+        self.policy = policy
+        self.output_keys = tuple(output_keys)
+        self.hits = 0
+        self.misses = 0
+        self.clear()
+
+    def clear(self):
+        self._status: Optional[py_trees.common.Status] = None
+        self._tick = 0
+        self._key: Optional[Tuple] = None
+        self._outputs: Dict[str, Any] = {}
+        self._commands: Dict[int, Any] = {}
+
+    def lookup(self, tick: int, key: Optional[Tuple]) -> Optional[py_trees.common.Status]:
+        """The cached status if the last result can be reused at ``tick``; outputs are restored as a side effect."""
+        if self._status is None or key != self._key:
+            return None
+        every_n_ticks = self.policy.every_n_ticks
+        if every_n_ticks is not None and tick - self._tick >= every_n_ticks:
+            return None
+        for name, value in self._outputs.items():
+            py_trees.blackboard.Blackboard.set(name, value)
+        self.hits += 1
+        return self._status
+
+    def store(
+        self,
+        tick: int,
+        key: Optional[Tuple],
+        status: py_trees.common.Status,
+        commands: Dict[int, Any],
+    ):
+        storage = py_trees.blackboard.Blackboard.storage
+        self._status, self._tick, self._key = status, tick, key
+        self._outputs = {name: storage[name] for name in self.output_keys if name in storage}
+        self._commands = commands
+        self.misses += 1
+
+    @property
+    def commands(self) -> Dict[int, Any]:
+        """``cmd_map`` entries written by the last evaluation."""
+        return self._commands
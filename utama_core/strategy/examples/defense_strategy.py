@@ -10,7 +10,7 @@ from utama_core.skills.src.block import block_attacker
 from utama_core.skills.src.defend_parameter import defend_parameter
 from utama_core.skills.src.goalkeep import goalkeep
 from utama_core.skills.src.utils.move_utils import empty_command
-from utama_core.strategy.common import AbstractBehaviour, AbstractStrategy
+from utama_core.strategy.common import AbstractBehaviour, AbstractStrategy, CachePolicy
 
 
 class FindBlockingTarget(AbstractBehaviour):
@@ -137,6 +137,9 @@ class SetRoles(AbstractBehaviour):
     """
     A behaviour that sets the roles of the robots.
 
+    The friendly robots on the field are given the roles of `ROLE_ORDER` in robot id order; any further robots are
+    left unassigned.
+
     **Blackboard Interaction:**
         - Writes:
             - `role_map` (dict): A mapping of robot IDs to their assigned roles.
@@ -144,6 +147,11 @@ class SetRoles(AbstractBehaviour):
         - `py_trees.common.Status.SUCCESS`: The role map has been successfully set.
     """
 
+    ROLE_ORDER = (Role.MIDFIELDER, Role.DEFENDER, Role.GOALKEEPER)
+
+    # Roles only need reassigning when the set of friendly robots on the field changes.
+    cache_policy = CachePolicy(input_key=lambda frame: tuple(sorted(frame.friendly_robots)))
+
     def __init__(self, wr_role_map: str = "role_map", name: Optional[str] = "SetRoles2BB"):
         super().__init__(name=name)
         self.role_map_key = wr_role_map
@@ -153,14 +161,8 @@ class SetRoles(AbstractBehaviour):
         self.blackboard.register_key(key=self.role_map_key, access=py_trees.common.Access.WRITE)
 
     def update(self) -> py_trees.common.Status:
-        self.blackboard.set(
-            self.role_map_key,
-            {
-                0: Role.MIDFIELDER,
-                1: Role.DEFENDER,
-                2: Role.GOALKEEPER,
-            },
-        )
+        robot_ids = sorted(self.blackboard.game.friendly_robots)
+        self.blackboard.set(self.role_map_key, dict(zip(robot_ids, self.ROLE_ORDER)))
         return py_trees.common.Status.SUCCESS
 
 
@@ -1,22 +1,55 @@
-from utama_core.team_controller.src.controllers.common.robot_controller_abstract import (
-    AbstractRobotController,
-)
-from utama_core.team_controller.src.controllers.common.sim_controller_abstract import (
-    AbstractSimController,
-)
-from utama_core.team_controller.src.controllers.real.real_robot_controller import (
-    RealRobotController,
-)
-from utama_core.team_controller.src.controllers.sim.grsim_controller import (
-    GRSimController,
-)
-from utama_core.team_controller.src.controllers.sim.grsim_robot_controller import (
-    GRSimRobotController,
-)
-from utama_core.team_controller.src.controllers.sim.rsim_controller import (
-    RSimController,
-)
-from utama_core.team_controller.src.controllers.sim.rsim_robot_controller import (
-    RSimPVPManager,
-    RSimRobotController,
-)
+"""Robot and simulator controllers.
+
+Each controller is imported on first access, so importing this package for the abstract base classes does not load
+the serial, gRSim network or RSim stacks of the modes that are not in use.
+"""
+
+import importlib
+from typing import TYPE_CHECKING
+
+_CONTROLLER_MODULES = {
+    "AbstractRobotController": "utama_core.team_controller.src.controllers.common.robot_controller_abstract",
+    "AbstractSimController": "utama_core.team_controller.src.controllers.common.sim_controller_abstract",
+    "RealRobotController": "utama_core.team_controller.src.controllers.real.real_robot_controller",
+    "GRSimController": "utama_core.team_controller.src.controllers.sim.grsim_controller",
+    "GRSimRobotController": "utama_core.team_controller.src.controllers.sim.grsim_robot_controller",
+    "RSimController": "utama_core.team_controller.src.controllers.sim.rsim_controller",
+    "RSimPVPManager": "utama_core.team_controller.src.controllers.sim.rsim_robot_controller",
+    "RSimRobotController": "utama_core.team_controller.src.controllers.sim.rsim_robot_controller",
+}
+
+__all__ = list(_CONTROLLER_MODULES)
+
+
+def __getattr__(name: str):
+    module = _CONTROLLER_MODULES.get(name)
+    if module is None:
+        raise AttributeError(f"module {__name__!r} has no attribute {name!r}")
+    value = getattr(importlib.import_module(module), name)
+    globals()[name] = value
+    return value
+
+
+if TYPE_CHECKING:
+    from utama_core.team_controller.src.controllers.common.robot_controller_abstract import (
+        AbstractRobotController,
+    )
+    from utama_core.team_controller.src.controllers.common.sim_controller_abstract import (
+        AbstractSimController,
+    )
+    from utama_core.team_controller.src.controllers.real.real_robot_controller import (
+        RealRobotController,
+    )
+    from utama_core.team_controller.src.controllers.sim.grsim_controller import (
+        GRSimController,
+    )
+    from utama_core.team_controller.src.controllers.sim.grsim_robot_controller import (
+        GRSimRobotController,
+    )
+    from utama_core.team_controller.src.controllers.sim.rsim_controller import (
+        RSimController,
+    )
+    from utama_core.team_controller.src.controllers.sim.rsim_robot_controller import (
+        RSimPVPManager,
+        RSimRobotController,
+    )
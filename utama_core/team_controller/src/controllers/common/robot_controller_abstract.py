@@ -53,6 +53,15 @@ class AbstractRobotController:
         """
         ...
 
+    def flush(self) -> None:
+        """Blocks until every sent command has actually been transmitted.
+
+        No-op for controllers that transmit synchronously in send_robot_commands.
+        """
+
+    def close(self) -> None:
+        """Releases the controller's connection. No-op unless the controller holds one open."""
+
     @abc.abstractmethod
     def get_robots_responses(self) -> Optional[List[RobotResponse]]:
         """Returns the robot response from the last sent commands."""
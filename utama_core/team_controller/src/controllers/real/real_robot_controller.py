@@ -17,10 +17,15 @@ from utama_core.config.settings import (
     TIMESTEP,
 )
 from utama_core.entities.data.command import RobotCommand, RobotResponse
+from utama_core.global_utils import latency
 from utama_core.skills.src.utils.move_utils import empty_command
 from utama_core.team_controller.src.controllers.common.robot_controller_abstract import (
     AbstractRobotController,
 )
+from utama_core.team_controller.src.controllers.real.serial_io import (
+    SerialIO,
+    SerialIOStats,
+)
 
 logger = logging.getLogger(__name__)
 
@@ -39,6 +44,10 @@ class KickTrackerEntry:
 class RealRobotController(AbstractRobotController):
     """Robot Controller for Real Robots.
 
+    Serial reads and writes happen on a SerialIO worker thread that owns the port: ``send_robot_commands`` hands
+    the packet over without waiting for the write, and ``get_robots_responses`` returns what the worker has
+    already parsed. Call ``close`` to write out the last packet and stop the worker.
+
     Args:
         is_team_yellow (bool): True if the team is yellow, False if the team is blue.
         n_robots (int): The number of robots in the team. Directly affects output buffer size. Default is 6.
@@ -52,72 +61,16 @@ class RealRobotController(AbstractRobotController):
         self._in_packet_size = 1  # size of the feedback packet received from the robots
         self._robots_info: List[RobotResponse] = [None] * self._n_friendly
         logger.debug(f"Serial port: {PORT} opened with baudrate: {BAUD_RATE} and timeout {TIMEOUT}")
+        self._io = SerialIO(self._serial_port, self._out_packet)
+        self._io.start()
         self._assigned_mapping = {}  # mapping of robot_id to index in the out_packet
 
         # track last kick time for each robot to transmit kick as HIGH for n timesteps after command
         self._kicker_tracker: Dict[int, KickTrackerEntry] = {}
 
     def get_robots_responses(self) -> List[RobotResponse]:
-        HEADER = 0xAA
-        FOOTER = 0x55
-        MAX_PAYLOAD_LEN = 32  # Sanity limit to prevent buffer bloat
-        MIN_PAYLOAD_LEN = 1  # We expect at least 1 byte for ball status
-
-        if not hasattr(self, "_buffer"):
-            self._buffer = bytearray()
-
-        # 1. Non-blocking read: Only read if bytes are actually waiting
-        bytes_available = self._serial_port.in_waiting
-        if bytes_available > 0:
-            self._buffer.extend(self._serial_port.read(bytes_available))
-
-        responses = []
-
-        while True:
-            # 2. Look for header
-            if len(self._buffer) < 1:
-                break
-
-            if self._buffer[0] != HEADER:
-                self._buffer.pop(0)
-                continue
-
-            # 3. Need at least header + id + length
-            if len(self._buffer) < 3:
-                break
-
-            robot_id = self._buffer[1]
-            length = self._buffer[2]
-
-            # 4. Validate length byte before proceeding
-            if length < MIN_PAYLOAD_LEN or length > MAX_PAYLOAD_LEN:
-                # Malformed length; pop the header to resync
-                self._buffer.pop(0)
-                continue
-
-            packet_len = 1 + 1 + 1 + length + 1  # header + id + len + data + footer
-
-            # 5. Wait for the full packet to arrive
-            if len(self._buffer) < packet_len:
-                break
-
-            # 6. Validate footer
-            if self._buffer[packet_len - 1] != FOOTER:
-                # Corrupted packet or offset mismatch; resync
-                self._buffer.pop(0)
-                continue
-
-            # 7. Extract packet data safely
-            data = self._buffer[3 : 3 + length]
-
-            # Guard against IndexError just in case, though validated by 'length' check
-            if len(data) >= 1:
-                responses.append(RobotResponse(robot_id, has_ball=(data[0] & 0x01) != 0))
-
-            # 8. Clear parsed packet from buffer
-            del self._buffer[:packet_len]
-
-        return responses
+        """The newest response of each robot received since the previous call."""
+        return self._io.latest_responses()
 
     def send_robot_commands(self) -> None:
         """Sends the robot commands to the appropriate team (yellow or blue)."""
@@ -128,7 +81,9 @@ class RealRobotController(AbstractRobotController):
             warnings.warn(
                 f"Only {len(self._assigned_mapping)} out of {self._n_friendly} robots have been assigned commands. Sending empty commands for unassigned robots."
             )
-        self._serial_port.write(self._out_packet)
+        # The worker writes this packet; we get back a cleared buffer for the next tick.
+        with latency.span("serial_submit"):
+            self._out_packet = self._io.submit(self._out_packet)
 
         ### update kick and chip trackers. We persist the kick/chip command for KICKER_PERSIST_TIMESTEPS
         ### this feature is to combat packet loss and to ensure the robot does not kick within its cooldown period
@@ -145,9 +100,18 @@ class RealRobotController(AbstractRobotController):
                 # remove kicker tracker entry once cooldown is over
                 del self._kicker_tracker[robot_id]
 
-        self._out_packet = self._empty_command()  # flush the out_packet
         self._assigned_mapping = {}  # reset assigned mapping
 
+    def flush(self) -> None:
+        """Blocks until every sent packet has been written to the serial port."""
+        if not self._io.flush():
+            warnings.warn("Timed out waiting for the serial port to accept the last command packet.")
+
+    def close(self) -> None:
+        """Writes out the last packet, stops the serial worker and closes the port."""
+        self._io.close()
+        self._serial_port.close()
+
     def add_robot_commands(
         self,
         robot_commands: Union[RobotCommand, Dict[int, RobotCommand]],
@@ -372,6 +336,11 @@ class RealRobotController(AbstractRobotController):
     def in_packet_size(self) -> int:
         return self._in_packet_size
 
+    @property
+    def io_stats(self) -> SerialIOStats:
+        """Framing-error, throughput and write-latency counters of the serial worker."""
+        return self._io.stats
+
 
 if __name__ == "__main__":
     robot_controller = RealRobotController(is_team_yellow=True, n_friendly=1)
@@ -391,6 +360,8 @@ if __name__ == "__main__":
         robot_controller.add_robot_commands(empty_command(), 0)
         robot_controller.send_robot_commands()
         time.sleep(TIMESTEP)
+    robot_controller.close()
+    print(robot_controller.io_stats.summary())
 
     # print(list(robot_controller.out_packet))
     # binary_representation = [f"{byte:08b}" for byte in robot_controller.out_packet]
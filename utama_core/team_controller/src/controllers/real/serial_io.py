@@ -0,0 +1,339 @@
+"""Serial I/O worker for the real robot controller.
+
+The worker thread owns the serial port so the control loop never blocks on it:
+
+- Incoming bytes are read into a fixed receive buffer and framed in place through a memoryview. Resyncing on
+  corrupt data jumps straight to the next header byte instead of discarding one byte at a time.
+- The latest RobotResponse of each robot is published in a per-robot slot holding ``(sequence, response)``.
+  Each slot is replaced by a single reference assignment, so the control thread can read without a lock and
+  picks up only the responses that arrived since its last read.
+- Outgoing command packets rotate through three preallocated buffers: the control thread fills one, at most one
+  waits to be written and at most one is being written. Submitting returns a cleared buffer for the next tick,
+  and a packet the worker has not started on yet is replaced by the newer one.
+
+Frame format of a robot response: ``0xAA | robot_id | length | payload[length] | 0x55``.
+"""
+
+import logging
+import threading
+import time
+from dataclasses import dataclass, field
+from typing import Callable, List, Optional, Tuple
+
+from utama_core.entities.data.command import RobotResponse
+from utama_core.global_utils import latency
+from utama_core.global_utils.latency import StageHistogram
+
+logger = logging.getLogger(__name__)
+
+HEADER = 0xAA
+FOOTER = 0x55
+MIN_PAYLOAD_LEN = 1  # We expect at least 1 byte for ball status
+MAX_PAYLOAD_LEN = 32  # Sanity limit to prevent buffer bloat
+FRAME_OVERHEAD = 4  # header + id + length + footer
+
+RECEIVE_BUFFER_SIZE = 4096
+POLL_INTERVAL = 0.001  # seconds between reads when no packet is waiting to be written
+_N_ROBOT_SLOTS = 256  # robot ids are a single byte on the wire
+
+
+@dataclass
+class SerialIOStats:
+    """Counters kept by the serial worker. Read them from any thread; only the worker (and submit) writes them."""
+
+    bytes_read: int = 0
+    frames: int = 0
+    framing_errors: int = 0  # bad length bytes, bad footers and runs of bytes before a header
+    bytes_discarded: int = 0
+    packets_written: int = 0
+    packets_superseded: int = 0  # replaced by a newer packet before the worker got to write them
+    read_errors: int = 0
+    write_errors: int = 0
+    write_latency: StageHistogram = field(default_factory=lambda: StageHistogram(600))
+
+    def summary(self) -> dict:
+        p50, p99, worst = self.write_latency.percentiles()
+        return {
+            "bytes_read": self.bytes_read,
+            "frames": self.frames,
+            "framing_errors": self.framing_errors,
+            "bytes_discarded": self.bytes_discarded,
+            "packets_written": self.packets_written,
+            "packets_superseded": self.packets_superseded,
+            "read_errors": self.read_errors,
+            "write_errors": self.write_errors,
+            "write_latency_ms": (p50 * 1e3, p99 * 1e3, worst * 1e3),
+        }
+
+
+class FrameParser:
+    """Frames robot responses out of a fixed receive buffer without copying them.
+
+    Bytes are appended at the end of the unread region (``reserve`` + ``commit``, or ``feed``) and ``parse``
+    consumes complete frames from its start. The unread remainder, at most one incomplete frame, is moved back
+    to the front of the buffer only when there is not enough room behind it.
+    """
+
+    def __init__(self, stats: SerialIOStats, capacity: int = RECEIVE_BUFFER_SIZE):
+        self._buffer = bytearray(capacity)
+        self._view = memoryview(self._buffer)
+        self._start = 0
+        self._end = 0
+        self._stats = stats
+
+    @property
+    def capacity(self) -> int:
+        return len(self._buffer)
+
+    @property
+    def unread(self) -> int:
+        return self._end - self._start
+
+    def reserve(self, n: int) -> memoryview:
+        """Writable view of up to ``n`` bytes behind the unread data; pass the count filled to ``commit``."""
+        if self._end + n > self.capacity and self._start > 0:
+            unread = self.unread
+            self._view[:unread] = self._view[self._start : self._end]
+            self._start, self._end = 0, unread
+        return self._view[self._end : min(self._end + n, self.capacity)]
+
+    def commit(self, n: int):
+        self._end += n
+        self._stats.bytes_read += n
+
+    def feed(self, data: bytes):
+        """Copies ``data`` into the buffer; for sources without ``readinto``."""
+        view = memoryview(data)
+        while view:
+            target = self.reserve(len(view))
+            if not target:
+                # Only reachable if the buffer holds a full buffer's worth of unparsed bytes.
+                self._discard(self.unread)
+                continue
+            target[:] = view[: len(target)]
+            self.commit(len(target))
+            view = view[len(target) :]
+
+    def _discard(self, n: int):
+        self._start += n
+        self._stats.bytes_discarded += n
+
+    def parse(self, on_frame: Callable[[int, memoryview], None]) -> int:
+        """Calls ``on_frame(robot_id, payload)`` for every complete frame and returns how many there were.
+
+        ``payload`` is a view into the receive buffer and is only valid during the call.
+        """
+        buffer, view, stats = self._buffer, self._view, self._stats
+        start, end = self._start, self._end
+        n_frames = 0
+
+        while start < end:
+            # 1. Jump to the next header
+            if buffer[start] != HEADER:
+                header = buffer.find(HEADER, start, end)
+                skipped = (header if header >= 0 else end) - start
+                stats.framing_errors += 1
+                stats.bytes_discarded += skipped
+                start += skipped
+                continue
+
+            # 2. Need at least header + id + length
+            if end - start < 3:
+                break
+            length = buffer[start + 2]
+
+            # 3. Validate length byte; on a malformed length drop the header to resync
+            if length < MIN_PAYLOAD_LEN or length > MAX_PAYLOAD_LEN:
+                stats.framing_errors += 1
+                stats.bytes_discarded += 1
+                start += 1
+                continue
+
+            # 4. Wait for the full frame to arrive
+            frame_len = length + FRAME_OVERHEAD
+            if end - start < frame_len:
+                break
+
+            # 5. Validate footer; on a corrupted frame or offset mismatch resync
+            if buffer[start + frame_len - 1] != FOOTER:
+                stats.framing_errors += 1
+                stats.bytes_discarded += 1
+                start += 1
+                continue
+
+            on_frame(buffer[start + 1], view[start + 3 : start + 3 + length])
+            n_frames += 1
+            start += frame_len
+
+        if start == end:
+            start = end = 0
+        self._start, self._end = start, end
+        stats.frames += n_frames
+        return n_frames
+
+
+class SerialIO:
+    """Owns a serial port on a background thread: writes submitted command packets and parses responses.
+
+    Args:
+        port: An open ``serial.Serial`` (anything with ``in_waiting``, ``read`` and ``write``).
+        empty_packet (bytearray): The packet with no commands; fixes the packet size and is copied into every
+            buffer handed back by ``submit``.
+        poll_interval (float): Seconds the worker waits for a packet before checking for incoming bytes again.
+
+    ``start`` launches the worker. Without it, ``poll`` performs one write-and-read step on the calling thread.
+    """
+
+    def __init__(self, port, empty_packet: bytearray, poll_interval: float = POLL_INTERVAL):
+        self._port = port
+        self._readinto = getattr(port, "readinto", None)
+        self._empty_packet = bytes(empty_packet)
+        self._poll_interval = poll_interval
+        self.stats = SerialIOStats()
+        self._parser = FrameParser(self.stats)
+
+        # Outgoing packets; everything below is guarded by _cond.
+        self._cond = threading.Condition()
+        self._free: List[bytearray] = [bytearray(self._empty_packet) for _ in range(2)]
+        self._pending: Optional[bytearray] = None
+        self._in_flight: Optional[bytearray] = None
+        self._running = False
+        self._thread: Optional[threading.Thread] = None
+
+        # Incoming responses. Slots are written by the worker and read by the control thread.
+        self._slots: List[Optional[Tuple[int, RobotResponse]]] = [None] * _N_ROBOT_SLOTS
+        self._seen_ids: Tuple[int, ...] = ()
+        self._sequence = 0
+        self._consumed = [0] * _N_ROBOT_SLOTS  # control thread only
+
+    # ------------------------------------------------------------------
+    # Control-thread API
+    # ------------------------------------------------------------------
+
+    def start(self):
+        with self._cond:
+            if self._running:
+                return
+            self._running = True
+        self._thread = threading.Thread(target=self._run, name="SerialIO", daemon=True)
+        self._thread.start()
+
+    def submit(self, packet: bytearray) -> bytearray:
+        """Queues ``packet`` for writing and returns a cleared buffer to fill for the next packet."""
+        with self._cond:
+            if self._pending is not None:
+                spare = self._pending
+                self.stats.packets_superseded += 1
+            else:
+                spare = self._free.pop()
+            self._pending = packet
+            self._cond.notify_all()
+        spare[:] = self._empty_packet
+        return spare
+
+    def latest_responses(self) -> List[RobotResponse]:
+        """The newest response of every robot that has reported since the previous call."""
+        responses = []
+        slots, consumed = self._slots, self._consumed
+        for robot_id in self._seen_ids:
+            sequence, response = slots[robot_id]
+            if sequence > consumed[robot_id]:
+                consumed[robot_id] = sequence
+                responses.append(response)
+        return responses
+
+    def flush(self, timeout: float = 0.5) -> bool:
+        """Waits until every submitted packet has been written. Returns False on timeout."""
+        if not self._running:
+            while self._pending is not None:
+                self.poll()
+            return True
+        with self._cond:
+            return self._cond.wait_for(lambda: self._pending is None and self._in_flight is None, timeout)
+
+    def close(self, timeout: float = 0.5):
+        """Writes any pending packet, then stops the worker."""
+        self.flush(timeout)
+        with self._cond:
+            self._running = False
+            self._cond.notify_all()
+        if self._thread is not None:
+            self._thread.join(timeout)
+            self._thread = None
+
+    def poll(self):
+        """One worker step on the calling thread: write the pending packet, then parse whatever has arrived."""
+        with self._cond:
+            packet = self._take_pending()
+        self._service(packet)
+
+    # ------------------------------------------------------------------
+    # Worker
+    # ------------------------------------------------------------------
+
+    def _run(self):
+        while True:
+            with self._cond:
+                if self._pending is None and self._running:
+                    self._cond.wait(self._poll_interval)
+                if not self._running and self._pending is None:
+                    return
+                packet = self._take_pending()
+            self._service(packet)
+
+    def _take_pending(self) -> Optional[bytearray]:
+        packet, self._pending = self._pending, None
+        self._in_flight = packet
+        return packet
+
+    def _service(self, packet: Optional[bytearray]):
+        if packet is not None:
+            self._write(packet)
+            with self._cond:
+                self._in_flight = None
+                self._free.append(packet)
+                self._cond.notify_all()
+        self._read()
+
+    def _write(self, packet: bytearray):
+        start = time.perf_counter()
+        try:
+            self._port.write(packet)
+        except Exception as e:
+            self.stats.write_errors += 1
+            self._log_error("write", self.stats.write_errors, e)
+            return
+        elapsed = time.perf_counter() - start
+        self.stats.packets_written += 1
+        self.stats.write_latency.add(elapsed)
+        latency.get_tracker().add("serial_write", elapsed)
+
+    def _read(self):
+        try:
+            n = self._port.in_waiting
+            if n <= 0:
+                return
+            if self._readinto is not None:
+                target = self._parser.reserve(n)
+                self._parser.commit(self._readinto(target) or 0)
+            else:
+                self._parser.feed(self._port.read(n))
+        except Exception as e:
+            self.stats.read_errors += 1
+            self._log_error("read", self.stats.read_errors, e)
+            return
+        self._parser.parse(self._on_frame)
+
+    def _on_frame(self, robot_id: int, payload: memoryview):
+        self._sequence += 1
+        is_new = self._slots[robot_id] is None
+        self._slots[robot_id] = (self._sequence, RobotResponse(robot_id, has_ball=(payload[0] & 0x01) != 0))
+        if is_new:
+            # Publish the id only once its slot is filled, so readers never see an empty slot.
+            self._seen_ids = self._seen_ids + (robot_id,)
+
+    @staticmethod
+    def _log_error(operation: str, count: int, error: Exception):
+        # First failure and then every 100th, so an unplugged cable does not flood the log at 1 kHz.
+        if count == 1 or count % 100 == 0:
+            logger.warning("Serial %s failed (%d so far): %s", operation, count, error)
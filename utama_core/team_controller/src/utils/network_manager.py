@@ -1,6 +1,6 @@
 import logging
 import socket
-from typing import Optional, Tuple
+from typing import List, Optional, Tuple
 
 from utama_core.team_controller.src.utils import network_utils
 
@@ -13,12 +13,17 @@ class NetworkManager:
     Args:
         address (Tuple[str, int]): The IP address and port to connect or bind to.
         bind_socket (bool): If True, binds the socket to the specified address for receiving data.
+        max_batch (int): Maximum number of datagrams returned by one receive_batch call.
     """
 
-    def __init__(self, address: Tuple[str, int], bind_socket: bool = False):
+    MAX_DATAGRAM_SIZE = 8192
+
+    def __init__(self, address: Tuple[str, int], bind_socket: bool = False, max_batch: int = 16):
         # Initialize the NetworkManager and set up the socket.
         self.address = address
         self.sock = network_utils.setup_socket(socket.socket(socket.AF_INET, socket.SOCK_DGRAM), address, bind_socket)
+        # Receive buffers for receive_batch are allocated once and reused for every call.
+        self._batch_buffers = [memoryview(bytearray(self.MAX_DATAGRAM_SIZE)) for _ in range(max_batch)]
 
     def send_command(self, command: object, is_sim_robot_cmd: bool = False) -> None:
         """Sends a command to the server at the specified address.
@@ -43,6 +48,15 @@ class NetworkManager:
         # Receive data from the server.
         return network_utils.receive_data(self.sock)
 
+    def receive_batch(self) -> List[memoryview]:
+        """Receives all datagrams queued on the socket in one go.
+
+        Returns:
+            List[memoryview]: Zero-copy views of the received datagrams, oldest first. They are overwritten by the
+            next call, so parse them before calling again. Empty if nothing arrived before the socket timeout.
+        """
+        return network_utils.receive_batch(self.sock, self._batch_buffers)
+
     def close(self) -> None:
         """Closes the socket connection safely.
 
@@ -1,7 +1,7 @@
 import logging
 import socket
 import struct
-from typing import Optional, Tuple
+from typing import List, Optional, Tuple
 
 from utama_core.config.settings import LOCAL_HOST, MULTICAST_GROUP, TIMESTEP
 
@@ -100,6 +100,46 @@ def receive_data(sock: socket.socket) -> Optional[bytes]:
         return None
 
 
+# MSG_DONTWAIT is not available on every platform; without it the drain reads block for the socket timeout,
+# so receive_batch falls back to a single datagram per call.
+_DONTWAIT = getattr(socket, "MSG_DONTWAIT", None)
+
+
+def receive_batch(sock: socket.socket, buffers: List[memoryview]) -> List[memoryview]:
+    """Receives every datagram already queued on the socket, up to ``len(buffers)``, without copying.
+
+    Args:
+        sock (socket.socket): The socket from which to receive data.
+        buffers (List[memoryview]): Preallocated receive buffers, one per datagram.
+
+    Returns:
+        List[memoryview]: Slices of ``buffers`` holding the received datagrams, oldest first. Empty if the first
+        read timed out or failed. The slices are only valid until the buffers are reused.
+
+    Python has no ``recvmmsg``; this emulates it by blocking (with the socket timeout) for the first datagram and
+    then draining whatever else is queued with non-blocking ``recv_into`` calls.
+    """
+    received: List[memoryview] = []
+    try:
+        n = sock.recv_into(buffers[0])
+        received.append(buffers[0][:n])
+        if _DONTWAIT is None:
+            return received
+        for buf in buffers[1:]:
+            n = sock.recv_into(buf, 0, _DONTWAIT)
+            received.append(buf[:n])
+    except (BlockingIOError, InterruptedError):
+        pass
+    except socket.timeout:
+        if not received:
+            logger.warning("Socket timed out while receiving data")
+    except socket.error as e:
+        logger.error("Socket error occurred while receiving data: %s", e)
+    except Exception as e:
+        logger.exception("Unexpected error receiving data: %s", e)
+    return received
+
+
 def send_command(
     send_sock: socket.socket,
     address: Tuple[str, int],
@@ -0,0 +1,173 @@
+from types import SimpleNamespace
+from unittest.mock import MagicMock
+
+import py_trees
+import pytest
+
+from utama_core.config.enums import Role
+from utama_core.config.field_params import STANDARD_FIELD_DIMS
+from utama_core.entities.game.field import Field
+from utama_core.global_utils import latency
+from utama_core.strategy.common import AbstractBehaviour, AbstractStrategy, CachePolicy
+from utama_core.strategy.examples.defense_strategy import SetRoles
+
+
+class AssignTarget(AbstractBehaviour):
+    """Writes a fresh target and a command for robot 0 on every evaluation."""
+
+    def __init__(self, policy: CachePolicy):
+        super().__init__(name="AssignTarget")
+        self.cache_policy = policy
+        self.evaluations = 0
+
+    def setup_(self):
+        self.blackboard.register_key(key="target", access=py_trees.common.Access.WRITE)
+
+    def update(self):
+        self.evaluations += 1
+        self.blackboard.set("target", self.evaluations)
+        self.blackboard.cmd_map[0] = f"cmd{self.evaluations}"
+        return py_trees.common.Status.SUCCESS
+
+
+class ReadTarget(AbstractBehaviour):
+    """Records the target it sees, then clobbers it so the next tick must get it from the cache."""
+
+    def __init__(self):
+        super().__init__(name="ReadTarget")
+        self.seen = []
+
+    def setup_(self):
+        self.blackboard.register_key(key="target", access=py_trees.common.Access.WRITE)
+
+    def update(self):
+        self.seen.append(self.blackboard.get("target"))
+        self.blackboard.set("target", None)
+        return py_trees.common.Status.SUCCESS
+
+
+class CachedStrategy(AbstractStrategy):
+    def __init__(self, policy: CachePolicy, profile_nodes: bool = False):
+        self.assign, self.read = AssignTarget(policy), ReadTarget()
+        super().__init__()
+        self.setup_strategy_blackboard(is_opp_strat=False)
+        self.profile_nodes = profile_nodes
+        self.load_robot_controller(MagicMock())
+        self.game = game_with_robots(0, 1)
+        self.load_game(self.game)
+        self.setup_behaviour_tree(is_opp_strat=False)
+
+    def create_behaviour_tree(self):
+        root = py_trees.composites.Sequence(name="Root", memory=False)
+        root.add_children([self.assign, self.read])
+        return root
+
+    def assert_exp_robots(self, n_runtime_friendly, n_runtime_enemy):
+        return True
+
+    def assert_exp_goals(self, includes_my_goal_line, includes_opp_goal_line):
+        return True
+
+    def get_min_bounding_req(self):
+        return None
+
+    def sent_commands(self):
+        return [c.args[0] for c in self.robot_controller.add_robot_commands.call_args_list if c.args[1] == 0]
+
+
+class CountingSetRoles(SetRoles):
+    def __init__(self):
+        super().__init__()
+        self.evaluations = 0
+
+    def update(self):
+        self.evaluations += 1
+        return super().update()
+
+
+class RolesStrategy(CachedStrategy):
+    def __init__(self, game):
+        self.set_roles = CountingSetRoles()
+        super().__init__(CachePolicy(every_n_ticks=1))
+        self.load_game(game)
+
+    def create_behaviour_tree(self):
+        return self.set_roles
+
+
+def game_with_robots(*robot_ids):
+    robots = {robot_id: object() for robot_id in robot_ids}
+    bounds = STANDARD_FIELD_DIMS.full_field_bounds
+    field = Field(my_team_is_right=True, field_dims=STANDARD_FIELD_DIMS, field_bounds=bounds)
+    return SimpleNamespace(
+        friendly_robots=robots,
+        current=SimpleNamespace(friendly_robots=robots),
+        referee=None,
+        field=field,
+    )
+
+
+def test_every_n_ticks_reuses_blackboard_outputs_and_commands():
+    strategy = CachedStrategy(CachePolicy(every_n_ticks=3))
+    for _ in range(7):
+        strategy.step()
+
+    assert strategy.assign.evaluations == 3  # ticks 1, 4 and 7
+    assert strategy.read.seen == [1, 1, 1, 2, 2, 2, 3]
+    assert strategy.sent_commands() == ["cmd1"] * 3 + ["cmd2"] * 3 + ["cmd3"]
+    assert strategy.cache_stats() == {"AssignTarget": (4, 3)}
+
+
+def test_input_key_reevaluates_only_when_inputs_change():
+    strategy = CachedStrategy(CachePolicy(input_key=lambda frame: tuple(frame.friendly_robots)))
+    for _ in range(3):
+        strategy.step()
+    assert strategy.assign.evaluations == 1
+
+    strategy.blackboard.set("game", game_with_robots(0), overwrite=True)
+    strategy.step()
+    strategy.step()
+    assert strategy.assign.evaluations == 2
+
+    strategy.load_game(game_with_robots(0))  # a new game drops every cached result
+    strategy.step()
+    assert strategy.assign.evaluations == 3
+
+
+def test_set_roles_is_skipped_until_the_robots_on_the_field_change():
+    strategy = RolesStrategy(game_with_robots(2, 0, 1))
+    for _ in range(3):
+        strategy.step()
+    assert strategy.set_roles.evaluations == 1
+    assert strategy.blackboard.role_map == {0: Role.MIDFIELDER, 1: Role.DEFENDER, 2: Role.GOALKEEPER}
+    assert strategy.cache_stats() == {"SetRoles2BB": (2, 1)}
+
+    strategy.blackboard.set("game", game_with_robots(1, 2, 3), overwrite=True)  # robot 0 left the field
+    strategy.step()
+    assert strategy.set_roles.evaluations == 2
+    assert strategy.blackboard.role_map == {1: Role.MIDFIELDER, 2: Role.DEFENDER, 3: Role.GOALKEEPER}
+
+
+def test_profiled_nodes_are_reported_as_latency_stages():
+    tracker = latency.get_tracker()
+    tracker.reset()
+    tracker.enabled = True
+    try:
+        strategy = CachedStrategy(CachePolicy(every_n_ticks=1), profile_nodes=True)
+        tracker.begin_tick()
+        strategy.step()
+        tracker.end_tick()
+        stages = tracker.summary()
+    finally:
+        tracker.enabled = False
+        tracker.reset()
+
+    assert {"bt.AssignTarget", "bt.ReadTarget", "strategy_tick"} <= set(stages)
+    assert strategy.assign.evaluations == 1
+
+
+def test_cache_policy_needs_a_trigger():
+    with pytest.raises(ValueError):
+        CachePolicy()
+    with pytest.raises(ValueError):
+        CachePolicy(every_n_ticks=0)
@@ -0,0 +1,48 @@
+"""The regression check of the control-loop benchmark, on made-up results."""
+
+from benchmarks.bench_control_loop import (
+    MIN_BYTES,
+    MIN_NS,
+    check,
+    read_baseline,
+    write_baseline,
+)
+
+
+def _result(ns, alloc=1_000.0):
+    return {"ns_per_tick": ns, "p99_ns_per_tick": 2 * ns, "alloc_bytes_per_tick": alloc}
+
+
+BASELINE = {"proximity": _result(100_000), "motion/pid": _result(400_000, alloc=50_000.0)}
+
+
+def test_check_passes_within_tolerance():
+    results = {"proximity": _result(110_000), "motion/pid": _result(380_000, alloc=52_000.0)}
+    assert check(results, BASELINE, time_tolerance=0.25, alloc_tolerance=0.10) == []
+
+
+def test_check_reports_slower_and_allocating_components():
+    results = {"proximity": _result(200_000), "motion/pid": _result(400_000, alloc=80_000.0)}
+    failures = check(results, BASELINE, time_tolerance=0.25, alloc_tolerance=0.10)
+    assert len(failures) == 2
+    assert failures[0].startswith("proximity: 200.0 us/tick")
+    assert failures[1].startswith("motion/pid: 80000 B/tick")
+
+
+def test_check_ignores_regressions_below_the_noise_floor():
+    baseline = {"proximity": _result(1_000, alloc=100.0)}
+    results = {"proximity": _result(1_000 + MIN_NS, alloc=100.0 + MIN_BYTES)}
+    assert check(results, baseline, time_tolerance=0.25, alloc_tolerance=0.10) == []
+
+
+def test_missing_baselines(tmp_path):
+    path = tmp_path / "control_loop.json"
+    assert read_baseline(path, "noisy") is None
+
+    write_baseline(path, "clean", BASELINE)
+    assert read_baseline(path, "clean") == BASELINE
+    assert read_baseline(path, "noisy") is None
+
+    # A component without a baseline entry is not compared.
+    results = {"strategy/StartupStrategy": _result(10**9)}
+    assert check(results, BASELINE, time_tolerance=0.25, alloc_tolerance=0.10) == []
@@ -0,0 +1,104 @@
+from types import SimpleNamespace
+
+import numpy as np
+import pytest
+
+from utama_core.config.field_geometry import (
+    FieldGeometry,
+    field_geometry,
+    rect_signed_distance,
+)
+from utama_core.config.field_params import (
+    GREAT_EXHIBITION_FIELD_DIMS,
+    STANDARD_FIELD_DIMS,
+)
+from utama_core.custom_referee.geometry import RefereeGeometry
+from utama_core.entities.data.vector import Vector2D
+from utama_core.entities.game.field import Field
+from utama_core.skills.src.utils.defense_utils import (
+    calculate_defense_area,
+    to_defense_parametric,
+)
+
+
+def _field(dims, my_team_is_right=True):
+    return Field(my_team_is_right, dims, dims.full_field_bounds)
+
+
+def test_field_and_referee_share_one_instance():
+    geo = RefereeGeometry.from_field_dims(STANDARD_FIELD_DIMS)
+    assert geo.lookup is _field(STANDARD_FIELD_DIMS).geometry
+    assert geo.lookup is _field(STANDARD_FIELD_DIMS, my_team_is_right=False).geometry
+    assert _field(GREAT_EXHIBITION_FIELD_DIMS).geometry is not geo.lookup
+
+
+@pytest.mark.parametrize("dims", [STANDARD_FIELD_DIMS, GREAT_EXHIBITION_FIELD_DIMS])
+def test_membership_matches_referee_geometry(dims):
+    geo = RefereeGeometry.from_field_dims(dims)
+    lookup = geo.lookup
+    rng = np.random.default_rng(0)
+    points = rng.uniform(
+        (-dims.full_field_half_length - 0.3, -dims.full_field_half_width - 0.3),
+        (dims.full_field_half_length + 0.3, dims.full_field_half_width + 0.3),
+        size=(500, 2),
+    )
+
+    for right, scalar in ((True, geo.is_in_right_defense_area), (False, geo.is_in_left_defense_area)):
+        expected = [scalar(x, y) for x, y in points]
+        np.testing.assert_array_equal(lookup.in_defense_area(points, right=right), expected)
+        assert lookup.count_in_defense_area(points, right=right) == sum(expected)
+    np.testing.assert_array_equal(lookup.in_field(points), [geo.is_in_field(x, y) for x, y in points])
+    np.testing.assert_array_equal(lookup.in_goal(points, right=True), [geo.is_in_right_goal(x, y) for x, y in points])
+
+    # Boundaries are inclusive, as in RefereeGeometry.
+    assert lookup.in_defense_area(dims.full_field_half_length - 2 * dims.half_defense_area_depth, 0.0, right=True)
+
+
+def test_lookup_grid_is_built_on_first_use():
+    lookup = FieldGeometry(4.5, 3.0, 0.5, 0.5, 1.0, 0.18)
+    assert "boundary_distance_grid" not in vars(lookup)
+    assert lookup.in_field(0.0, 0.0)
+    assert "boundary_distance_grid" not in vars(lookup)  # membership does not need the grid
+
+    lookup.distance_to_boundary(0.0, 0.0)
+    assert "boundary_distance_grid" in vars(lookup)
+    assert lookup.boundary_distance_grid.shape == (len(lookup.ys), len(lookup.xs))
+
+    precomputed = FieldGeometry(4.5, 3.0, 0.5, 0.5, 1.0, 0.18)
+    precomputed.precompute()
+    assert "boundary_distance_grid" in vars(precomputed)
+
+
+def test_distance_table_matches_analytic_values():
+    lookup = _field(STANDARD_FIELD_DIMS).geometry
+    rng = np.random.default_rng(1)
+    points = rng.uniform((-4.9, -3.4), (4.9, 3.4), size=(500, 2))
+
+    np.testing.assert_allclose(
+        lookup.distance_to_boundary(points),
+        rect_signed_distance(points[:, 0], points[:, 1], lookup.field_rect),
+        atol=lookup.resolution,
+    )
+    assert lookup.distance_to_boundary(0.0, 0.0) == pytest.approx(-3.0)
+    assert lookup.distance_to_boundary(4.0, 0.0) == pytest.approx(-0.5)
+    # Off the grid falls back to the exact distance.
+    assert lookup.distance_to_boundary(10.0, 0.0) == pytest.approx(5.5)
+
+
+def test_nearest_infield_point():
+    lookup = field_geometry(4.5, 3.0, 0.5, 0.5, 1.0, 0.18)
+    assert lookup.nearest_infield_point(5.0, 1.0, 0.1) == (4.4, 1.0)
+    assert lookup.nearest_infield_point(-1.0, -3.5, 0.1) == (-1.0, -2.9)
+
+
+@pytest.mark.parametrize("my_team_is_right", [True, False])
+def test_defense_parametric_round_trip(my_team_is_right):
+    game = SimpleNamespace(field=_field(STANDARD_FIELD_DIMS, my_team_is_right), my_team_is_right=my_team_is_right)
+    for t in np.linspace(np.pi / 2 + 0.01, 3 * np.pi / 2 - 0.01, 37):
+        p = calculate_defense_area(game, t)
+        assert to_defense_parametric(game, p) == pytest.approx(t, abs=1e-4)
+
+    goal_x = 4.5 if my_team_is_right else -4.5
+    assert calculate_defense_area(game, np.pi).x == pytest.approx(goal_x - np.sign(goal_x) * 1.1)
+    # Clamped to the ends of the curve.
+    assert to_defense_parametric(game, Vector2D(goal_x, 5.0)) == pytest.approx(np.pi / 2, abs=1e-3)
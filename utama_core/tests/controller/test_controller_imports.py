@@ -0,0 +1,19 @@
+"""The controllers package only imports the controllers that are used."""
+
+import subprocess
+import sys
+
+
+def test_controllers_are_imported_on_first_access():
+    code = (
+        "import sys\n"
+        "import utama_core.team_controller.src.controllers as controllers\n"
+        "prefix = 'utama_core.team_controller.src.controllers.'\n"
+        "assert prefix + 'real.real_robot_controller' not in sys.modules\n"
+        "assert prefix + 'sim.grsim_controller' not in sys.modules\n"
+        "controllers.GRSimController\n"
+        "assert prefix + 'sim.grsim_controller' in sys.modules\n"
+        "assert prefix + 'real.real_robot_controller' not in sys.modules\n"
+        "assert 'pygame' not in sys.modules\n"
+    )
+    subprocess.run([sys.executable, "-c", code], check=True)
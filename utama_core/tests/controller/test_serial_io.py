@@ -0,0 +1,180 @@
+"""Tests for the SerialIO worker used by RealRobotController."""
+
+import time
+
+import pytest
+
+from utama_core.entities.data.command import RobotResponse
+from utama_core.team_controller.src.controllers.real.serial_io import (
+    FrameParser,
+    SerialIO,
+    SerialIOStats,
+)
+
+
+class FakePort:
+    """In-memory stand-in for serial.Serial: ``incoming`` is what the robots sent, ``written`` what we sent."""
+
+    def __init__(self, readinto: bool = True):
+        self.incoming = bytearray()
+        self.written: list[bytes] = []
+        self.fail_writes = False
+        if readinto:
+            self.readinto = self._readinto
+
+    @property
+    def in_waiting(self) -> int:
+        return len(self.incoming)
+
+    def read(self, n: int) -> bytes:
+        data = bytes(self.incoming[:n])
+        del self.incoming[:n]
+        return data
+
+    def _readinto(self, buffer) -> int:
+        data = self.read(len(buffer))
+        buffer[: len(data)] = data
+        return len(data)
+
+    def write(self, data) -> int:
+        if self.fail_writes:
+            raise OSError("device unplugged")
+        self.written.append(bytes(data))
+        return len(data)
+
+
+def frame(robot_id: int, has_ball: bool) -> bytes:
+    return bytes([0xAA, robot_id, 1, 0x01 if has_ball else 0x00, 0x55])
+
+
+EMPTY_PACKET = bytearray([0xAA, 0xFF] + [0] * 9 + [0x55])
+
+
+# ---------------------------------------------------------------------------
+# Framing
+# ---------------------------------------------------------------------------
+
+
+def _parse(parser: FrameParser, data: bytes) -> list[tuple[int, bytes]]:
+    frames = []
+    parser.feed(data)
+    parser.parse(lambda robot_id, payload: frames.append((robot_id, bytes(payload))))
+    return frames
+
+
+def test_parses_back_to_back_frames():
+    stats = SerialIOStats()
+    frames = _parse(FrameParser(stats), frame(0, True) + frame(3, False))
+    assert frames == [(0, b"\x01"), (3, b"\x00")]
+    assert stats.frames == 2 and stats.framing_errors == 0
+
+
+def test_resyncs_past_garbage_and_corrupt_frames():
+    stats = SerialIOStats()
+    garbage = bytes(range(1, 100))  # no header byte in here
+    bad_length = bytes([0xAA, 1, 0, 0x55])
+    bad_footer = bytes([0xAA, 2, 1, 0x01, 0x00])
+    frames = _parse(FrameParser(stats), garbage + bad_length + bad_footer + frame(4, True))
+
+    assert frames == [(4, b"\x01")]
+    assert stats.framing_errors >= 3
+    assert stats.bytes_discarded == len(garbage) + len(bad_length) + len(bad_footer)
+
+
+def test_frame_split_across_reads_and_buffer_compaction():
+    stats = SerialIOStats()
+    parser = FrameParser(stats, capacity=16)
+    frames = []
+    data = b"".join(frame(i % 6, i % 2 == 0) for i in range(40))
+    for i in range(0, len(data), 3):
+        frames += _parse(parser, data[i : i + 3])
+
+    assert [robot_id for robot_id, _ in frames] == [i % 6 for i in range(40)]
+    assert parser.unread == 0
+    assert stats.framing_errors == 0
+
+
+# ---------------------------------------------------------------------------
+# Responses and packets
+# ---------------------------------------------------------------------------
+
+
+@pytest.mark.parametrize("readinto", [True, False])
+def test_latest_response_per_robot_since_last_call(readinto):
+    port = FakePort(readinto=readinto)
+    io = SerialIO(port, EMPTY_PACKET)
+
+    port.incoming += frame(1, False) + frame(2, False) + frame(1, True)
+    io.poll()
+    assert sorted(io.latest_responses()) == [RobotResponse(1, True), RobotResponse(2, False)]
+    assert io.latest_responses() == []
+
+    port.incoming += frame(2, True)
+    io.poll()
+    assert io.latest_responses() == [RobotResponse(2, True)]
+
+
+def test_submit_rotates_preallocated_buffers():
+    port = FakePort()
+    io = SerialIO(port, EMPTY_PACKET)
+    packet = bytearray(EMPTY_PACKET)
+    seen = set()
+
+    for i in range(6):
+        seen.add(id(packet))
+        packet[1] = i
+        packet = io.submit(packet)
+        assert packet == EMPTY_PACKET  # handed back cleared
+        io.poll()
+
+    assert len(seen) <= 3
+    assert [p[1] for p in port.written] == list(range(6))
+    assert io.stats.packets_written == 6
+
+
+def test_unwritten_packet_is_superseded():
+    port = FakePort()
+    io = SerialIO(port, EMPTY_PACKET)
+    for i in range(3):
+        packet = bytearray(EMPTY_PACKET)
+        packet[1] = i
+        io.submit(packet)
+    io.flush()
+
+    assert [p[1] for p in port.written] == [2]
+    assert io.stats.packets_superseded == 2
+
+
+def test_write_errors_are_counted_not_raised():
+    port = FakePort()
+    port.fail_writes = True
+    io = SerialIO(port, EMPTY_PACKET)
+    io.submit(bytearray(EMPTY_PACKET))
+    io.poll()
+    assert io.stats.write_errors == 1 and io.stats.packets_written == 0
+
+
+def test_worker_thread_writes_and_reads():
+    port = FakePort()
+    io = SerialIO(port, EMPTY_PACKET)
+    io.start()
+    try:
+        packet = bytearray(EMPTY_PACKET)
+        for i in range(20):
+            packet[1] = i
+            packet = io.submit(packet)
+            assert io.flush(timeout=1.0)
+        port.incoming += frame(5, True)
+
+        responses = []
+        for _ in range(200):
+            responses = io.latest_responses()
+            if responses:
+                break
+            time.sleep(0.005)
+        assert responses == [RobotResponse(5, True)]
+    finally:
+        io.close()
+
+    assert [p[1] for p in port.written] == list(range(20))
+    assert io.stats.write_latency.count == 20
@@ -0,0 +1,119 @@
+"""Tests for the referee GUI's rate-limited delta stream (no HTTP server is started)."""
+
+from __future__ import annotations
+
+import json
+from dataclasses import replace
+
+import pytest
+
+from utama_core.custom_referee.custom_referee import CustomReferee
+from utama_core.custom_referee.gui import _RefereeGUIServer
+from utama_core.custom_referee.profiles.profile_loader import load_profile
+from utama_core.entities.data.vector import Vector2D, Vector3D
+from utama_core.entities.game.ball import Ball
+from utama_core.entities.game.game_frame import GameFrame
+from utama_core.entities.game.robot import Robot
+
+
+class FakeClient:
+    """Stand-in for a handler's wfile: collects the decoded SSE messages."""
+
+    def __init__(self):
+        self.messages = []
+
+    def write(self, payload: bytes):
+        assert payload.startswith(b"data: ") and payload.endswith(b"\n\n")
+        self.messages.append(json.loads(payload[len(b"data: ") : -2]))
+
+    def flush(self):
+        pass
+
+
+def _frame(x: float, ball_x: float = 0.0) -> GameFrame:
+    zv = Vector2D(0, 0)
+    zv3 = Vector3D(0, 0, 0)
+    return GameFrame(
+        ts=10.0,
+        my_team_is_yellow=True,
+        my_team_is_right=False,
+        friendly_robots={0: Robot(0, True, False, Vector2D(x, 0.5), zv, zv, 0.123456)},
+        enemy_robots={},
+        ball=Ball(Vector3D(ball_x, 0, 0), zv3, zv3),
+    )
+
+
+def _server():
+    profile = load_profile("simulation")
+    referee = CustomReferee(profile)
+    return _RefereeGUIServer(referee, profile, port=0, run_tick_loop=False), referee
+
+
+def test_full_state_then_only_changed_fields():
+    server, referee = _server()
+    client = FakeClient()
+    server._sse_clients[client] = True
+
+    server.notify(referee.step(_frame(1.0), 10.0), _frame(1.0))
+    server._publish()
+    (first,) = client.messages
+    assert first["full"] is True
+    assert first["robots"]["friendly"] == [[0, 1.0, 0.5, 0.12]]
+    assert first["ball"] == [0.0, 0.0]
+
+    server.notify(referee.step(_frame(1.5), 10.0), _frame(1.5))
+    server._publish()
+    delta = client.messages[-1]
+    assert "full" not in delta
+    assert delta["robots"]["friendly"] == [[0, 1.5, 0.5, 0.12]]
+    assert "ball" not in delta and "command" not in delta
+
+
+def test_sub_quantum_moves_and_repeats_send_nothing():
+    server, referee = _server()
+    client = FakeClient()
+    server._sse_clients[client] = True
+    server.notify(referee.step(_frame(1.0), 10.0), _frame(1.0))
+    server._publish()
+
+    server.notify(referee.step(_frame(1.001), 10.0), _frame(1.001))  # below the 1 cm quantum
+    server._publish()
+    server._publish()  # nothing new since the last publish
+    assert len(client.messages) == 1
+
+
+def test_late_client_gets_the_full_state():
+    server, referee = _server()
+    early, late = FakeClient(), FakeClient()
+    server._publish()  # no clients, no snapshot: nothing to do
+    server._sse_clients[early] = True
+    server.notify(referee.step(_frame(1.0), 10.0), _frame(1.0))
+    server._publish()
+
+    server._sse_clients[late] = True
+    server._publish()
+    assert len(early.messages) == 1
+    assert late.messages[0]["full"] is True
+    assert late.messages[0]["robots"] == early.messages[0]["robots"]
+
+
+def test_designated_position_is_quantised_like_robots():
+    server, referee = _server()
+    client = FakeClient()
+    server._sse_clients[client] = True
+    ref_data = referee.step(_frame(1.0), 10.0)
+
+    server.notify(replace(ref_data, designated_position=(1.23456, -0.98765)), _frame(1.0))
+    server._publish()
+    assert client.messages[-1]["designated"] == [1.23, -0.99]
+
+    server.notify(replace(ref_data, designated_position=(1.23111, -0.98999)), _frame(1.0))  # below the 1 cm quantum
+    server._publish()
+    assert len(client.messages) == 1
+
+
+@pytest.mark.parametrize("rate", [0, -5.0])
+def test_non_positive_display_rate_is_rejected(rate):
+    profile = load_profile("simulation")
+    with pytest.raises(ValueError, match="display_rate_hz"):
+        _RefereeGUIServer(CustomReferee(profile), profile, port=0, run_tick_loop=False, display_rate_hz=rate)
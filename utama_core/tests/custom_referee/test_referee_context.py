@@ -0,0 +1,113 @@
+"""Tests for RefereeContext and CustomReferee's incremental rule evaluation."""
+
+from __future__ import annotations
+
+import math
+
+from utama_core.config.field_params import STANDARD_FIELD_DIMS
+from utama_core.custom_referee.context import BallZone, DefenseOccupancy, RefereeContext
+from utama_core.custom_referee.custom_referee import CustomReferee
+from utama_core.custom_referee.geometry import RefereeGeometry
+from utama_core.entities.data.vector import Vector2D, Vector3D
+from utama_core.entities.game.ball import Ball
+from utama_core.entities.game.game_frame import GameFrame
+from utama_core.entities.game.robot import Robot
+from utama_core.entities.referee.referee_command import RefereeCommand
+
+GEO = RefereeGeometry.from_field_dims(STANDARD_FIELD_DIMS)
+L = GEO.half_length
+
+
+def _robot(robot_id: int, x: float, y: float, is_friendly: bool, has_ball: bool = False) -> Robot:
+    zv = Vector2D(0, 0)
+    return Robot(robot_id, is_friendly, has_ball, Vector2D(x, y), zv, zv, 0.0)
+
+
+def _frame(ball_xy, friendly=(), enemy=(), ts: float = 10.0, my_team_is_yellow: bool = True) -> GameFrame:
+    zv = Vector3D(0, 0, 0)
+    ball = Ball(Vector3D(ball_xy[0], ball_xy[1], 0), zv, zv) if ball_xy is not None else None
+    return GameFrame(
+        ts=ts,
+        my_team_is_yellow=my_team_is_yellow,
+        my_team_is_right=False,
+        friendly_robots={i: _robot(i, x, y, True) for i, (x, y) in enumerate(friendly)},
+        enemy_robots={i: _robot(i, x, y, False) for i, (x, y) in enumerate(enemy)},
+        ball=ball,
+    )
+
+
+def test_ball_zone():
+    def zone(x, y):
+        return RefereeContext(_frame((x, y)), GEO, RefereeCommand.NORMAL_START).ball_zone
+
+    assert zone(0.0, 0.0) is BallZone.IN_FIELD
+    assert zone(L + 0.05, 0.0) is BallZone.RIGHT_GOAL
+    assert zone(-L - 0.05, 0.0) is BallZone.LEFT_GOAL
+    assert zone(0.0, GEO.half_width + 0.1) is BallZone.OUT
+    assert RefereeContext(_frame(None), GEO, RefereeCommand.STOP).ball_zone is BallZone.NONE
+
+
+def test_defense_occupancy_by_colour():
+    # my_team_is_right=False and yellow friendly: yellow defends the left area.
+    left, right = (-L + 0.1, 0.0), (L - 0.1, 0.0)
+    frame = _frame((0, 0), friendly=[left, left, right], enemy=[right, (0, 0)])
+    context = RefereeContext(frame, GEO, RefereeCommand.NORMAL_START)
+    assert context.defense_occupancy == DefenseOccupancy(2, 0, 1, 1)
+
+    # Same field seen by blue (my_team_is_right=False): yellow now defends the right area.
+    frame = _frame((0, 0), friendly=[left, (0, 0)], enemy=[right, right, left], my_team_is_yellow=False)
+    context = RefereeContext(frame, GEO, RefereeCommand.NORMAL_START)
+    assert context.defense_occupancy == DefenseOccupancy(2, 0, 1, 1)
+
+
+def test_ball_distances_are_shared_and_empty_teams_are_far():
+    frame = _frame((1.0, 0.0), friendly=[(1.0, 0.3), (4.0, 0.0)])
+    context = RefereeContext(frame, GEO, RefereeCommand.STOP)
+    assert context.ball_distances(True) is context.ball_distances(True)
+    assert context.closest_to_ball(True) == 0.3
+    assert context.closest_to_ball(False) == math.inf
+    assert context.closest_robot_to_ball == (True, 0.3)
+    assert context.count_within(True, 0.0, 0.0, 1.5) == 1
+
+
+def _scripted_frames():
+    """Play in the field, a defender too many, then the ball going out and play in the field again."""
+    frames = []
+    for i in range(40):
+        ts = 10.0 + i * 0.1
+        if i < 10:
+            frames.append(_frame((0.1 * i, 0.0), friendly=[(0.5, 0.5)], enemy=[(-0.5, 0.5)], ts=ts))
+        elif i < 20:
+            crowd = [(-L + 0.1, 0.0), (-L + 0.2, 0.1)]
+            frames.append(_frame((1.0, 0.0), friendly=crowd, enemy=[(1.0, 0.1)], ts=ts))
+        elif i < 25:
+            frames.append(_frame((0.0, GEO.half_width + 0.2), friendly=[(0.0, 0.0)], ts=ts))
+        else:
+            frames.append(_frame((0.0, 0.0), friendly=[(0.2, 0.0)], enemy=[(3.0, 0.0)], ts=ts))
+    return frames
+
+
+def test_incremental_mode_matches_full_evaluation_and_skips_unchanged_rules():
+    full = CustomReferee.from_profile_name("simulation")
+    incremental = CustomReferee.from_profile_name("simulation", incremental=True)
+    evaluations = {"n": 0}
+    for rule in incremental._rules:
+        rule.evaluate = _counting(rule.evaluate, evaluations)
+
+    for referee in (full, incremental):
+        referee.set_command(RefereeCommand.NORMAL_START, timestamp=0.0)
+
+    for frame in _scripted_frames():
+        expected = full.step(frame, frame.ts)
+        actual = incremental.step(frame, frame.ts)
+        assert actual == expected, f"ts {frame.ts}"
+
+    assert evaluations["n"] < 40 * len(incremental._rules) / 2
+
+
+def _counting(evaluate, counter):
+    def wrapped(context):
+        counter["n"] += 1
+        return evaluate(context)
+
+    return wrapped
@@ -0,0 +1,105 @@
+import numpy as np
+
+from utama_core.entities.data.object import ObjectKey, ObjectType, TeamType
+from utama_core.entities.data.vector import Vector2D, Vector3D
+from utama_core.entities.game.ball import Ball
+from utama_core.entities.game.game_frame import GameFrame
+from utama_core.entities.game.game_history import AttributeType, GameHistory
+from utama_core.entities.game.robot import Robot
+
+BALL_KEY = ObjectKey(TeamType.NEUTRAL, ObjectType.BALL, 0)
+ROBOT_KEY = ObjectKey(TeamType.FRIENDLY, ObjectType.ROBOT, 2)
+
+
+def _frame(ts: float, with_robot: bool = True) -> GameFrame:
+    robots = {}
+    if with_robot:
+        robots[2] = Robot(
+            id=2,
+            is_friendly=True,
+            has_ball=False,
+            p=Vector2D(ts, -ts),
+            v=Vector2D(1, -1),
+            a=Vector2D(0, 0),
+            orientation=0,
+        )
+    return GameFrame(
+        ts=ts,
+        my_team_is_yellow=True,
+        my_team_is_right=True,
+        friendly_robots=robots,
+        enemy_robots={},
+        ball=Ball(Vector3D(ts, ts, ts), Vector3D(0, 0, 0), Vector3D(0, 0, 0)),
+    )
+
+
+def test_series_wraps_around_ring_buffer():
+    history = GameHistory(5)
+    for i in range(12):
+        history.add_game_frame(_frame(float(i)))
+
+    ts, positions = history.get_historical_attribute_series(BALL_KEY, AttributeType.POSITION, 3)
+    np.testing.assert_array_equal(ts, [9.0, 10.0, 11.0])
+    np.testing.assert_array_equal(positions, [[9, 9, 9], [10, 10, 10], [11, 11, 11]])
+
+    ts, positions = history.get_historical_attribute_series(BALL_KEY, AttributeType.POSITION, 100)
+    np.testing.assert_array_equal(ts, [7.0, 8.0, 9.0, 10.0, 11.0])
+
+
+def test_series_is_view_when_object_always_present():
+    history = GameHistory(5)
+    for i in range(7):
+        history.add_game_frame(_frame(float(i)))
+
+    _, positions = history.get_historical_attribute_series(ROBOT_KEY, AttributeType.POSITION, 4)
+    assert positions.shape == (4, 2)
+    assert np.shares_memory(positions, history._values[AttributeType.POSITION])
+
+
+def test_series_skips_frames_where_object_missing():
+    history = GameHistory(10)
+    history.add_game_frame(_frame(0.0))
+    history.add_game_frame(_frame(1.0, with_robot=False))
+    history.add_game_frame(_frame(2.0))
+
+    ts, positions = history.get_historical_attribute_series(ROBOT_KEY, AttributeType.POSITION, 2)
+    np.testing.assert_array_equal(ts, [0.0, 2.0])
+    np.testing.assert_array_equal(positions, [[0, 0], [2, -2]])
+
+
+def test_intermittent_object_keeps_only_samples_from_the_last_max_history_frames():
+    history = GameHistory(4)
+    for i in range(10):
+        history.add_game_frame(_frame(float(i), with_robot=i % 2 == 0))  # seen in every other frame
+
+    ts, positions = history.get_historical_attribute_series(ROBOT_KEY, AttributeType.POSITION, 4)
+    np.testing.assert_array_equal(ts, [6.0, 8.0])  # frames 6-9 are stored; 0, 2 and 4 have been overwritten
+    np.testing.assert_array_equal(positions, [[6, -6], [8, -8]])
+
+    for i in range(10, 14):
+        history.add_game_frame(_frame(float(i), with_robot=False))
+    ts, positions = history.get_historical_attribute_series(ROBOT_KEY, AttributeType.POSITION, 4)
+    assert ts.size == 0
+    assert positions.size == 0
+
+
+def test_series_empty_for_unknown_object():
+    history = GameHistory(10)
+    history.add_game_frame(_frame(0.0))
+
+    ts, values = history.get_historical_attribute_series(
+        ObjectKey(TeamType.ENEMY, ObjectType.ROBOT, 4), AttributeType.VELOCITY, 3
+    )
+    assert ts.size == 0
+    assert values.size == 0
+
+
+def test_attribute_window_covers_all_objects():
+    history = GameHistory(4)
+    for i in range(3):
+        history.add_game_frame(_frame(float(i)))
+
+    ts, values, valid = history.get_attribute_window(AttributeType.VELOCITY, 10)
+    assert ts.shape == (3,)
+    assert values.shape[0] == valid.shape[0] == 3
+    assert valid.sum() == 6  # ball and robot 2 in each frame
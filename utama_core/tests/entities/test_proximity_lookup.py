@@ -1,7 +1,9 @@
 import numpy as np
 import pytest
 
-from utama_core.entities.data.vector import Vector2D
+from utama_core.entities.data.object import ObjectKey, ObjectType, TeamType
+from utama_core.entities.data.vector import Vector2D, Vector3D
+from utama_core.entities.game.ball import Ball
 from utama_core.entities.game.proximity_lookup import ProximityLookup
 from utama_core.entities.game.robot import Robot
 
@@ -31,3 +33,61 @@ def test_proximity_lookup_with_no_ball():
     obj, dist = lookup.closest_to_ball()
     assert obj is None
     assert np.isinf(dist)
+
+
+def _robot(robot_id, is_friendly, x, y):
+    z = Vector2D(0, 0)
+    return Robot(id=robot_id, is_friendly=is_friendly, has_ball=False, p=Vector2D(x, y), v=z, a=z, orientation=0)
+
+
+@pytest.fixture
+def lookup():
+    friendly = {0: _robot(0, True, 0, 0), 1: _robot(1, True, 2, 0)}
+    enemy = {0: _robot(0, False, 1, 0), 1: _robot(1, False, 0, 3), 2: _robot(2, False, 0.5, 0.1)}
+    zero = Vector3D(0, 0, 0)
+    return ProximityLookup(friendly, enemy, Ball(Vector3D(0.6, 0, 0), zero, zero))
+
+
+def _key(team, robot_id):
+    return ObjectKey(team, ObjectType.ROBOT, robot_id)
+
+
+def test_lookup_is_built_on_first_query(lookup):
+    assert lookup._point_array is None
+    key, dist = lookup.closest_to_ball(TeamType.ENEMY)
+    assert key == _key(TeamType.ENEMY, 2)
+    assert dist == pytest.approx(np.hypot(0.1, 0.1))
+    assert lookup.point_array.shape == (6, 2)
+
+
+def test_k_nearest_and_within_radius(lookup):
+    friendly_0 = _key(TeamType.FRIENDLY, 0)
+    nearest = lookup.k_nearest_to_robot(friendly_0, 2, TeamType.ENEMY)
+    assert [k.id for k, _ in nearest] == [2, 0]
+    assert nearest[1][1] == pytest.approx(1.0)
+
+    # Asking for more than exist returns every other robot, never the source itself.
+    assert len(lookup.k_nearest_to_robot(friendly_0, 10)) == 4
+
+    inside = lookup.within_radius_of_point(Vector2D(1.0, 0.0), 1.0)
+    expected = [
+        _key(TeamType.ENEMY, 0),  # 0.0
+        _key(TeamType.ENEMY, 2),  # ~0.51
+        _key(TeamType.FRIENDLY, 0),  # 1.0, ties keep array order
+        _key(TeamType.FRIENDLY, 1),  # 1.0
+    ]
+    assert [k for k, _ in inside] == expected
+    assert lookup.within_radius_of_ball(0.2, TeamType.FRIENDLY) == []
+
+
+def test_closest_matches_full_distance_matrix(lookup):
+    friendly_1 = _key(TeamType.FRIENDLY, 1)
+    key, dist = lookup.closest_to_robot(friendly_1)
+    row = lookup.proximity_matrix[lookup.key_index_map[friendly_1], : lookup.enemy_end_idx]
+    assert dist == pytest.approx(row.min())
+    assert key == lookup.object_keys[int(np.argmin(row))]
+
+
+def test_only_self_in_filter_returns_none():
+    lookup = ProximityLookup({0: _robot(0, True, 0, 0)}, None, None)
+    assert lookup.closest_to_robot(_key(TeamType.FRIENDLY, 0), TeamType.FRIENDLY) == (None, np.inf)
@@ -4,7 +4,7 @@ from timeit import timeit
 import numpy as np
 import pytest
 
-from utama_core.entities.data.vector import Vector2D, Vector3D
+from utama_core.entities.data.vector import Vector2D, Vector3D, VectorArray
 
 N_ITERS = 10000
 
@@ -137,3 +137,46 @@ def test_performance_against_numpy():
     vector_dot_time = timeit(lambda: v2d_1.distance_to(v2d_2), number=N_ITERS)
     numpy_dot_time = timeit(lambda: np.linalg.norm(np_arr_2 - np_arr_1), number=N_ITERS)
     assert vector_dot_time < numpy_dot_time
+
+
+def test_vector_arithmetic_keeps_float_components():
+    v = Vector2D(np.float64(1), 2) + Vector2D(3, 4)
+    assert type(v.x) is float and type(v.y) is float
+    assert -v == Vector2D(-4, -6)
+    assert Vector3D(1, 2, 2).mag() == 3.0
+    assert len(Vector2D(0, 0)) == 2 and list(Vector3D(1, 2, 3)) == [1.0, 2.0, 3.0]
+
+
+def test_vector_array_matches_per_vector_operations():
+    vectors = [Vector2D(3, 4), Vector2D(1, 2), Vector2D(-1, 0.5)]
+    arr = VectorArray.from_vectors(vectors)
+    target = Vector2D(0.5, -1)
+
+    assert len(arr) == 3 and arr[1] == vectors[1]
+    np.testing.assert_allclose(arr.distance_to(target), [v.distance_to(target) for v in vectors])
+    np.testing.assert_allclose(arr.angle_to(target), [v.angle_to(target) for v in vectors])
+    np.testing.assert_allclose(arr.mag(), [v.mag() for v in vectors])
+    np.testing.assert_allclose(arr.dot(target), [v.dot(target) for v in vectors])
+    assert list(arr - target) == [v - target for v in vectors]
+    assert list(arr.norm() * 2) == [v.norm() * 2 for v in vectors]
+
+    index, dist = arr.nearest(target)
+    assert index == 2 and math.isclose(dist, vectors[2].distance_to(target))
+    np.testing.assert_allclose(arr.pairwise_distances()[0, 1], vectors[0].distance_to(vectors[1]))
+
+
+def test_vector_array_from_objects_and_row_scalars():
+    class Obj:
+        def __init__(self, p, v):
+            self.p, self.v = p, v
+
+    objs = {0: Obj(Vector3D(1, 2, 3), None), 1: Obj(Vector3D(4, 5, 6), Vector2D(1, 1))}
+    assert VectorArray.from_objects(objs, "p", dim=3).z.tolist() == [3.0, 6.0]
+    np.testing.assert_allclose(VectorArray.from_objects(objs, "v").data, [[0, 0], [1, 1]])
+
+    scaled = VectorArray([[1, 1], [2, 2]]) * np.array([2.0, 0.5])
+    np.testing.assert_allclose(scaled.data, [[2, 2], [1, 1]])
+    assert len(VectorArray([])) == 0
+
+    with pytest.raises(ValueError):
+        VectorArray([[1, 2, 3, 4]])
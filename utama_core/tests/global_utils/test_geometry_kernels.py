@@ -0,0 +1,114 @@
+import numpy as np
+import pytest
+
+from utama_core.entities.data.vector import Vector2D
+from utama_core.global_utils import geometry_kernels as kernels
+from utama_core.global_utils.math_utils import (
+    closest_point_on_segment,
+    distance_between_line_segments,
+    distance_point_to_segment,
+    find_intersection,
+    segments_intersect,
+)
+from utama_core.motion_planning.src.planning.geometry import (
+    AxisAlignedRectangle,
+    point_segment_distance,
+    segment_to_segment_distance,
+)
+
+
+def _reference_point_segment(p, a, b):
+    # Dense sampling of the segment; exact enough for comparison at 1e-3.
+    ts = np.linspace(0.0, 1.0, 20001)[:, None]
+    return np.min(np.linalg.norm(a + ts * (b - a) - p, axis=1))
+
+
+def test_point_segment_distance_matches_sampled_reference():
+    rng = np.random.default_rng(0)
+    for _ in range(50):
+        p, a, b = rng.uniform(-3, 3, size=(3, 2))
+        expected = _reference_point_segment(p, a, b)
+        assert point_segment_distance(p, a, b) == pytest.approx(expected, abs=1e-3)
+        assert distance_point_to_segment(p, a, b) == pytest.approx(expected, abs=1e-3)
+
+
+def test_accepts_tuples_and_vectors():
+    assert distance_point_to_segment((0, 1), (-1, 0), (1, 0)) == pytest.approx(1.0)
+    assert point_segment_distance(Vector2D(0, 1), Vector2D(-1, 0), Vector2D(1, 0)) == pytest.approx(1.0)
+    np.testing.assert_allclose(closest_point_on_segment((5, 1), (-1, 0), (1, 0)), [1.0, 0.0])
+
+
+def test_degenerate_segment_is_a_point():
+    assert point_segment_distance(np.array([3.0, 4.0]), np.zeros(2), np.zeros(2)) == pytest.approx(5.0)
+
+
+def test_intersection_and_segment_distance():
+    a1, a2 = np.array([-1.0, 0.0]), np.array([1.0, 0.0])
+    crossing = (np.array([0.0, -1.0]), np.array([0.0, 1.0]))
+    touching = (np.array([1.0, 0.0]), np.array([2.0, 1.0]))
+    apart = (np.array([0.0, 1.0]), np.array([2.0, 1.0]))
+
+    assert segments_intersect(a1, a2, *crossing)
+    assert segments_intersect(a1, a2, *touching)
+    assert not segments_intersect(a1, a2, *apart)
+    assert segment_to_segment_distance(a1, a2, *apart) == pytest.approx(1.0)
+    assert distance_between_line_segments(a1, a2, *crossing) == 0.0
+
+    np.testing.assert_allclose(find_intersection((a1, a2), crossing), [0.0, 0.0])
+    assert find_intersection((a1, a2), apart) is None
+
+
+def test_rect_distance_to_segment():
+    rect = AxisAlignedRectangle(-0.5, 0.5, -0.5, 0.5)
+    assert rect.distance_to_segment(np.array([-2.0, 0.0]), np.array([2.0, 0.0])) == 0.0  # crosses
+    assert rect.distance_to_segment(np.array([-2.0, 1.0]), np.array([2.0, 1.0])) == pytest.approx(0.5)
+    assert rect.distance_to_segment(np.array([1.0, 1.0]), np.array([2.0, 2.0])) == pytest.approx(np.hypot(0.5, 0.5))
+
+
+def test_batched_kernels_match_scalar():
+    rng = np.random.default_rng(1)
+    points = rng.uniform(-2, 2, size=(30, 2))
+    a_starts, a_ends = rng.uniform(-2, 2, size=(2, 10, 2))
+    b_starts, b_ends = rng.uniform(-2, 2, size=(2, 7, 2))
+    rects = np.array([[-0.5, 0.5, -0.2, 0.3], [1.0, 1.5, 1.0, 2.0]])
+
+    np.testing.assert_allclose(
+        kernels.points_to_segment_distance(points, a_starts[0], a_ends[0]),
+        [point_segment_distance(p, a_starts[0], a_ends[0]) for p in points],
+        atol=1e-9,
+    )
+    np.testing.assert_allclose(
+        kernels.segments_to_segments_distance(a_starts, a_ends, b_starts, b_ends),
+        [
+            [segment_to_segment_distance(s, e, bs, be) for bs, be in zip(b_starts, b_ends)]
+            for s, e in zip(a_starts, a_ends)
+        ],
+        atol=1e-9,
+    )
+    np.testing.assert_allclose(
+        kernels.rects_to_segments_distance(rects, a_starts, a_ends),
+        [[AxisAlignedRectangle(*r).distance_to_segment(s, e) for r in rects] for s, e in zip(a_starts, a_ends)],
+        atol=1e-9,
+    )
+
+
+def test_numpy_fallbacks_match_compiled_loops():
+    # Whichever path is active, the other one must agree with it.
+    rng = np.random.default_rng(2)
+    starts, ends = rng.uniform(-2, 2, size=(2, 12, 2))
+    rects = np.array([[-0.5, 0.5, -0.2, 0.3], [1.0, 1.5, 1.0, 2.0], [-2.0, -1.0, 0.5, 1.5]])
+
+    np.testing.assert_allclose(
+        kernels._rects_to_segments_distance_numpy(rects, starts, ends),
+        kernels._rects_to_segments_distance_loop(rects, starts, ends),
+        atol=1e-9,
+    )
+    np.testing.assert_allclose(
+        kernels._segments_to_segments_distance_numpy(starts, ends, starts[::-1].copy(), ends[::-1].copy()),
+        kernels._segments_to_segments_distance_loop(starts, ends, starts[::-1].copy(), ends[::-1].copy()),
+        atol=1e-9,
+    )
+
+
+def test_warm_up_runs_every_kernel():
+    kernels.warm_up()
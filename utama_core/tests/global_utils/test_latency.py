@@ -0,0 +1,116 @@
+import csv
+import threading
+
+import pytest
+
+from utama_core.global_utils.latency import (
+    CAPTURE_TO_SEND,
+    MY_SIDE,
+    OPP_SIDE,
+    RECEIVE_TO_SEND,
+    TICK,
+    LatencyTracker,
+    StageHistogram,
+)
+
+
+def test_disabled_tracker_records_nothing():
+    tracker = LatencyTracker(enabled=False)
+    tracker.begin_tick(1.0, 1.0)
+    with tracker.span("refine"):
+        pass
+    tracker.end_tick()
+
+    assert tracker.summary() == {}
+    assert len(tracker.ticks) == 0
+
+
+def test_spans_within_a_tick_are_summed():
+    tracker = LatencyTracker(enabled=True)
+    tracker.begin_tick()
+    tracker.add("motion", 0.001)
+    tracker.add("motion", 0.002)
+    tracker.end_tick()
+
+    assert tracker.ticks[0].stages["motion"] == pytest.approx(0.003)
+    p50, p99, worst = tracker.summary()["motion"]
+    assert p50 == pytest.approx(0.003)
+    assert worst == pytest.approx(0.003)
+    assert TICK in tracker.summary()
+
+
+def test_spans_from_other_threads_go_straight_to_histogram():
+    tracker = LatencyTracker(enabled=True)
+    tracker.begin_tick()
+    worker = threading.Thread(target=lambda: tracker.add("vision_decode", 0.004))
+    worker.start()
+    worker.join()
+
+    assert "vision_decode" in tracker.summary()
+    tracker.end_tick()
+    assert "vision_decode" not in tracker.ticks[0].stages
+
+
+def test_end_to_end_latency_needs_send_and_receive_times():
+    tracker = LatencyTracker(enabled=True)
+    tracker.begin_tick(t_capture=10.0, received_at=10.1)
+    tracker.end_tick()  # nothing sent
+    assert RECEIVE_TO_SEND not in tracker.ticks[0].stages
+
+    tracker.begin_tick(t_capture=10.0, received_at=10.1)
+    tracker.mark_sent()
+    tracker._current.sent_at["my"] = 10.15  # pin the send time so the assertions are exact
+    tracker.end_tick()
+    stages = tracker.ticks[1].stages
+    assert stages[RECEIVE_TO_SEND] == pytest.approx(0.05)
+    assert stages[CAPTURE_TO_SEND] == pytest.approx(0.15)
+
+
+def test_each_side_keeps_its_own_send_time():
+    tracker = LatencyTracker(enabled=True)
+    tracker.begin_tick(t_capture=10.0, received_at=10.1)
+    tracker.mark_sent(MY_SIDE)
+    tracker.mark_sent(OPP_SIDE)
+    tracker._current.sent_at.update({MY_SIDE: 10.12, OPP_SIDE: 10.2})
+    tracker.end_tick()
+
+    stages = tracker.ticks[0].stages
+    assert stages[RECEIVE_TO_SEND] == pytest.approx(0.02)
+    assert stages[f"{OPP_SIDE}.{RECEIVE_TO_SEND}"] == pytest.approx(0.1)
+
+
+def test_tick_records_are_bounded():
+    tracker = LatencyTracker(enabled=True, max_ticks=3)
+    for t in range(10):
+        tracker.begin_tick(t_capture=float(t))
+        tracker.end_tick()
+
+    assert [tick.t_capture for tick in tracker.ticks] == [7.0, 8.0, 9.0]
+
+
+def test_histogram_percentiles_use_recent_window():
+    hist = StageHistogram(window=10)
+    for i in range(100):
+        hist.add(float(i))
+
+    p50, p99, worst = hist.percentiles()
+    assert 90 <= p50 <= 99
+    assert worst == 99
+    assert hist.max == 99
+    assert hist.count == 100
+
+
+def test_export_writes_one_row_per_tick(tmp_path):
+    tracker = LatencyTracker(enabled=True)
+    for t in (1.0, 2.0):
+        tracker.begin_tick(t_capture=t)
+        tracker.add("refine.position", 0.001)
+        tracker.end_tick()
+
+    path = tmp_path / "latency.csv"
+    tracker.export(str(path))
+    with open(path) as f:
+        rows = list(csv.DictReader(f))
+
+    assert [float(row["t_capture"]) for row in rows] == [1.0, 2.0]
+    assert float(rows[0]["refine.position"]) == pytest.approx(0.001)
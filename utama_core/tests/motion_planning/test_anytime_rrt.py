@@ -0,0 +1,72 @@
+import time
+from types import SimpleNamespace
+
+import numpy as np
+
+from utama_core.config.field_params import FieldBounds
+from utama_core.entities.data.vector import Vector2D
+from utama_core.motion_planning.src.planning.path_planners import (
+    AnytimeRRTStarPlanner,
+    point_to_segment_distance,
+)
+
+START = (-2.0, 0.0)
+GOAL = (2.0, 0.0)
+
+
+def _robot(robot_id, x, y):
+    return SimpleNamespace(id=robot_id, p=Vector2D(x, y), v=Vector2D(0.0, 0.0))
+
+
+def _walled_game():
+    # A short wall of enemy robots across the straight line from START to GOAL.
+    wall = {i: _robot(i, 0.0, y) for i, y in enumerate((-0.4, -0.2, 0.0, 0.2, 0.4))}
+    return SimpleNamespace(
+        current=SimpleNamespace(),
+        friendly_robots={0: _robot(0, *START)},
+        enemy_robots=wall,
+        field=SimpleNamespace(field_bounds=FieldBounds(top_left=(-4.5, 3.0), bottom_right=(4.5, -3.0))),
+    )
+
+
+def _assert_collision_free(game, path):
+    obstacles = [np.array([r.p.x, r.p.y]) for r in game.enemy_robots.values()]
+    for a, b in zip(path[:-1], path[1:]):
+        for o in obstacles:
+            assert point_to_segment_distance(o, np.array(a), np.array(b)) > AnytimeRRTStarPlanner.SAFE_OBSTACLES_RADIUS
+
+
+def test_finds_collision_free_path_around_wall():
+    game = _walled_game()
+    planner = AnytimeRRTStarPlanner(game, seed=0)
+    path = planner.path_to(0, GOAL, budget_ms=200.0)
+
+    assert path is not None
+    assert path[0] == START
+    assert path[-1] == GOAL
+    _assert_collision_free(game, path)
+
+
+def test_respects_time_budget():
+    planner = AnytimeRRTStarPlanner(_walled_game(), seed=0)
+    start = time.perf_counter()
+    planner.path_to(0, GOAL, budget_ms=2.0)
+    # One extension can overrun the deadline slightly, but not by a whole control tick.
+    assert time.perf_counter() - start < 0.05
+
+
+def test_warm_start_reuses_previous_tree():
+    game = _walled_game()
+    planner = AnytimeRRTStarPlanner(game, seed=0)
+    assert planner.path_to(0, GOAL, budget_ms=200.0) is not None
+    assert not planner.last_warm_started
+
+    game.current = SimpleNamespace()  # next tick
+    path = planner.path_to(0, (2.0, 0.05), budget_ms=200.0, game=game)
+    assert planner.last_warm_started
+    assert path is not None
+    _assert_collision_free(game, path)
+
+    planner.reset(0)
+    planner.path_to(0, GOAL, budget_ms=50.0)
+    assert not planner.last_warm_started
@@ -0,0 +1,63 @@
+from dataclasses import replace
+from types import SimpleNamespace
+
+import numpy as np
+import pytest
+
+from utama_core.entities.data.vector import Vector2D
+from utama_core.entities.game.robot import Robot
+from utama_core.motion_planning.src.dwa.config import DynamicWindowConfig
+from utama_core.motion_planning.src.dwa.planner import DynamicWindowPlanner
+from utama_core.motion_planning.src.planning.obstacles import ObstacleRegion
+
+
+def _robot(robot_id, is_friendly, pos, vel):
+    return Robot(
+        id=robot_id,
+        is_friendly=is_friendly,
+        has_ball=False,
+        p=Vector2D(*pos),
+        v=Vector2D(*vel),
+        a=Vector2D(0.0, 0.0),
+        orientation=0.0,
+    )
+
+
+def _random_game(rng, n_friendly=6, n_enemy=6):
+    friendly = {i: _robot(i, True, rng.uniform(-2, 2, 2), rng.uniform(-1, 1, 2)) for i in range(n_friendly)}
+    enemy = {i: _robot(i, False, rng.uniform(-2, 2, 2), rng.uniform(-1, 1, 2)) for i in range(n_enemy)}
+    return SimpleNamespace(current=SimpleNamespace(), friendly_robots=friendly, enemy_robots=enemy)
+
+
+@pytest.mark.parametrize("n_directions", [8, 16])
+def test_vectorised_search_matches_loop(n_directions):
+    config = DynamicWindowConfig(max_speed=2.0, max_acceleration=3.0, n_directions=n_directions)
+    vectorised = DynamicWindowPlanner(config)
+    loop = DynamicWindowPlanner(replace(config, vectorised=False))
+    region = ObstacleRegion.from_polygon(np.array([[0.2, -0.3], [0.6, -0.3], [0.6, 0.3], [0.2, 0.3]]))
+    rng = np.random.default_rng(1)
+
+    for _ in range(30):
+        game = _random_game(rng)
+        target = Vector2D(*rng.uniform(-3, 3, 2))
+        for obstacles in ([], [region]):
+            expected = loop.path_to(game, 0, target, obstacles)
+            actual = vectorised.path_to(game, 0, target, obstacles)
+            if expected is None:
+                assert actual is None
+                continue
+            assert actual[1] == pytest.approx(expected[1])
+            assert actual[0].x == pytest.approx(expected[0].x)
+            assert actual[0].y == pytest.approx(expected[0].y)
+
+
+def test_all_candidates_blocked_returns_none():
+    config = DynamicWindowConfig(max_speed=2.0, max_acceleration=3.0)
+    planner = DynamicWindowPlanner(config)
+    game = SimpleNamespace(
+        current=SimpleNamespace(),
+        friendly_robots={0: _robot(0, True, (0.0, 0.0), (0.0, 0.0))},
+        enemy_robots={},
+    )
+    box = ObstacleRegion.from_polygon(np.array([[-1.0, -1.0], [1.0, -1.0], [1.0, 1.0], [-1.0, 1.0]]))
+    assert planner.path_to(game, 0, Vector2D(2.0, 0.0), [box]) is None
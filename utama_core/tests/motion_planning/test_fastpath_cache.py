@@ -0,0 +1,83 @@
+from types import SimpleNamespace
+
+import numpy as np
+
+from utama_core.config.field_params import FieldBounds
+from utama_core.entities.data.vector import Vector2D
+from utama_core.motion_planning.src.fastpathplanning.planner import (
+    FastPathPlanner,
+    _CachedPath,
+)
+
+BOUNDS = FieldBounds(top_left=(-4.5, 3.0), bottom_right=(4.5, -3.0))
+
+
+def _robot(robot_id, x, y):
+    return SimpleNamespace(id=robot_id, p=Vector2D(x, y), v=Vector2D(0.0, 0.0))
+
+
+def _game(enemy_pos):
+    # A fresh frame each call, as StrategyRunner produces every tick.
+    return SimpleNamespace(
+        current=SimpleNamespace(),
+        friendly_robots={0: _robot(0, -2.0, 0.0)},
+        enemy_robots={0: _robot(0, *enemy_pos)},
+    )
+
+
+def _stats(planner):
+    s = planner.cache_stats
+    return s.hits, s.repairs, s.misses
+
+
+def test_unchanged_scene_reuses_previous_path():
+    planner = FastPathPlanner(env=None)
+    first = planner._path_to(_game((0.0, 0.0)), 0, (2.0, 0.0), BOUNDS)
+    second = planner._path_to(_game((0.0, 0.0)), 0, (2.0, 0.0), BOUNDS)
+
+    assert _stats(planner) == (1, 0, 1)
+    np.testing.assert_allclose(first, second)
+
+
+def test_obstacle_moving_onto_path_repairs_it():
+    planner = FastPathPlanner(env=None)
+    straight = planner._path_to(_game((0.0, 2.0)), 0, (2.0, 0.0), BOUNDS)
+    assert straight[1] == 0.0
+
+    detour = planner._path_to(_game((0.0, 0.0)), 0, (2.0, 0.0), BOUNDS)
+    assert _stats(planner) == (0, 1, 1)
+    assert abs(detour[1]) > 0.0
+
+
+def test_target_change_and_reset_force_replanning():
+    planner = FastPathPlanner(env=None)
+    planner._path_to(_game((0.0, 0.0)), 0, (2.0, 0.0), BOUNDS)
+    planner._path_to(_game((0.0, 0.0)), 0, (2.0, 1.0), BOUNDS)
+    assert _stats(planner) == (0, 0, 2)
+
+    planner.reset(0)
+    planner._path_to(_game((0.0, 0.0)), 0, (2.0, 1.0), BOUNDS)
+    assert planner.cache_stats.misses == 3
+
+
+def test_obstacle_creeping_onto_a_later_segment_forces_a_recheck():
+    # Each tick the obstacle moves less than CACHE_OBSTACLE_TOLERANCE, but the drift adds up from the last full check.
+    planner = FastPathPlanner(env=None)
+    our_pos, waypoint, target = np.array([-2.0, 0.0]), np.array([0.0, 1.0]), np.array([2.0, 0.0])
+    normal = np.array([1.0, 2.0]) / np.sqrt(5.0)  # perpendicular to the waypoint -> target segment
+    step = 0.8 * planner.config.CACHE_OBSTACLE_TOLERANCE
+    start = planner.OBSTACLE_CLEARANCE + 2.5 * step
+
+    def obstacles(offset):
+        p = (waypoint + target) / 2 + normal * offset
+        return [(p, p)]
+
+    planner._path_cache[0] = _CachedPath(target=target, waypoints=[waypoint], obstacles=np.array(obstacles(start)))
+    outcomes = []
+    for tick in range(1, 8):
+        planner._collision_cache.clear()
+        _, outcome = planner._plan_with_cache(0, our_pos, target, obstacles(start - tick * step), BOUNDS)
+        outcomes.append(outcome)
+
+    assert outcomes[0] == "hit"
+    assert "repair" in outcomes
@@ -0,0 +1,94 @@
+from types import SimpleNamespace
+
+import numpy as np
+import pytest
+
+from utama_core.entities.data.vector import Vector2D
+from utama_core.motion_planning.src.planning.geometry import (
+    AxisAlignedRectangle,
+    point_segment_distance,
+)
+from utama_core.motion_planning.src.planning.obstacle_snapshot import (
+    ObstacleSnapshot,
+    points_to_segment_distance,
+    rects_to_segment_distance,
+)
+from utama_core.motion_planning.src.planning.obstacles import ObstacleRegion
+
+
+def _robot(robot_id, x, y, vx=0.0, vy=0.0):
+    return SimpleNamespace(id=robot_id, p=Vector2D(x, y), v=Vector2D(vx, vy))
+
+
+def _game(friendly, enemy):
+    frame = SimpleNamespace()
+    return SimpleNamespace(
+        current=frame,
+        friendly_robots={r.id: r for r in friendly},
+        enemy_robots={r.id: r for r in enemy},
+    )
+
+
+@pytest.fixture
+def game():
+    return _game(
+        friendly=[_robot(0, 0.0, 0.0), _robot(1, 1.0, 0.0, vx=0.5)],
+        enemy=[_robot(0, 3.0, 3.0), _robot(1, -2.0, 0.1)],
+    )
+
+
+def test_from_game_packs_robots_into_arrays(game):
+    snapshot = ObstacleSnapshot.from_game(game)
+    assert snapshot.n_robots == 4
+    np.testing.assert_allclose(snapshot.positions[1], [1.0, 0.0])
+    np.testing.assert_allclose(snapshot.velocities[1], [0.5, 0.0])
+    assert snapshot.is_friendly.tolist() == [True, True, False, False]
+
+
+def test_others_excludes_only_the_friendly_robot(game):
+    snapshot = ObstacleSnapshot.from_game(game)
+    # Enemy robot 0 shares the id but must stay an obstacle.
+    assert snapshot.others(0).tolist() == [1, 2, 3]
+
+
+def test_broadphase_returns_nearby_robots_only(game):
+    snapshot = ObstacleSnapshot.from_game(game)
+    near = snapshot.robots_near_segment(np.array([0.0, 0.0]), np.array([0.5, 0.0]), 0.6, exclude_friendly_id=0)
+    assert 1 in near
+    assert 2 not in near  # (3, 3) is several cells away
+
+    assert snapshot.min_robot_distance(np.array([0.0, 0.0]), exclude_friendly_id=0) == pytest.approx(1.0)
+    assert snapshot.min_robot_distance(np.array([0.0, 5.0]), radius=0.5) == float("inf")
+
+
+def test_for_game_reuses_snapshot_until_frame_changes(game):
+    first = ObstacleSnapshot.for_game(game)
+    assert ObstacleSnapshot.for_game(game) is first
+    assert game.current.obstacle_snapshot is first  # held by the frame, not a module-level cache
+
+    game.current = SimpleNamespace()
+    assert ObstacleSnapshot.for_game(game) is not first
+
+
+def test_vectorised_distances_match_scalar_geometry():
+    rng = np.random.default_rng(0)
+    rects = [AxisAlignedRectangle(-0.5, 0.5, -0.2, 0.3), AxisAlignedRectangle(1.0, 1.5, 1.0, 2.0)]
+    rect_array = np.array([(r.min_x, r.max_x, r.min_y, r.max_y) for r in rects])
+    points = rng.uniform(-2, 2, size=(20, 2))
+
+    for _ in range(50):
+        start, end = rng.uniform(-2, 2, size=(2, 2))
+        expected = [r.distance_to_segment(start, end) for r in rects]
+        np.testing.assert_allclose(rects_to_segment_distance(rect_array, start, end), expected, atol=1e-9)
+
+        expected = [point_segment_distance(p, start, end) for p in points]
+        np.testing.assert_allclose(points_to_segment_distance(points, start, end), expected, atol=1e-9)
+
+
+def test_segment_hits_rect_uses_regions(game):
+    region = ObstacleRegion.from_polygon(np.array([[1.0, -1.0], [2.0, -1.0], [2.0, 1.0], [1.0, 1.0]]))
+    snapshot = ObstacleSnapshot.for_game(game).with_regions([region])
+
+    assert snapshot.segment_hits_rect(np.array([0.0, 0.0]), np.array([3.0, 0.0]), 0.1)
+    assert not snapshot.segment_hits_rect(np.array([0.0, 2.0]), np.array([3.0, 2.0]), 0.1)
+    assert ObstacleSnapshot.for_game(game).rects.shape == (0, 4)
@@ -0,0 +1,126 @@
+import math
+
+import numpy as np
+import pytest
+
+from utama_core.config.field_params import STANDARD_FIELD_DIMS
+from utama_core.config.physical_constants import GRAVITY
+from utama_core.data_processing.predictors.position import (
+    BallPredictor,
+    BallTrajectory,
+)
+from utama_core.entities.data.vector import Vector2D, Vector3D
+from utama_core.entities.game import Ball, Field, Game, GameFrame, GameHistory
+from utama_core.entities.game.robot import Robot
+
+DT = 1 / 60
+
+
+def ball_frame(ts: float, x: float, y: float, z: float = 0.0) -> GameFrame:
+    zv = Vector3D(0, 0, 0)
+    return GameFrame(ts, True, True, {}, {}, Ball(Vector3D(x, y, z), zv, zv))
+
+
+def test_rolling_ball_decelerates_and_stops():
+    trajectory = BallTrajectory((0, 0, 0), (2, 0, 0), rolling_deceleration=0.4, horizon=4.0, dt=DT)
+
+    assert trajectory.stop_time == pytest.approx(5.0)
+    np.testing.assert_allclose(trajectory.rest_point, (5.0, 0.0))
+    assert trajectory.position_at(2.0).x == pytest.approx(3.2)
+    assert trajectory.position_at(6.0).x == pytest.approx(5.0)  # past the horizon, at rest
+    assert trajectory.time_to_reach((3.2, 0.0), tolerance=1e-3) == pytest.approx(2.0, abs=DT)
+    assert trajectory.crossing_x(3.2) == pytest.approx((2.0, 0.0), abs=DT)
+    assert trajectory.crossing_x(6.0) is None
+    assert not trajectory.landing_times
+
+
+def test_chip_bounces_then_rolls():
+    trajectory = BallTrajectory((0, 0, 0), (2, 0, 3), rolling_deceleration=0.4, dt=DT)
+    flight = 2 * 3 / GRAVITY
+
+    assert trajectory.landing_times[0] == pytest.approx(flight)
+    assert trajectory.landing_times[1] == pytest.approx(flight * 1.5)  # restitution halves each flight
+    assert trajectory.position_at(flight / 2).z == pytest.approx(9 / (2 * GRAVITY), abs=1e-3)
+    assert trajectory.position_at(flight).x == pytest.approx(2 * flight, abs=0.01)
+    assert trajectory.positions[-1, 2] == 0.0
+    assert math.isfinite(trajectory.stop_time)
+
+
+def test_chip_flies_over_a_robot_in_its_path():
+    robot = [(0.6, 0.0)]
+    rolling = BallTrajectory((0, 0, 0), (2, 0, 0), dt=DT)
+    chip = BallTrajectory((0, 0, 0), (2, 0, 3), dt=DT)
+
+    assert rolling.interception_times(robot, robot_speed=0.0)[0] == pytest.approx(0.25, abs=2 * DT)
+    assert chip.interception_times(robot, robot_speed=0.0)[0] == math.inf
+
+
+def test_earliest_interception_picks_the_closest_robot():
+    trajectory = BallTrajectory((0, 0, 0), (2, 0, 0), rolling_deceleration=0.4, dt=DT)
+    zv = Vector2D(0, 0)
+    robots = {
+        1: Robot(1, True, False, Vector2D(1, 1), zv, zv, 0),
+        2: Robot(2, True, False, Vector2D(3, -0.1), zv, zv, 0),
+    }
+
+    robot_id, t, point = trajectory.earliest_interception(robots, robot_speed=2.0)
+    assert robot_id == 1
+    assert 0.4 < t < 0.5
+    assert point.x == pytest.approx(2 * t - 0.2 * t * t, abs=1e-6)
+
+    times = trajectory.interception_times([(1, 1), (3, -0.1)], robot_speed=2.0)
+    assert times[1] == pytest.approx(0.75, abs=2 * DT)
+
+
+def test_ball_at_rest_is_reached_at_robot_speed():
+    trajectory = BallTrajectory((1, 1, 0), (0, 0, 0), dt=DT)
+    assert trajectory.stop_time == 0.0
+    times = trajectory.interception_times([(1, 1), (1, 2.1115)], robot_speed=1.0)
+    np.testing.assert_allclose(times, (0.0, 1.0), atol=DT)
+
+
+def test_velocity_is_fitted_over_history():
+    history = GameHistory(20)
+    for i in range(10):
+        history.add_game_frame(ball_frame(i * DT, i * DT * 1.0, i * DT * 0.5))
+    current = ball_frame(10 * DT, 10 * DT * 1.0, 10 * DT * 0.5)
+
+    trajectory = BallPredictor().predict(current.ball, current.ts, history)
+    np.testing.assert_allclose(trajectory.v0, (1.0, 0.5, 0.0), atol=1e-9)
+    np.testing.assert_allclose(trajectory.p0, (10 * DT, 5 * DT, 0.0))
+
+
+def test_chip_velocity_fit_allows_for_gravity():
+    def z(t):
+        return 0.1 + 2.0 * t - 0.5 * GRAVITY * t * t
+
+    history = GameHistory(20)
+    for i in range(5):
+        history.add_game_frame(ball_frame(i * DT, i * DT, 0.0, z(i * DT)))
+    now = 5 * DT
+
+    v0 = BallPredictor().predict(ball_frame(now, now, 0.0, z(now)).ball, now, history).v0
+    assert v0[0] == pytest.approx(1.0)
+    assert v0[2] == pytest.approx(2.0 - GRAVITY * now)
+
+
+def test_slow_ball_counts_as_stationary_and_falls_back_without_history():
+    history = GameHistory(20)
+    history.add_game_frame(ball_frame(0.0, 0.0, 0.0))
+    current = ball_frame(DT, 0.0001, 0.0)
+    assert not BallPredictor().predict(current.ball, current.ts, history).v0.any()
+
+    moving = Ball(Vector3D(0, 0, 0), Vector3D(1, 0, 0), Vector3D(0, 0, 0))
+    assert BallPredictor().predict(moving, 0.0, GameHistory(20)).v0[0] == 1.0
+    assert BallPredictor().predict(None, 0.0) is None
+
+
+def test_game_shares_one_trajectory_per_frame():
+    field = Field(True, STANDARD_FIELD_DIMS, STANDARD_FIELD_DIMS.full_field_bounds)
+    game = Game(GameHistory(20), ball_frame(0.0, 0.0, 0.0), field=field)
+
+    first = game.ball_trajectory
+    assert first is game.ball_trajectory
+    game.add_game_frame(ball_frame(DT, 0.02, 0.0))
+    assert game.ball_trajectory is not first
+    assert game.ball_trajectory.v0[0] == pytest.approx(0.02 / DT)
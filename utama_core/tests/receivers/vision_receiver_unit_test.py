@@ -1,7 +1,11 @@
 from collections import deque
 from dataclasses import dataclass, replace
 
+import numpy as np
+import pytest
+
 from utama_core.data_processing.receivers.vision_receiver import (
+    LatestFrameSlot,
     RawBallData,
     RawRobotData,
     VisionReceiver,
@@ -112,6 +116,81 @@ def test_multiple_cameras_put_frames_to_buffer():
         assert vision_buffer[buffer_id][0] == v._process_packet(camera_detections[buffer_id])
 
 
+def test_slot_decodes_into_arrays():
+    slot = LatestFrameSlot()
+    assert not slot
+    assert slot.write(MOCK_DETECTION1, received_at=10.0)
+    assert slot
+
+    frame = slot.popleft()
+    assert not slot
+    assert frame.ts == 1
+    assert frame.camera_id == 0
+    assert frame.received_at == 10.0
+    np.testing.assert_array_equal(frame.yellow_robots, [[1000, 2, 3, 4000, 5000]])
+    np.testing.assert_array_equal(frame.blue_robots, [[100, 0.2, 0.3, 400, 500]])
+    np.testing.assert_array_equal(frame.balls, [[0.01, 0.02, 0.03, 40]])
+
+
+def test_slot_keeps_latest_and_rejects_out_of_order():
+    slot = LatestFrameSlot()
+    slot.write(MOCK_DETECTION2, received_at=2.0)
+    assert not slot.write(MOCK_DETECTION1, received_at=3.0)  # older capture time than the pending frame
+
+    frame = slot.popleft()
+    assert frame.ts == 2
+    assert frame.blue_robots.shape == (0, 5)
+    assert frame.balls.shape == (0, 4)
+    assert slot.latest_ts == 2
+    assert slot.received_at == 2.0
+    with pytest.raises(IndexError):
+        slot.popleft()
+
+
+def test_slot_does_not_overwrite_frame_held_by_consumer():
+    slot = LatestFrameSlot()
+    slot.write(MOCK_DETECTION1, received_at=1.0)
+    held = slot.popleft()
+    for t in range(2, 6):
+        slot.write(replace(MOCK_DETECTION2, t_capture=t), received_at=t)
+
+    assert held.ts == 1
+    np.testing.assert_array_equal(held.yellow_robots, [[1000, 2, 3, 4000, 5000]])
+    assert slot.popleft().ts == 5
+
+
+def test_slot_drops_detections_beyond_capacity():
+    slot = LatestFrameSlot(max_robots=1, max_balls=1)
+    detection = replace(MOCK_DETECTION1, robots_yellow=MOCK_DETECTION1.robots_yellow * 3)
+    slot.write(detection, received_at=0.0)
+
+    assert slot.popleft().yellow_robots.shape == (1, 5)
+    assert slot.dropped_detections == 2
+
+
+def test_empty_slot_has_no_latest_frame():
+    slot = LatestFrameSlot()
+    assert slot.latest_ts is None
+    assert slot.received_at is None
+
+
+def test_frames_without_detections_are_buffered_by_both_paths():
+    empty = replace(MOCK_DETECTION1, t_capture=3, robots_yellow=[], robots_blue=[], balls=[])
+    legacy = VisionReceiver([deque(maxlen=1)])
+    legacy._add_detection_to_buffer(MOCK_DETECTION1)
+    legacy._add_detection_to_buffer(empty)
+    slots = VisionReceiver([LatestFrameSlot()])
+    slots._add_detection_to_buffer(MOCK_DETECTION1, recv_time=1.0)
+    slots._add_detection_to_buffer(empty, recv_time=3.0)
+
+    legacy_frame = legacy.vision_buffers[0].popleft()
+    slot_frame = slots.vision_buffers[0].popleft()
+    assert legacy_frame.ts == slot_frame.ts == 3
+    assert legacy_frame.yellow_robots == legacy_frame.blue_robots == legacy_frame.balls == []
+    assert slot_frame.yellow_robots.shape == (0, 5)
+    assert slot_frame.balls.shape == (0, 4)
+
+
 if __name__ == "__main__":
     test_process_packet_produces_raw_data()
     test_single_camera_takes_more_recent_frame()
@@ -1,7 +1,19 @@
 import math
 
-from utama_core.data_processing.refiners.position import CameraCombiner, VisionBounds
-from utama_core.entities.data.raw_vision import RawBallData, RawRobotData, RawVisionData
+import numpy as np
+import pytest
+
+from utama_core.data_processing.refiners.position import (
+    CameraCombiner,
+    VectorisedCameraCombiner,
+    VisionBounds,
+)
+from utama_core.entities.data.raw_vision import (
+    RawBallData,
+    RawRobotData,
+    RawVisionArrays,
+    RawVisionData,
+)
 
 infinite_bounds = VisionBounds(x_min=-math.inf, x_max=math.inf, y_min=-math.inf, y_max=math.inf)
 
@@ -153,6 +165,137 @@ def test_only_in_bounds_camera_contributes_to_average():
     assert result.yellow_robots[0].y == 1.0
 
 
+# --- VectorisedCameraCombiner tests ---
+
+
+@pytest.mark.parametrize("combiner_cls", [CameraCombiner, VectorisedCameraCombiner])
+def test_combiners_agree_on_equal_confidence(combiner_cls):
+    cam1 = RawVisionData(
+        0.0,
+        [RawRobotData(3, 1.0, 2.0, 0.1, 1), RawRobotData(1, -1.0, 0.5, 3.1, 1)],
+        [RawRobotData(0, 0.0, 0.0, -3.1, 1)],
+        [RawBallData(0.5, 0.5, 0, 1)],
+        0,
+    )
+    cam2 = RawVisionData(
+        0.2,
+        [RawRobotData(3, 1.2, 2.2, 0.3, 1)],
+        [RawRobotData(0, 0.2, 0.0, 3.1, 1)],
+        [RawBallData(0.51, 0.52, 0, 1)],
+        1,
+    )
+
+    result = combiner_cls().combine_cameras([cam1, cam2], infinite_bounds)
+
+    assert result.ts == pytest.approx(0.1)
+    assert [r.id for r in result.yellow_robots] == [3, 1]
+    assert result.yellow_robots[0].x == pytest.approx(1.1)
+    assert result.yellow_robots[0].y == pytest.approx(2.1)
+    assert result.yellow_robots[0].orientation == pytest.approx(0.2)
+    # Orientation is averaged on the circle, not across the +-pi seam.
+    assert abs(result.blue_robots[0].orientation) == pytest.approx(math.pi)
+    assert len(result.balls) == 1
+    assert result.balls[0].x == pytest.approx(0.505)
+    assert result.balls[0].y == pytest.approx(0.51)
+
+
+def test_vectorised_robot_average_is_confidence_weighted():
+    cam1 = RawVisionData(0, [RawRobotData(0, 0.0, 0.0, 0.0, 0.75)], [], [], 0)
+    cam2 = RawVisionData(0, [RawRobotData(0, 1.0, 2.0, 0.0, 0.25)], [], [], 1)
+
+    result = VectorisedCameraCombiner().combine_cameras([cam1, cam2], infinite_bounds)
+
+    assert len(result.yellow_robots) == 1
+    assert result.yellow_robots[0].x == pytest.approx(0.25)
+    assert result.yellow_robots[0].y == pytest.approx(0.5)
+
+
+def test_vectorised_zero_confidence_falls_back_to_mean():
+    cam1 = RawVisionData(0, [RawRobotData(0, 0.0, 0.0, 0.0, 0)], [], [RawBallData(0, 0, 0, 0)], 0)
+    cam2 = RawVisionData(0, [RawRobotData(0, 1.0, 1.0, 0.0, 0)], [], [RawBallData(0.02, 0.02, 0, 0)], 1)
+
+    result = VectorisedCameraCombiner().combine_cameras([cam1, cam2], infinite_bounds)
+
+    assert result.yellow_robots[0].x == pytest.approx(0.5)
+    assert len(result.balls) == 1
+    assert result.balls[0].x == pytest.approx(0.01)
+    assert result.balls[0].confidence == 0
+
+
+def test_vectorised_ball_clusters_and_keeps_max_confidence():
+    balls = [
+        RawBallData(0.0, 0.0, 0, 0.2),
+        RawBallData(5, 5, 0, 1),
+        RawBallData(0.02, 0.03, 0, 1),  # Manhattan 0.05 from the first: not merged
+        RawBallData(1, 1, 0, 0.4),
+        RawBallData(1.01, 1.0, 0, 0.9),
+    ]
+    frame = RawVisionData(0, [], [], balls, 0)
+
+    result = VectorisedCameraCombiner().combine_cameras([frame], infinite_bounds)
+
+    assert [(b.x, b.y) for b in result.balls[:3]] == [(0.0, 0.0), (5, 5), (0.02, 0.03)]
+    assert len(result.balls) == 4
+    assert result.balls[3].confidence == 0.9
+    assert result.balls[3].x == pytest.approx((1 * 0.4 + 1.01 * 0.9) / 1.3)
+
+
+def test_vectorised_ball_clustering_is_transitive_across_cells():
+    # A chain of detections each 0.04 apart spans several grid cells but is one cluster.
+    balls = [RawBallData(0.04 * i, 0.0, 0, 1) for i in range(6)]
+    frame = RawVisionData(0, [], [], balls[::-1], 0)
+
+    result = VectorisedCameraCombiner().combine_cameras([frame], infinite_bounds)
+
+    assert len(result.balls) == 1
+    assert result.balls[0].x == pytest.approx(0.1)
+
+
+def test_vectorised_bounds_filtering():
+    in_bounds = RawRobotData(0, 1.0, 1.0, 0, 1)
+    out_of_bounds = RawRobotData(0, 10.0, 10.0, 0, 1)
+    frame = RawVisionData(
+        0, [in_bounds, out_of_bounds], [out_of_bounds], [RawBallData(6.0, 0.0, 0, 1), RawBallData(0, 0, 0, 1)], 0
+    )
+
+    result = VectorisedCameraCombiner().combine_cameras([frame], tight_bounds)
+
+    assert len(result.yellow_robots) == 1
+    assert result.yellow_robots[0].x == 1.0
+    assert result.blue_robots == []
+    assert len(result.balls) == 1
+    assert result.balls[0].x == 0.0
+
+
+def test_vectorised_empty_cameras_give_empty():
+    frames = [RawVisionData(0, [], [], [], 0), RawVisionData(0, [], [], [], 1)]
+    result = VectorisedCameraCombiner().combine_cameras(frames, infinite_bounds)
+
+    assert result.yellow_robots == []
+    assert result.blue_robots == []
+    assert result.balls == []
+
+
+def test_vectorised_accepts_array_frames_mixed_with_dataclass_frames():
+    array_frame = RawVisionArrays(
+        ts=0.0,
+        yellow_robots=np.array([[2, 1.0, 1.0, 0.0, 1.0]]),
+        blue_robots=np.empty((0, 5)),
+        balls=np.array([[0.0, 0.0, 0.0, 0.5]]),
+        camera_id=0,
+        received_at=0.0,
+    )
+    dataclass_frame = RawVisionData(0.0, [RawRobotData(2, 1.2, 1.0, 0.0, 1)], [], [RawBallData(0.01, 0, 0, 1)], 1)
+
+    result = VectorisedCameraCombiner().combine_cameras([array_frame, dataclass_frame], infinite_bounds)
+
+    assert len(result.yellow_robots) == 1
+    assert result.yellow_robots[0].id == 2
+    assert result.yellow_robots[0].x == pytest.approx(1.1)
+    assert len(result.balls) == 1
+    assert result.balls[0].confidence == 1
+
+
 if __name__ == "__main__":
     test_combine_same_robots_produces_same()
     test_combine_with_one_camera_empty()
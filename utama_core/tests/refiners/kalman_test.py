@@ -10,6 +10,7 @@ Key properties checked:
 """
 
 import math
+from dataclasses import replace
 
 import numpy as np
 import pytest
@@ -17,6 +18,7 @@ import pytest
 from utama_core.data_processing.refiners.filters.kalman import (
     KalmanFilter,
     KalmanFilterBall,
+    KalmanFilterBank,
 )
 from utama_core.entities.data.vector import Vector2D, Vector3D
 from utama_core.entities.data.vision import VisionRobotData
@@ -451,3 +453,79 @@ class TestKalmanFilterBallFilterData:
             kf._step_xy((1.0, 2.0), robot, time_elapsed=0.1)
 
         assert np.all(np.diag(kf.covariance_mat_xy) < np.diag(initial_cov))
+
+
+# ---------------------------------------------------------------------------
+# KalmanFilterBank – equivalence with per-robot KalmanFilter
+# ---------------------------------------------------------------------------
+
+
+class TestKalmanFilterBank:
+    def _run_reference_and_bank(self, n_steps: int, vanish_prob: float, seed: int = 0):
+        """Feed identical noisy measurements through per-robot filters and the bank."""
+        rng = np.random.default_rng(seed)
+        ids = [0, 3, 5]
+        filters = {rbt_id: KalmanFilter(id=rbt_id) for rbt_id in ids}
+        bank = KalmanFilterBank()
+        last_yellow = {
+            rbt_id: replace(make_robot(x=rbt_id, y=-rbt_id, vx=0.3, vy=-0.2, orientation=3.1), id=rbt_id)
+            for rbt_id in ids
+        }
+
+        for _ in range(n_steps):
+            vision = {}
+            for rbt_id in ids:
+                if rng.random() < vanish_prob:
+                    vision[rbt_id] = None
+                else:
+                    r = last_yellow[rbt_id]
+                    vision[rbt_id] = make_vision(
+                        r.p.x + rng.normal(0, 0.01),
+                        r.p.y + rng.normal(0, 0.01),
+                        r.orientation + rng.normal(0, 0.1),
+                        robot_id=rbt_id,
+                    )
+
+            expected = [filters[rbt_id].filter_data(vision[rbt_id], last_yellow[rbt_id], 1 / 60) for rbt_id in ids]
+            actual, actual_blue = bank.filter_teams(vision, last_yellow, {}, {}, 1 / 60)
+            assert actual_blue == []
+            yield expected, actual
+
+            last_yellow = {
+                r.id: replace(make_robot(x=r.x, y=r.y, vx=0.3, vy=-0.2, orientation=r.orientation), id=r.id)
+                for r in actual
+            }
+
+    @pytest.mark.parametrize("vanish_prob", [0.0, 0.3])
+    def test_matches_per_robot_filters(self, vanish_prob):
+        for expected, actual in self._run_reference_and_bank(n_steps=100, vanish_prob=vanish_prob):
+            assert [r.id for r in actual] == [r.id for r in expected]
+            for e, a in zip(expected, actual):
+                assert a.x == pytest.approx(e.x, rel=0, abs=1e-12)
+                assert a.y == pytest.approx(e.y, rel=0, abs=1e-12)
+                assert a.orientation == pytest.approx(e.orientation, rel=0, abs=1e-12)
+
+    def test_new_robot_without_last_frame_passes_through(self):
+        bank = KalmanFilterBank()
+        vision = make_vision(1.0, 2.0, 0.5, robot_id=4)
+        yellow, blue = bank.filter_teams({}, {}, {4: vision}, {}, 0.1)
+        assert yellow == []
+        assert blue == [vision]
+        assert bank.has_filter[KalmanFilterBank.BLUE_SLOT_OFFSET + 4]
+        assert not bank.initialised[KalmanFilterBank.BLUE_SLOT_OFFSET + 4]
+
+    def test_vanished_robot_advances_with_velocity(self):
+        bank = KalmanFilterBank()
+        robot = make_robot(x=0.0, y=0.0, vx=1.0, vy=0.5)
+        bank.filter_teams({0: make_vision(0.0, 0.0, 0.0)}, {0: robot}, {}, {}, 0.1)
+        (result,), _ = bank.filter_teams({0: None}, {0: robot}, {}, {}, 0.1)
+        assert result.x == pytest.approx(bank.state_xy[0, 0])
+        assert result.x > 0.0 and result.y > 0.0
+
+    def test_reset_clears_all_slots(self):
+        bank = KalmanFilterBank()
+        robot = make_robot(x=1.0, y=1.0)
+        bank.filter_teams({0: make_vision(1.0, 1.0, 0.0)}, {0: robot}, {}, {}, 0.1)
+        bank.reset()
+        assert not bank.has_filter.any()
+        assert not bank.initialised.any()
@@ -155,3 +155,51 @@ def test_acceleration_calculation_implements_expected_formula():
     assert game.ball.a.x == pytest.approx(acc / VelocityRefiner.ACCELERATION_WINDOW_SIZE)
     assert game.ball.a.y == pytest.approx(acc / VelocityRefiner.ACCELERATION_WINDOW_SIZE)
     assert game.ball.a.z == pytest.approx(acc / VelocityRefiner.ACCELERATION_WINDOW_SIZE)
+
+
+def test_fit_recovers_quadratic_motion_from_irregular_timestamps():
+    # Constant acceleration, sampled with uneven gaps (late and dropped vision frames).
+    def ball_at(t):
+        return create_ball_only_game(t, 1 + 2 * t + 0.75 * t**2, -t - 0.5 * t**2, 0.1 + 0.2 * t, 0, 0, 0)
+
+    game_history = GameHistory(20)
+    for t in (0.0, 0.015, 0.04, 0.05, 0.09, 0.1):
+        game_history.add_game_frame(ball_at(t))
+
+    now = 0.12
+    game = VelocityRefiner(fit_window=8).refine(game_history, ball_at(now))
+
+    assert game.ball.v.x == pytest.approx(2 + 1.5 * now)
+    assert game.ball.v.y == pytest.approx(-1 - now)
+    assert game.ball.v.z == pytest.approx(0.2)
+    assert game.ball.a.x == pytest.approx(1.5, abs=1e-4)
+    assert game.ball.a.y == pytest.approx(-1.0, abs=1e-4)
+    assert game.ball.a.z == pytest.approx(0.0, abs=1e-4)
+
+
+def test_fit_skips_frames_the_robot_was_missing_from():
+    game_history = GameHistory(20)
+    for i, t in enumerate((0.0, 0.02, 0.04, 0.06)):
+        frame = create_one_robot_only_game(t, 3 * t, 1 - 2 * t, is_friendly=True)
+        if i == 2:
+            frame = create_ball_only_game(t, 0, 0, 0)  # the robot vanished for a frame
+        game_history.add_game_frame(frame)
+
+    game = VelocityRefiner(fit_window=8).refine(game_history, create_one_robot_only_game(0.08, 0.24, 0.84, True))
+
+    robot = game.friendly_robots[1]
+    assert robot.v.x == pytest.approx(3)
+    assert robot.v.y == pytest.approx(-2)
+    assert robot.a.x == pytest.approx(0, abs=1e-6)
+
+
+def test_fit_with_one_recorded_frame_is_a_two_point_difference():
+    game_history = GameHistory(10)
+    game_history.add_game_frame(create_ball_only_game(2, 10, 20, 30))
+
+    game = VelocityRefiner(fit_window=5).refine(game_history, create_ball_only_game(5, 19, 32, 33))
+
+    assert game.ball.v.x == pytest.approx(3)
+    assert game.ball.v.y == pytest.approx(4)
+    assert game.ball.v.z == pytest.approx(1)
+    assert game.ball.a.x == 0
@@ -0,0 +1,107 @@
+import math
+
+import pytest
+
+from utama_core.config.field_params import STANDARD_FIELD_DIMS
+from utama_core.data_processing.refiners import (
+    FrameWorkspace,
+    PositionRefiner,
+    RobotInfoRefiner,
+    VelocityRefiner,
+)
+from utama_core.entities.data.command import RobotResponse
+from utama_core.entities.data.raw_vision import RawBallData, RawRobotData, RawVisionData
+from utama_core.entities.data.vector import Vector2D, Vector3D
+from utama_core.entities.game import Ball, GameFrame, GameHistory
+from utama_core.entities.game.robot import Robot
+
+
+def rfac(id, is_friendly, x, y) -> Robot:
+    zv = Vector2D(0, 0)
+    return Robot(id, is_friendly, False, Vector2D(x, y), zv, zv, 0)
+
+
+def initial_frame(my_team_is_yellow: bool) -> GameFrame:
+    zv = Vector3D(0, 0, 0)
+    return GameFrame(
+        ts=0.0,
+        my_team_is_yellow=my_team_is_yellow,
+        my_team_is_right=True,
+        friendly_robots={0: rfac(0, True, 0, 0), 1: rfac(1, True, 1, 0)},
+        enemy_robots={3: rfac(3, False, -1, 0)},
+        ball=Ball(Vector3D(0, 0, 0), zv, zv),
+    )
+
+
+def vision_frame(tick: int, camera: int) -> RawVisionData:
+    ts = tick / 60
+    yellow = [RawRobotData(0, 0.01 * tick, 0.02 * tick, 0.05 * tick, 1)]
+    if tick < 10:
+        yellow.append(RawRobotData(1, 1 + 0.01 * tick, 0, 0, 1))  # vanishes at tick 10
+    blue = [RawRobotData(3, -1 - 0.01 * tick, 0.5, math.pi, 1)]
+    if tick >= 5:
+        blue.append(RawRobotData(5, 2, -1, 0.3, 1))  # appears at tick 5
+    balls = [] if tick % 7 == 0 else [RawBallData(0.03 * tick, 0.01 * camera, 0, 1)]
+    return RawVisionData(ts, yellow, blue, balls, camera)
+
+
+@pytest.mark.parametrize("filtering", [False, True])
+@pytest.mark.parametrize("my_team_is_yellow", [True, False])
+@pytest.mark.parametrize("fit_window", [None, 8])
+def test_refine_into_matches_chained_refine(filtering, my_team_is_yellow, fit_window):
+    frame = initial_frame(my_team_is_yellow)
+    chained = (
+        PositionRefiner(STANDARD_FIELD_DIMS, filtering),
+        VelocityRefiner(fit_window),
+        RobotInfoRefiner(),
+        GameHistory(60),
+    )
+    in_place = (
+        PositionRefiner(STANDARD_FIELD_DIMS, filtering),
+        VelocityRefiner(fit_window),
+        RobotInfoRefiner(),
+        GameHistory(60),
+    )
+    if filtering:
+        chained[0].start_filtering()
+        in_place[0].start_filtering()
+
+    workspace = FrameWorkspace(frame)
+    chained_frame = frame
+    for tick in range(1, 30):
+        vision = [vision_frame(tick, 0), vision_frame(tick, 1)] if tick % 11 else [None]
+        responses = [RobotResponse(0, tick % 3 == 0)]
+
+        position, velocity, robot_info, history = chained
+        chained_frame = position.refine(chained_frame, vision)
+        chained_frame = velocity.refine(history, chained_frame)
+        chained_frame = robot_info.refine(chained_frame, responses)
+        history.add_game_frame(chained_frame)
+
+        position, velocity, robot_info, history = in_place
+        position.refine_into(workspace, vision)
+        velocity.refine_into(history, workspace)
+        robot_info.refine_into(workspace, responses)
+        snapshot = workspace.snapshot()
+        history.add_game_frame(snapshot)
+
+        assert snapshot == chained_frame, f"tick {tick}"
+        assert list(snapshot.friendly_robots) == list(chained_frame.friendly_robots)
+        assert list(snapshot.enemy_robots) == list(chained_frame.enemy_robots)
+        assert workspace.last_frame is snapshot
+
+
+def test_load_resets_rows_and_new_robots_start_at_rest():
+    frame = initial_frame(my_team_is_yellow=False)
+    workspace = FrameWorkspace(frame)
+    assert workspace.friendly is workspace.blue
+    assert workspace.snapshot() == frame
+
+    for robot_id in range(20):  # more robots than the preallocated rows
+        workspace.enemy.set_pose(robot_id + 10, 1.0, 2.0, 0.5)
+    robots = workspace.snapshot().enemy_robots
+    assert len(robots) == 21
+    assert robots[29] == Robot(29, False, False, Vector2D(1, 2), Vector2D(0, 0), Vector2D(0, 0), 0.5)
+
+    workspace.load(frame)
+    assert workspace.snapshot() == frame
@@ -1,10 +1,19 @@
+import time
 from unittest.mock import patch
 
+import numpy as np
 import pytest
 
 from utama_core.entities.data.vector import Vector2D, Vector3D
 from utama_core.entities.game import Ball, GameFrame, Robot
-from utama_core.replay.replay_player import ReplayStandardSSL
+from utama_core.replay import OverflowPolicy, ReplayFormat, ReplayWriterConfig
+from utama_core.replay.columnar import ColumnarReplayReader
+from utama_core.replay.replay_player import (
+    ReplayStandardSSL,
+    _video_frame_indices,
+    open_replay,
+)
+from utama_core.replay.replay_writer import AsyncReplayWriter, ReplayWriter
 
 # Example frame with non-sequential IDs
 frame = GameFrame(
@@ -78,3 +87,134 @@ def test_non_sequential_robot_ids(test_frame):
             replay_env.step_replay(test_frame)
         except Exception as e:
             pytest.fail(f"Replay failed with non-sequential robot IDs: {e}")
+
+
+def _write_replay(tmp_path, replay_format, frames, chunk_size=1):
+    config = ReplayWriterConfig(replay_name="roundtrip", format=replay_format, chunk_size=chunk_size)
+    with patch("utama_core.replay.replay_writer.REPLAY_BASE_PATH", tmp_path):
+        writer = ReplayWriter(config, my_team_is_yellow=True, exp_friendly=2, exp_enemy=1)
+        for f in frames:
+            writer.write_frame(f)
+        writer.close()
+    return tmp_path / f"roundtrip{replay_format.value}"
+
+
+@pytest.mark.parametrize("replay_format", list(ReplayFormat))
+def test_replay_roundtrip(tmp_path, replay_format):
+    path = _write_replay(tmp_path, replay_format, [frame, second_frame])
+
+    metadata, game_frames = open_replay(path)
+
+    assert metadata.my_team_is_yellow
+    assert metadata.exp_friendly == 2
+    assert metadata.exp_enemy == 1
+    assert len(game_frames) == 2
+    loaded = game_frames[1]
+    assert loaded.ts == second_frame.ts
+    assert set(loaded.friendly_robots) == {3, 5}
+    assert set(loaded.enemy_robots) == {2}
+    assert loaded.friendly_robots[5].p == Vector2D(2, 2)
+    assert loaded.enemy_robots[2].p == Vector2D(-1, -1)
+    assert loaded.ball.p == Vector3D(0, 0, 0)
+
+
+def test_columnar_replay_flushes_partial_chunk_on_close(tmp_path):
+    path = _write_replay(tmp_path, ReplayFormat.COLUMNAR, [frame, second_frame, frame], chunk_size=2)
+
+    reader = ColumnarReplayReader(path)
+    assert len(reader) == 3
+    mapping, file = reader._mmap, reader._file
+    reader.close()
+    assert mapping.closed and file.closed
+    assert len(reader) == 0
+
+
+def test_columnar_replay_seek_and_trajectory(tmp_path):
+    path = _write_replay(tmp_path, ReplayFormat.COLUMNAR, [frame, second_frame])
+
+    reader = ColumnarReplayReader(path)
+    assert reader.index_at(0.05) == 0
+    assert reader.index_at(0.1) == 1
+    assert reader.frame_at(1.0).ts == second_frame.ts
+
+    ts, positions, present = reader.robot_trajectory(1, is_friendly=True)
+    np.testing.assert_array_equal(ts, [0.0, 0.1])
+    np.testing.assert_array_equal(present, [True, False])
+    np.testing.assert_array_equal(positions[0], [1, 1])
+    reader.close()
+
+
+def _async_config(**kwargs):
+    return ReplayWriterConfig(replay_name="async", async_writer=True, **kwargs)
+
+
+def test_async_replay_writer_writes_all_frames(tmp_path):
+    with patch("utama_core.replay.replay_writer.REPLAY_BASE_PATH", tmp_path):
+        writer = AsyncReplayWriter(_async_config(chunk_size=4), my_team_is_yellow=True, exp_friendly=2, exp_enemy=1)
+        for _ in range(10):
+            writer.write_frame(second_frame)
+        writer.close()
+
+    reader = ColumnarReplayReader(tmp_path / "async.utr")
+    assert len(reader) == 10
+    assert writer.dropped_frames == 0
+    reader.close()
+
+
+def test_async_replay_writer_drops_when_queue_full(tmp_path):
+    with patch("utama_core.replay.replay_writer.REPLAY_BASE_PATH", tmp_path):
+        writer = AsyncReplayWriter(
+            _async_config(queue_size=2, overflow_policy=OverflowPolicy.DROP),
+            my_team_is_yellow=True,
+            exp_friendly=2,
+            exp_enemy=1,
+        )
+        # Stall the writer thread so the queue cannot drain.
+        with patch.object(writer, "_encode_frame", side_effect=lambda f: time.sleep(0.2)):
+            for _ in range(5):
+                writer.write_frame(frame)
+            assert writer.dropped_frames >= 2
+        writer.close()
+
+
+def test_async_replay_writer_blocks_when_queue_full(tmp_path):
+    with patch("utama_core.replay.replay_writer.REPLAY_BASE_PATH", tmp_path):
+        writer = AsyncReplayWriter(
+            _async_config(queue_size=1, overflow_policy=OverflowPolicy.BLOCK),
+            my_team_is_yellow=True,
+            exp_friendly=2,
+            exp_enemy=1,
+        )
+        for _ in range(20):
+            writer.write_frame(frame)
+        writer.close()
+
+    reader = ColumnarReplayReader(tmp_path / "async.utr")
+    assert len(reader) == 20
+    assert writer.dropped_frames == 0
+    reader.close()
+
+
+def test_async_replay_writer_reports_a_dead_thread_once(tmp_path):
+    with patch("utama_core.replay.replay_writer.REPLAY_BASE_PATH", tmp_path):
+        writer = AsyncReplayWriter(_async_config(), my_team_is_yellow=True, exp_friendly=2, exp_enemy=1)
+        with patch.object(writer, "_encode_frame", side_effect=OSError("disk full")):
+            writer.write_frame(frame)
+            writer._thread.join(timeout=2.0)
+        with patch.object(writer.logger, "error") as log_error:
+            for _ in range(5):
+                writer.write_frame(frame)
+        writer.close()
+
+    assert isinstance(writer.thread_exception, OSError)
+    log_error.assert_called_once()
+    assert "disk full" in log_error.call_args.args[1]
+
+
+def test_video_frames_follow_replay_timestamps():
+    # Frames recorded irregularly at 0, 0.1, 0.15 and 0.4 s, rendered at 20 fps.
+    indices = _video_frame_indices([0.0, 0.1, 0.15, 0.4], fps=20)
+    np.testing.assert_array_equal(indices, [0, 0, 1, 2, 2, 2, 2, 2, 3])
+
+    np.testing.assert_array_equal(_video_frame_indices([0.0, 0.1, 0.15, 0.4], fps=20, start_time=0.3), [2, 2, 3])
+    assert _video_frame_indices([], fps=20).size == 0
@@ -0,0 +1,84 @@
+import threading
+
+from utama_core.rsoccer_simulator.src.ssl.render_pipeline import (
+    DoubleBuffer,
+    LatestSnapshotSlot,
+    RenderSnapshot,
+    RenderWorker,
+)
+
+
+def snapshot(i: int) -> RenderSnapshot:
+    return RenderSnapshot(ball=(i, 0), robots_blue=((i, i, 0.0, 0),), robots_yellow=(), overlay=())
+
+
+def test_slot_keeps_only_the_newest_snapshot():
+    slot = LatestSnapshotSlot()
+    for i in range(3):
+        slot.put(snapshot(i))
+
+    assert slot.take(timeout=0) == snapshot(2)
+    assert slot.dropped == 2
+    assert slot.take(timeout=0) is None
+
+    slot.close()
+    slot.put(snapshot(3))
+    assert slot.take(timeout=0) is None
+
+
+def test_worker_drops_stale_frames_while_drawing_is_slow():
+    drawing, release, caught_up = threading.Event(), threading.Event(), threading.Event()
+    presented = []
+
+    def present(s):
+        presented.append(s)
+        drawing.set()
+        release.wait(1.0)
+        if s == snapshot(9):
+            caught_up.set()
+
+    worker = RenderWorker(present)
+    worker.submit(snapshot(0))
+    assert drawing.wait(1.0)
+    for i in range(1, 10):  # the sim keeps stepping while the first frame is still being drawn
+        worker.submit(snapshot(i))
+    release.set()
+    assert caught_up.wait(1.0)
+    worker.close()
+
+    assert presented[0] == snapshot(0)
+    assert presented[-1] == snapshot(9)
+    assert worker.dropped == 8
+    assert worker.rendered == len(presented) == 2
+
+
+def test_worker_stops_rendering_after_an_error():
+    torn_down = threading.Event()
+
+    def present(s):
+        raise RuntimeError("display lost")
+
+    worker = RenderWorker(present, teardown=torn_down.set)
+    worker.submit(snapshot(0))
+    assert torn_down.wait(1.0)
+    worker.submit(snapshot(1))
+    worker.close()
+
+    assert isinstance(worker.thread_exception, RuntimeError)
+    assert worker.rendered == 0
+
+
+def test_double_buffer_shows_each_finished_frame_once():
+    buffers = DoubleBuffer(list)
+    shown = []
+    assert not buffers.show(shown.append)  # nothing drawn yet
+
+    buffers.back.append("frame 1")
+    buffers.swap()
+    assert buffers.show(lambda frame: shown.append(list(frame)))
+    assert not buffers.show(shown.append)
+
+    buffers.back.append("frame 2")  # the render thread draws into the other buffer
+    buffers.swap()
+    assert buffers.show(lambda frame: shown.append(list(frame)))
+    assert shown == [["frame 1"], ["frame 2"]]
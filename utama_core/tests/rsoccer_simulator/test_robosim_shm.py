@@ -0,0 +1,144 @@
+"""The shared-memory robosim transport, driven without the rc-robosim subprocess."""
+
+import importlib
+import io
+import json
+import sys
+import types
+from types import SimpleNamespace
+from unittest.mock import patch
+
+import numpy as np
+import pytest
+
+from utama_core.rsoccer_simulator.src.Simulators.robosim import robosim_wrapper as wrapper
+from utama_core.rsoccer_simulator.src.Simulators.robosim.robosim_wrapper import (
+    RSimSubprocessWrapper,
+)
+
+N_BLUE, N_YELLOW, COMMAND_COLS, STATE_LEN = 2, 1, 8, 5 + 11 * 3
+
+
+@pytest.fixture
+def child(monkeypatch):
+    # robosim_subprocess imports rc-robosim, which only exists in the robosim environment.
+    monkeypatch.setitem(sys.modules, "robosim", types.ModuleType("robosim"))
+    return importlib.import_module("utama_core.rsoccer_simulator.src.Simulators.robosim.robosim_subprocess")
+
+
+class FakeSim:
+    """Stands in for robosim.SSL: the state is the sum of the commands it was stepped with."""
+
+    def __init__(self):
+        self.total = np.zeros(STATE_LEN)
+        self.reset_with = None
+        self.fail = False
+
+    def step(self, commands):
+        if self.fail:
+            raise RuntimeError("physics exploded")
+        self.total[: commands.size] += commands.ravel()
+
+    def get_state(self):
+        return self.total.tolist()
+
+    def reset(self, ball, blue, yellow):
+        self.reset_with = (ball.copy(), blue.copy(), yellow.copy())
+
+
+def fake_arrays():
+    shapes = wrapper._array_shapes(N_BLUE, N_YELLOW, COMMAND_COLS, STATE_LEN)
+    commands, state, ball, blue, yellow = (np.zeros(shape) for shape in shapes)
+    return SimpleNamespace(commands=commands, state=state, reset_ball=ball, reset_blue=blue, reset_yellow=yellow)
+
+
+def serve(child, sim, arrays, ops: bytes) -> bytes:
+    stdout = io.BytesIO()
+    child.serve_shm(SimpleNamespace(sim=sim, get_field_params=lambda: {"length": 9.0}), arrays, io.BytesIO(ops), stdout)
+    return stdout.getvalue()
+
+
+class ShortReads(io.BytesIO):
+    """A pipe that returns at most two bytes per read, like an unbuffered pipe under load."""
+
+    def read(self, n=-1):
+        return super().read(min(n, 2) if n > 0 else 2)
+
+
+def wrapper_reading(replies: bytes) -> RSimSubprocessWrapper:
+    sim = RSimSubprocessWrapper.__new__(RSimSubprocessWrapper)
+    sim.proc = SimpleNamespace(stdin=io.BytesIO(), stdout=ShortReads(replies))
+    return sim
+
+
+def test_opcodes_match_between_wrapper_and_subprocess(child):
+    for name in ("OP_STEP", "OP_GET_STATE", "OP_RESET", "OP_FIELD_PARAMS", "REPLY_OK", "REPLY_ERROR"):
+        assert getattr(wrapper, name) == getattr(child, name), name
+    assert wrapper.LENGTH.format == child.LENGTH.format
+    assert wrapper._array_shapes(N_BLUE, N_YELLOW, COMMAND_COLS, STATE_LEN) == child.array_shapes(
+        N_BLUE, N_YELLOW, COMMAND_COLS, STATE_LEN
+    )
+
+
+def test_shared_arrays_see_the_wrappers_block(child):
+    parent = RSimSubprocessWrapper.__new__(RSimSubprocessWrapper)
+    parent._create_shared_arrays(N_BLUE, N_YELLOW, COMMAND_COLS, STATE_LEN)
+    # In the real child this stops its tracker unlinking the parent's block; in one process it would unregister it.
+    with patch("multiprocessing.resource_tracker.unregister"):
+        arrays = child.SharedArrays(parent._shm.name, N_BLUE, N_YELLOW, COMMAND_COLS, STATE_LEN)
+    try:
+        parent._commands[:] = np.arange(parent._commands.size).reshape(parent._commands.shape)
+        parent._reset_yellow[:] = 7.0
+        arrays.state[:] = 3.0
+        np.testing.assert_array_equal(arrays.commands, parent._commands)
+        np.testing.assert_array_equal(arrays.reset_yellow, parent._reset_yellow)
+        np.testing.assert_array_equal(parent._state, 3.0)
+        np.testing.assert_array_equal(parent._reset_ball, 0.0)  # neighbouring arrays do not overlap
+    finally:
+        arrays.close()
+        del parent._commands, parent._state, parent._reset_ball, parent._reset_blue, parent._reset_yellow
+        parent._shm.close()
+        parent._shm.unlink()
+
+
+def test_every_opcode_round_trips_through_the_wrapper(child):
+    sim, arrays = FakeSim(), fake_arrays()
+    arrays.commands[:] = 1.0
+    arrays.reset_ball[:] = (1, 2, 0, 0)
+    arrays.reset_yellow[:] = 5.0
+    ops = child.OP_STEP + child.OP_STEP + child.OP_GET_STATE + child.OP_RESET + child.OP_FIELD_PARAMS
+
+    parent = wrapper_reading(serve(child, sim, arrays, ops))
+    for op in (wrapper.OP_STEP, wrapper.OP_STEP, wrapper.OP_GET_STATE, wrapper.OP_RESET):
+        assert parent._request(op) == b""
+    assert json.loads(parent._request(wrapper.OP_FIELD_PARAMS)) == {"length": 9.0}
+
+    n_commands = arrays.commands.size
+    np.testing.assert_array_equal(arrays.state[:n_commands], 2.0)  # stepped twice
+    np.testing.assert_array_equal(arrays.state[n_commands:], 0.0)
+    np.testing.assert_array_equal(sim.reset_with[0], [1, 2, 0, 0])
+    np.testing.assert_array_equal(sim.reset_with[2], [[5, 5, 5]])
+    assert parent.proc.stdin.getvalue() == ops
+
+
+def test_errors_are_replied_and_raised(child):
+    sim = FakeSim()
+    sim.fail = True
+    replies = serve(child, sim, fake_arrays(), child.OP_STEP + b"?" + child.OP_GET_STATE)
+
+    parent = wrapper_reading(replies)
+    with pytest.raises(RuntimeError, match="physics exploded"):
+        parent._request(wrapper.OP_STEP)
+    with pytest.raises(RuntimeError, match="unknown opcode"):
+        parent._request(b"?")
+    assert parent._request(wrapper.OP_GET_STATE) == b""  # the server keeps going after an error
+
+
+def test_read_exact_reassembles_short_reads_and_detects_truncation():
+    parent = wrapper_reading(b"abcdefg")
+    assert parent._read_exact(5) == b"abcde"
+    with pytest.raises(RuntimeError, match="mid-reply"):
+        parent._read_exact(5)
+
+    with pytest.raises(RuntimeError, match="unexpected reply"):
+        wrapper_reading(b"")._request(wrapper.OP_STEP)
@@ -0,0 +1,56 @@
+from types import SimpleNamespace
+
+import numpy as np
+import pytest
+
+from utama_core.entities.data.vector import Vector2D
+from utama_core.skills.src.score_goal import find_shot_qualities, find_shot_quality
+from utama_core.skills.src.to_move_out.pass_quality_utils import (
+    best_heatmap_positions,
+    find_best_receiver_position,
+    find_pass_qualities,
+    interception_chance,
+    pass_quality_heatmap,
+)
+
+GOAL = dict(goal_x=4.5, goal_y1=-0.5, goal_y2=0.5)
+
+
+def test_batched_shot_quality_matches_ray_casting():
+    rng = np.random.default_rng(0)
+    for _ in range(40):
+        enemies = rng.uniform([-1, -2], [4.4, 2], size=(rng.integers(0, 8), 2))
+        points = rng.uniform([-2, -2], [4.0, 2], size=(15, 2))
+        robots = [SimpleNamespace(p=Vector2D(*e)) for e in enemies]
+
+        expected = [find_shot_quality(Vector2D(*p), robots, **GOAL) for p in points]
+        np.testing.assert_allclose(find_shot_qualities(points, enemies, **GOAL), expected, atol=1e-9)
+
+
+def test_enemy_on_pass_line_intercepts():
+    passer, receiver = Vector2D(0, 0), Vector2D(2, 0)
+    chance, closest, _ = interception_chance(passer, receiver, Vector2D(1, 0.3), 2.0, 3.0, -0.5)
+    assert chance > 0
+    np.testing.assert_allclose(closest, [1.0, 0.0])
+
+    # Behind the passer, or too slow to reach the line in time.
+    assert interception_chance(passer, receiver, Vector2D(-1, 0.3), 2.0, 3.0, -0.5)[0] == 0
+    assert interception_chance(passer, receiver, Vector2D(1, 3.0), 0.1, 3.0, -0.5)[0] == 0
+
+
+def test_receiver_search_and_heatmap_agree_with_pass_qualities():
+    passer = Vector2D(0, 0)
+    enemies = np.array([[1.0, 0.2], [3.0, -1.0], [4.0, 0.0]])
+    speeds = np.full(3, 2.0)
+    args = (enemies, speeds, 3.0, -0.5, GOAL["goal_x"], GOAL["goal_y1"], GOAL["goal_y2"])
+
+    best, sampled, qualities = find_best_receiver_position(Vector2D(2, 1), passer, *args, False)
+    assert len(sampled) == len(qualities) == 11
+    assert best == sampled[int(np.argmax(qualities))]
+    np.testing.assert_allclose(find_pass_qualities(passer, sampled, *args), qualities)
+
+    xs, ys, grid = pass_quality_heatmap(passer, *args, resolution=0.5)
+    assert grid.shape == (len(ys), len(xs)) == (13, 19)
+    assert np.isneginf(grid[6, 9])  # the passer's own cell is too short a pass
+    (top,) = best_heatmap_positions(xs, ys, grid)
+    assert find_pass_qualities(passer, [top], *args)[0] == pytest.approx(grid.max())
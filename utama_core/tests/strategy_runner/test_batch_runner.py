@@ -0,0 +1,82 @@
+import subprocess
+import sys
+from functools import partial
+from types import SimpleNamespace
+
+import pytest
+
+from utama_core.config.enums import Mode
+from utama_core.run.batch_runner import BatchScenario, run_batch, run_scenario
+
+
+class _FakeRunner:
+    def __init__(self, passed: bool, mode: Mode = Mode.RSIM, raises: bool = False):
+        self.mode = mode
+        self.rsim_env = SimpleNamespace(render_mode="human", steps=0)
+        self._passed = passed
+        self._raises = raises
+        self.headless = None
+
+    def run_test(self, test_manager, episode_timeout, rsim_headless):
+        if self._raises:
+            raise RuntimeError("strategy blew up")
+        assert self.rsim_env.render_mode is None
+        self.headless = rsim_headless
+        self.rsim_env.steps = 42
+        return self._passed
+
+
+# Module-level so they can be pickled into worker processes.
+def _fake_scenario(passed: bool = True, mode: Mode = Mode.RSIM, raises: bool = False):
+    return _FakeRunner(passed, mode, raises), None
+
+
+def test_run_scenario_forces_headless_and_reports_steps():
+    result = run_scenario(BatchScenario("ok", _fake_scenario))
+    assert result.passed
+    assert result.sim_steps == 42
+    assert result.error is None
+
+
+def test_run_scenario_records_errors_instead_of_raising():
+    result = run_scenario(BatchScenario("boom", partial(_fake_scenario, raises=True)))
+    assert not result.passed
+    assert "strategy blew up" in result.error
+
+    result = run_scenario(BatchScenario("grsim", partial(_fake_scenario, mode=Mode.GRSIM)))
+    assert not result.passed
+    assert "rsim mode" in result.error
+
+
+@pytest.mark.parametrize("max_workers", [1, 2])
+def test_run_batch_aggregates_in_input_order(max_workers):
+    scenarios = [
+        BatchScenario("a", _fake_scenario),
+        BatchScenario("b", partial(_fake_scenario, passed=False)),
+        BatchScenario("c", partial(_fake_scenario, raises=True)),
+    ]
+    batch = run_batch(scenarios, max_workers=max_workers)
+
+    assert [r.name for r in batch.results] == ["a", "b", "c"]
+    assert [r.name for r in batch.passed] == ["a"]
+    assert [r.name for r in batch.failed] == ["b", "c"]
+    assert not batch.all_passed
+    assert "1/3 scenarios passed" in batch.summary()
+
+
+def test_run_batch_rejects_duplicate_names():
+    with pytest.raises(ValueError):
+        run_batch([BatchScenario("a", _fake_scenario), BatchScenario("a", _fake_scenario)])
+
+
+def test_headless_env_does_not_import_pygame():
+    code = (
+        "import sys\n"
+        "from utama_core.rsoccer_simulator.src.ssl.envs import SSLStandardEnv\n"
+        "env = SSLStandardEnv(n_robots_blue=1, n_robots_yellow=1, render_mode=None)\n"
+        "env.reset()\n"
+        "env.draw_point(0.0, 0.0)\n"
+        "assert not env.overlay\n"
+        "assert 'pygame' not in sys.modules\n"
+    )
+    subprocess.run([sys.executable, "-c", code], check=True)
@@ -5,6 +5,7 @@ from unittest.mock import MagicMock, patch
 import pytest
 
 from utama_core.config.enums import Mode
+from utama_core.global_utils.latency import LatencyTracker
 
 
 @pytest.fixture
@@ -17,6 +18,8 @@ def mock_runner():
         runner.mode = Mode.REAL
         runner.logger = MagicMock()
         runner.profiler = None
+        runner.latency = LatencyTracker()
+        runner.latency_export_path = None
         runner.replay_writer = None
         runner.rsim_env = None
         runner._fps_live = None
@@ -47,11 +47,11 @@ def test_grsim_spawn_positions_and_ball_use_field_bounds_center():
 
     with (
         patch(
-            "utama_core.run.strategy_runner.GRSimController",
+            "utama_core.team_controller.src.controllers.GRSimController",
             _FakeGRSimController,
         ),
         patch(
-            "utama_core.run.strategy_runner.GRSimRobotController",
+            "utama_core.team_controller.src.controllers.GRSimRobotController",
             _FakeGRSimRobotController,
         ),
         patch.object(
@@ -125,11 +125,11 @@ def test_grsim_exp_ball_false_removes_ball_not_center_teleport():
 
     with (
         patch(
-            "utama_core.run.strategy_runner.GRSimController",
+            "utama_core.team_controller.src.controllers.GRSimController",
             _FakeGRSimController,
         ),
         patch(
-            "utama_core.run.strategy_runner.GRSimRobotController",
+            "utama_core.team_controller.src.controllers.GRSimRobotController",
             _FakeGRSimRobotController,
         ),
         patch.object(
@@ -0,0 +1,59 @@
+"""Per-mode subsystem imports and the prewarm of StrategyRunner."""
+
+import subprocess
+import sys
+
+from utama_core.run.strategy_runner import StrategyRunner
+from utama_core.strategy.examples import StartupStrategy
+
+
+def _rsim_runner(**kwargs) -> StrategyRunner:
+    return StrategyRunner(
+        strategy=StartupStrategy(),
+        my_team_is_yellow=True,
+        my_team_is_right=True,
+        mode="rsim",
+        exp_friendly=3,
+        exp_enemy=3,
+        **kwargs,
+    )
+
+
+def test_each_mode_imports_only_its_subsystems():
+    code = (
+        "import sys\n"
+        "from utama_core.run.strategy_runner import StrategyRunner\n"
+        "from utama_core.strategy.examples import StartupStrategy\n"
+        "envs = 'utama_core.rsoccer_simulator.src.ssl.envs'\n"
+        "real = 'utama_core.team_controller.src.controllers.real.real_robot_controller'\n"
+        "test_manager = 'utama_core.tests.common.abstract_test_manager'\n"
+        "for name in ('rich', 'pygame', 'serial', envs, real, test_manager):\n"
+        "    assert name not in sys.modules, name\n"
+        "StrategyRunner(strategy=StartupStrategy(), my_team_is_yellow=True, my_team_is_right=True, mode='rsim',\n"
+        "               exp_friendly=3, exp_enemy=3)\n"
+        "assert envs in sys.modules\n"
+        "for name in ('rich', 'pygame', 'serial', real, test_manager):\n"
+        "    assert name not in sys.modules, name\n"
+    )
+    subprocess.run([sys.executable, "-c", code], check=True)
+
+
+def test_startup_times_without_prewarm():
+    runner = _rsim_runner()
+    assert runner.startup_times["game_valid"] > 0
+    assert "prewarm" not in runner.startup_times
+
+    runner._run_step()
+    assert runner.startup_times["first_command"] >= runner.startup_times["game_valid"]
+
+
+def test_prewarm_builds_first_tick_state_before_kickoff():
+    runner = _rsim_runner(prewarm=True, refine_in_place=True)
+
+    assert runner.startup_times["prewarm"] > 0
+    assert runner.my.frame_workspace is not None
+    assert "boundary_distance_grid" in vars(runner.my.game.field.geometry)
+    assert "first_command" not in runner.startup_times  # prewarm plans, but sends nothing
+
+    runner._run_step()
+    assert runner.startup_times["first_command"] >= runner.startup_times["game_valid"] + runner.startup_times["prewarm"]
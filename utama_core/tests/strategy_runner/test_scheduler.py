@@ -0,0 +1,69 @@
+import threading
+import time
+
+import pytest
+
+from utama_core.run.scheduler import LoopScheduler, SchedulerMode
+
+PERIOD = 0.01
+
+
+def test_deadline_mode_keeps_absolute_phase():
+    scheduler = LoopScheduler(SchedulerMode.DEADLINE, period=PERIOD)
+    start = time.perf_counter()
+    tick_start = start
+    for _ in range(5):
+        scheduler.wait(tick_start)
+        tick_start = time.perf_counter()
+
+    # Five deadlines at start + k * PERIOD, independent of per-tick processing time.
+    assert tick_start - start == pytest.approx(5 * PERIOD, abs=PERIOD / 2)
+    assert scheduler.overruns == 0
+    assert not scheduler.last_tick_overran
+
+
+def test_deadline_overrun_is_reported_and_missed_deadlines_skipped():
+    scheduler = LoopScheduler(SchedulerMode.DEADLINE, period=PERIOD)
+    # This tick started 3.5 periods ago, so it overran and skipped 2 further deadlines.
+    scheduler.wait(time.perf_counter() - 3.5 * PERIOD)
+
+    assert scheduler.last_tick_overran
+    assert scheduler.overruns == 1
+    assert scheduler.missed_deadlines == 2
+
+    scheduler.wait(time.perf_counter())
+    assert not scheduler.last_tick_overran
+    stats = scheduler.stats()
+    assert stats.ticks == 2
+    assert stats.overruns == 1
+
+
+def test_sleep_mode_reports_overruns():
+    scheduler = LoopScheduler(SchedulerMode.SLEEP, period=PERIOD)
+    scheduler.wait(time.perf_counter() - 2 * PERIOD)
+    assert scheduler.last_tick_overran
+    assert scheduler.overruns == 1
+
+
+def test_vision_mode_wakes_on_fresh_frame():
+    fresh = threading.Event()
+    scheduler = LoopScheduler(SchedulerMode.VISION, period=1.0, fresh_vision=fresh, min_interval=0.0)
+    threading.Timer(0.02, fresh.set).start()
+
+    start = time.perf_counter()
+    scheduler.wait(start)
+
+    assert time.perf_counter() - start < 0.5
+    assert not fresh.is_set()
+
+
+def test_vision_mode_falls_back_to_period_without_frames():
+    scheduler = LoopScheduler(SchedulerMode.VISION, period=PERIOD, fresh_vision=threading.Event())
+    start = time.perf_counter()
+    scheduler.wait(start)
+    assert time.perf_counter() - start == pytest.approx(PERIOD, abs=PERIOD / 2)
+
+
+def test_vision_mode_requires_event():
+    with pytest.raises(ValueError):
+        LoopScheduler(SchedulerMode.VISION)